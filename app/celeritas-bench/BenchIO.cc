@@ -0,0 +1,44 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BenchIO.cc
+//---------------------------------------------------------------------------//
+#include "BenchIO.hh"
+
+namespace celeritas_bench
+{
+//---------------------------------------------------------------------------//
+//!@{
+//! I/O routines for JSON
+void to_json(nlohmann::json& j, const BenchArgs& v)
+{
+    j = nlohmann::json{{"data_path", v.data_path},
+                       {"filter", v.filter},
+                       {"num_samples", v.num_samples},
+                       {"num_repeats", v.num_repeats},
+                       {"seed", v.seed}};
+}
+
+void from_json(const nlohmann::json& j, BenchArgs& v)
+{
+    v.data_path   = j.value("data_path", std::string{});
+    v.filter      = j.value("filter", std::string{});
+    v.num_samples = j.value("num_samples", BenchArgs::size_type{100000});
+    v.num_repeats = j.value("num_repeats", BenchArgs::size_type{5});
+    v.seed        = j.value("seed", 12345u);
+}
+
+void to_json(nlohmann::json& j, const BenchResult& v)
+{
+    j = nlohmann::json{{"name", v.name},
+                       {"num_calls", v.num_calls},
+                       {"time", v.time},
+                       {"ns_per_call", v.ns_per_call()},
+                       {"samples_per_sec", v.samples_per_sec()}};
+}
+//!@}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_bench
@@ -0,0 +1,69 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BenchIO.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "base/Types.hh"
+
+namespace celeritas_bench
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Input for a benchmark run.
+ *
+ * The data path is the directory containing the Livermore photoelectric and
+ * Seltzer-Berger data files; if it's empty, benchmarks that need them are
+ * skipped. Only benchmarks whose name contains the filter string are run.
+ */
+struct BenchArgs
+{
+    using size_type = celeritas::size_type;
+
+    std::string  data_path;       //!< Path to EM data files
+    std::string  filter;          //!< Substring of benchmarks to run
+    size_type    num_samples{};   //!< Calls per timed batch
+    size_type    num_repeats{};   //!< Timed batches per benchmark
+    unsigned int seed{};          //!< Seed for sampled inputs
+
+    //! Whether the run arguments are valid
+    explicit operator bool() const
+    {
+        return num_samples > 0 && num_repeats > 0;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Timing for a single benchmark.
+ *
+ * The time is the fastest of the repeated batches.
+ */
+struct BenchResult
+{
+    using size_type = celeritas::size_type;
+
+    std::string name;          //!< Benchmark name
+    size_type   num_calls{};   //!< Calls per batch
+    double      time{};        //!< Best batch time [s]
+
+    //! Average time per call [ns]
+    double ns_per_call() const { return 1e9 * time / num_calls; }
+
+    //! Throughput [1/s]
+    double samples_per_sec() const { return num_calls / time; }
+};
+
+void to_json(nlohmann::json& j, const BenchArgs& value);
+void from_json(const nlohmann::json& j, BenchArgs& value);
+
+void to_json(nlohmann::json& j, const BenchResult& value);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_bench
@@ -0,0 +1,54 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BenchRunner.cc
+//---------------------------------------------------------------------------//
+#include "BenchRunner.hh"
+
+#include <cmath>
+#include <random>
+
+namespace celeritas_bench
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample values log-uniformly in [lo, hi).
+ *
+ * This approximates the falling energy spectrum of tracks in a shower.
+ */
+std::vector<double>
+sample_log_uniform(double lo, double hi, size_type count, unsigned int seed)
+{
+    CELER_EXPECT(lo > 0 && lo < hi);
+    std::vector<double> result = sample_uniform(
+        std::log(lo), std::log(hi), count, seed);
+    for (double& v : result)
+    {
+        v = std::exp(v);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample values uniformly in [lo, hi).
+ */
+std::vector<double>
+sample_uniform(double lo, double hi, size_type count, unsigned int seed)
+{
+    CELER_EXPECT(lo < hi);
+    std::mt19937                           rng(seed);
+    std::uniform_real_distribution<double> sample(lo, hi);
+
+    std::vector<double> result(count);
+    for (double& v : result)
+    {
+        v = sample(rng);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_bench
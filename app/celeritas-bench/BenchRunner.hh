@@ -0,0 +1,121 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BenchRunner.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+#include "base/Range.hh"
+#include "base/Stopwatch.hh"
+#include "comm/Logger.hh"
+#include "BenchIO.hh"
+
+namespace celeritas_bench
+{
+using celeritas::size_type;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time repeated batches of calls to a benchmark function.
+ *
+ * The function is called with the number of samples to run and must return
+ * a value that depends on every call (e.g. the sum of sampled energies) so
+ * that the work can't be optimized away. The fastest batch is kept, which
+ * also discards the cold-cache first batch.
+ *
+ * \code
+    BenchRunner run(args);
+    run("xs_calculator", [&](size_type n) {
+        double result = 0;
+        for (auto i : range(n))
+            result += calc_xs(energies[i]);
+        return result;
+    });
+   \endcode
+ */
+class BenchRunner
+{
+  public:
+    //!@{
+    //! Type aliases
+    using size_type = celeritas::size_type;
+    using VecResult = std::vector<BenchResult>;
+    //!@}
+
+  public:
+    //! Construct with run arguments
+    explicit BenchRunner(BenchArgs args) : args_(std::move(args))
+    {
+        CELER_EXPECT(args_);
+    }
+
+    //! Run arguments
+    const BenchArgs& args() const { return args_; }
+
+    //! Whether a benchmark is selected by the filter
+    bool enabled(const std::string& name) const
+    {
+        return name.find(args_.filter) != std::string::npos;
+    }
+
+    // Time a benchmark
+    template<class F>
+    inline void operator()(const std::string& name, F&& run_batch);
+
+    //! Accumulated results
+    const VecResult& results() const { return results_; }
+
+  private:
+    BenchArgs       args_;
+    VecResult       results_;
+    volatile double sink_ = 0;
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Sample values log-uniformly in [lo, hi)
+std::vector<double>
+sample_log_uniform(double lo, double hi, size_type count, unsigned int seed);
+
+// Sample values uniformly in [lo, hi)
+std::vector<double>
+sample_uniform(double lo, double hi, size_type count, unsigned int seed);
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Time a benchmark if it's selected by the filter.
+ */
+template<class F>
+void BenchRunner::operator()(const std::string& name, F&& run_batch)
+{
+    if (!this->enabled(name))
+        return;
+
+    CELER_LOG(status) << "Running " << name;
+    BenchResult result;
+    result.name      = name;
+    result.num_calls = args_.num_samples;
+    result.time      = std::numeric_limits<double>::infinity();
+    for (CELER_MAYBE_UNUSED auto r : celeritas::range(args_.num_repeats))
+    {
+        celeritas::Stopwatch get_time;
+        sink_ = sink_ + run_batch(args_.num_samples);
+        result.time = celeritas::min<double>(result.time, get_time());
+    }
+    CELER_LOG(info) << name << ": " << result.ns_per_call() << " ns/call";
+    results_.push_back(std::move(result));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_bench
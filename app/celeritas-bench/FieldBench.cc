@@ -0,0 +1,146 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldBench.cc
+//---------------------------------------------------------------------------//
+#include "FieldBench.hh"
+
+#include <string>
+#include "base/ArrayUtils.hh"
+#include "base/Constants.hh"
+#include "base/Units.hh"
+#include "comm/Logger.hh"
+#include "field/DormandPrinceStepper.hh"
+#include "field/FieldDriver.hh"
+#include "field/FieldParamsPointers.hh"
+#include "field/MagField.hh"
+#include "field/MagFieldEquation.hh"
+#include "field/RungeKuttaStepper.hh"
+#include "BenchRunner.hh"
+
+using namespace celeritas;
+
+namespace celeritas_bench
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// TYPES
+//---------------------------------------------------------------------------//
+/*!
+ * Helix of a 10.9 MeV electron in a 1 T field along z.
+ *
+ * These are the parameters of the field driver tests.
+ */
+struct Helix
+{
+    real_type field_value = 1.0 * units::tesla;
+    real_type radius      = 3.8085386036 * units::centimeter;
+    real_type delta_z     = 6.7003310629 * units::centimeter;
+    real_type momentum_y  = 10.9610028286; // MeV/c
+    real_type momentum_z  = 3.1969591583;  // MeV/c
+    int       nsteps      = 100;           // Driver calls per revolution
+
+    OdeState initial_state() const
+    {
+        OdeState y;
+        y.pos = {radius, 0, 0};
+        y.mom = {0, momentum_y, momentum_z};
+        return y;
+    }
+
+    real_type circumference() const { return 2 * constants::pi * radius; }
+};
+
+//! Count evaluations of the field equation
+class CountingEquation
+{
+  public:
+    explicit CountingEquation(const MagFieldEquation& eq) : eq_(eq) {}
+
+    OdeState operator()(const OdeState& y) const
+    {
+        ++count_;
+        return eq_(y);
+    }
+
+    size_type count() const { return count_; }
+
+  private:
+    const MagFieldEquation& eq_;
+    mutable size_type       count_ = 0;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time driver steps along the helix and report the cost and accuracy.
+ *
+ * After timing, the helix is integrated for ten revolutions to count field
+ * equation evaluations per unit length and the final position error.
+ */
+template<template<class> class S>
+void run_driver(BenchRunner& run, const std::string& name)
+{
+    if (!run.enabled(name))
+        return;
+
+    const Helix         helix;
+    FieldParamsPointers field_params;
+    MagField            field({0, 0, helix.field_value});
+    MagFieldEquation    equation(field, units::ElementaryCharge{-1});
+    CountingEquation    counted(equation);
+    S<CountingEquation> stepper(counted);
+    FieldDriver<S<CountingEquation>> driver(field_params, stepper);
+
+    const real_type hstep = helix.circumference() / helix.nsteps;
+    OdeState        y     = helix.initial_state();
+    run(name, [&](size_type n) {
+        real_type result = 0;
+        for (CELER_MAYBE_UNUSED auto i : range(n))
+        {
+            result += driver(hstep, &y);
+        }
+        return result + y.pos[2];
+    });
+
+    const int       revolutions = 10;
+    const size_type beg_count   = counted.count();
+    real_type       length      = 0;
+    y                           = helix.initial_state();
+    for (CELER_MAYBE_UNUSED int i : range(revolutions * helix.nsteps))
+    {
+        length += driver(hstep, &y);
+    }
+    Real3 delta = y.pos;
+    axpy(real_type(-1),
+         Real3{helix.radius, 0, revolutions * helix.delta_z},
+         &delta);
+
+    CELER_LOG(info) << name << ": "
+                    << (counted.count() - beg_count)
+                           / (length / units::centimeter)
+                    << " evaluations/cm, position error "
+                    << norm(delta) / units::centimeter << " cm after "
+                    << revolutions << " revolutions";
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Benchmark the field driver with each integration stepper.
+ *
+ * Each call advances an electron along a helix by one hundredth of a
+ * revolution, as in the field driver unit tests.
+ */
+void run_field_benchmarks(BenchRunner& run)
+{
+    run_driver<RungeKuttaStepper>(run, "field_driver_rk4");
+    run_driver<DormandPrinceStepper>(run, "field_driver_dp45");
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_bench
@@ -0,0 +1,19 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldBench.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+namespace celeritas_bench
+{
+class BenchRunner;
+
+//---------------------------------------------------------------------------//
+// Benchmark magnetic field integration with each stepper
+void run_field_benchmarks(BenchRunner& run);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_bench
@@ -0,0 +1,352 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file GridBench.cc
+//---------------------------------------------------------------------------//
+#include "GridBench.hh"
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "base/CollectionBuilder.hh"
+#include "physics/base/Units.hh"
+#include "physics/grid/EnergyLookup.hh"
+#include "physics/grid/GenericXsCalculator.hh"
+#include "physics/grid/InverseRangeCalculator.hh"
+#include "physics/grid/RangeCalculator.hh"
+#include "physics/grid/TwodGridCalculator.hh"
+#include "physics/grid/XsBatchCalculator.hh"
+#include "physics/grid/XsCalculator.hh"
+#include "physics/material/ElementSelector.hh"
+#include "physics/material/MaterialParams.hh"
+#include "random/Selector.hh"
+#include "BenchRunner.hh"
+
+using namespace celeritas;
+
+namespace celeritas_bench
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// TYPES
+//---------------------------------------------------------------------------//
+
+using RealStorage = Collection<real_type, Ownership::value, MemSpace::host>;
+using RealRef
+    = Collection<real_type, Ownership::const_reference, MemSpace::host>;
+using Energy = units::MevEnergy;
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Build a grid uniform in log energy with 20 points per decade.
+ *
+ * The values are calculated from the given function of energy.
+ */
+template<class F>
+XsGridData build_log_grid(real_type    emin,
+                          real_type    emax,
+                          F            calc_value,
+                          RealStorage* storage)
+{
+    size_type count = 1 + 20 * std::lround(std::log10(emax / emin));
+
+    XsGridData result;
+    result.log_energy
+        = UniformGridData::from_bounds(std::log(emin), std::log(emax), count);
+
+    std::vector<real_type> values(count);
+    for (auto i : range(count))
+    {
+        values[i] = calc_value(
+            std::exp(result.log_energy.front + i * result.log_energy.delta));
+    }
+    result.value
+        = make_builder(storage).insert_back(values.begin(), values.end());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Cross section and range grids.
+ */
+void run_xs_benchmarks(BenchRunner& run)
+{
+    const BenchArgs& args = run.args();
+    RealStorage      storage;
+
+    // Smooth cross sections; above 100 MeV, the stored values are scaled by E
+    // as for Geant4 "lambda prim" tables
+    auto xs_data = build_log_grid(
+        1e-3, 1e5, [](real_type e) { return 1 / (1 + e); }, &storage);
+    xs_data.prime_index = 100;
+    for (auto i : range(xs_data.prime_index, xs_data.log_energy.size))
+    {
+        real_type e = std::exp(xs_data.log_energy.front
+                               + i * xs_data.log_energy.delta);
+        storage[xs_data.value][i] *= e;
+    }
+    auto eloss_data = build_log_grid(
+        1e-3, 1e5, [](real_type e) { return 2 + std::log(e); }, &storage);
+
+    // Range increases monotonically with energy
+    auto range_data = build_log_grid(
+        1e-3, 1e5, [](real_type e) { return std::pow(e, 1.5); }, &storage);
+
+    // Generic grid with the same points, searched by bisection
+    GenericGridData generic_data;
+    {
+        std::vector<real_type> energy;
+        for (auto i : range(xs_data.log_energy.size))
+        {
+            energy.push_back(std::exp(xs_data.log_energy.front
+                                      + i * xs_data.log_energy.delta));
+        }
+        auto build         = make_builder(&storage);
+        generic_data.grid  = build.insert_back(energy.begin(), energy.end());
+        generic_data.value = xs_data.value;
+        generic_data.grid_interp  = Interp::linear;
+        generic_data.value_interp = Interp::linear;
+    }
+
+    RealRef values;
+    values = storage;
+
+    const auto energies
+        = sample_log_uniform(1e-3, 1e5, args.num_samples, args.seed);
+    const auto ranges = sample_log_uniform(
+        1e-6, std::pow(1e5, 1.5), args.num_samples, args.seed);
+
+    run("xs_calculator", [&](size_type n) {
+        XsCalculator calc_xs(xs_data, values);
+        real_type    result = 0;
+        for (auto i : range(n))
+        {
+            result += calc_xs(Energy{energies[i]});
+        }
+        return result;
+    });
+
+    run("xs_calculator_lookup", [&](size_type n) {
+        // Evaluate three tables sharing an energy grid at the same energy
+        XsCalculator calc_xs(xs_data, values);
+        XsCalculator calc_eloss(eloss_data, values);
+        RangeCalculator calc_range(range_data, values);
+        real_type       result = 0;
+        for (auto i : range(n))
+        {
+            EnergyLookup lookup(Energy{energies[i]});
+            result += calc_xs(lookup) + calc_eloss(lookup)
+                      + calc_range(lookup);
+        }
+        return result;
+    });
+
+    {
+        // Same grid evaluated in batches
+        Collection<XsGridData, Ownership::value, MemSpace::host> grids;
+        auto grid_id = make_builder(&grids).push_back(xs_data);
+        XsBatchCalculator::Grids grid_ref;
+        grid_ref = grids;
+        std::vector<real_type> xs(args.num_samples);
+
+        run("xs_batch_calculator", [&](size_type n) {
+            XsBatchCalculator calc_xs(grid_ref, values);
+            calc_xs(grid_id,
+                    make_span(energies).subspan(0, n),
+                    make_span(xs).subspan(0, n));
+            real_type result = 0;
+            for (auto i : range(n))
+            {
+                result += xs[i];
+            }
+            return result;
+        });
+    }
+
+    run("generic_xs_calculator", [&](size_type n) {
+        GenericXsCalculator calc_xs(generic_data, values);
+        real_type           result = 0;
+        for (auto i : range(n))
+        {
+            result += calc_xs(energies[i]);
+        }
+        return result;
+    });
+
+    run("range_calculator", [&](size_type n) {
+        RangeCalculator calc_range(range_data, values);
+        real_type       result = 0;
+        for (auto i : range(n))
+        {
+            result += calc_range(Energy{energies[i]});
+        }
+        return result;
+    });
+
+    run("inverse_range_calculator", [&](size_type n) {
+        InverseRangeCalculator calc_energy(range_data, values);
+        real_type              result = 0;
+        for (auto i : range(n))
+        {
+            result += calc_energy(ranges[i]).value();
+        }
+        return result;
+    });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * 2D grids, similar to the Seltzer-Berger tables.
+ */
+void run_twod_benchmarks(BenchRunner& run)
+{
+    const BenchArgs& args = run.args();
+    RealStorage      storage;
+
+    // Log incident energy vs. reduced exiting energy
+    const size_type nx = 57;
+    const size_type ny = 32;
+
+    std::vector<real_type> xgrid(nx);
+    std::vector<real_type> ygrid(ny);
+    for (auto i : range(nx))
+    {
+        xgrid[i] = std::log(1e-3) + i * (std::log(1e7) / (nx - 1));
+    }
+    for (auto j : range(ny))
+    {
+        ygrid[j] = real_type(j) / (ny - 1);
+    }
+    std::vector<real_type> values(nx * ny);
+    for (auto i : range(nx))
+    {
+        for (auto j : range(ny))
+        {
+            values[i * ny + j] = (1 + xgrid[i] * xgrid[i]) * (1 - ygrid[j]);
+        }
+    }
+
+    TwodGridData data;
+    auto         build = make_builder(&storage);
+    data.x             = build.insert_back(xgrid.begin(), xgrid.end());
+    data.y             = build.insert_back(ygrid.begin(), ygrid.end());
+    data.values        = build.insert_back(values.begin(), values.end());
+
+    RealRef reals;
+    reals = storage;
+
+    const auto xs = sample_uniform(
+        xgrid.front(), xgrid.back(), args.num_samples, args.seed);
+    const auto ys = sample_uniform(0, 1, args.num_samples, args.seed + 1);
+
+    run("twod_grid_calculator", [&](size_type n) {
+        TwodGridCalculator calc(data, reals);
+        real_type          result = 0;
+        for (auto i : range(n))
+        {
+            result += calc({xs[i], ys[i]});
+        }
+        return result;
+    });
+
+    run("twod_subgrid_calculator", [&](size_type n) {
+        // Reuse the x interpolation for all samples, as when rejection
+        // sampling the exiting energy for a fixed incident energy
+        TwodSubgridCalculator calc = TwodGridCalculator(data, reals)(xs[0]);
+        real_type             result = 0;
+        for (auto i : range(n))
+        {
+            result += calc(ys[i]);
+        }
+        return result;
+    });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Discrete samplers.
+ */
+void run_selector_benchmarks(BenchRunner& run)
+{
+    using namespace celeritas::units;
+    const BenchArgs& args = run.args();
+
+    std::mt19937 rng(args.seed);
+
+    // Unnormalized probabilities
+    std::vector<real_type> pdf(16);
+    real_type              total = 0;
+    for (auto i : range(pdf.size()))
+    {
+        pdf[i] = 1 + (i % 5);
+        total += pdf[i];
+    }
+
+    run("selector", [&](size_type n) {
+        auto select = make_selector(
+            [&pdf](size_type i) { return pdf[i]; }, pdf.size(), total);
+        real_type result = 0;
+        for (CELER_MAYBE_UNUSED auto i : range(n))
+        {
+            result += select(rng);
+        }
+        return result;
+    });
+
+    // Lead tungstate
+    MaterialParams::Input inp;
+    inp.elements  = {{8, AmuMass{15.999}, "O"},
+                    {74, AmuMass{183.84}, "W"},
+                    {82, AmuMass{207.2}, "Pb"}};
+    inp.materials = {{1.0 * constants::na_avogadro,
+                      293.0,
+                      MatterState::solid,
+                      {{ElementId{0}, 0.5},
+                       {ElementId{1}, 0.3},
+                       {ElementId{2}, 0.2}},
+                      "PbWO"}};
+    MaterialParams     materials(std::move(inp));
+    const MaterialView mat = materials.get(MaterialId{0});
+
+    const auto energies
+        = sample_log_uniform(1e-3, 1e5, args.num_samples, args.seed);
+
+    run("element_selector", [&](size_type n) {
+        real_type storage[3];
+        real_type result = 0;
+        for (auto i : range(n))
+        {
+            // Energy-dependent microscopic cross section
+            real_type      energy  = energies[i];
+            auto           calc_xs = [energy](ElementId el) {
+                return (el.get() + 1) / (1 + energy);
+            };
+            ElementSelector select_el(
+                mat, calc_xs, make_span(storage));
+            result += select_el(rng).get();
+        }
+        return result;
+    });
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Benchmark grid calculators and discrete samplers.
+ */
+void run_grid_benchmarks(BenchRunner& run)
+{
+    run_xs_benchmarks(run);
+    run_twod_benchmarks(run);
+    run_selector_benchmarks(run);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_bench
@@ -0,0 +1,375 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InteractorBench.cc
+//---------------------------------------------------------------------------//
+#include "InteractorBench.hh"
+
+#include <memory>
+#include <vector>
+#include "base/CollectionStateStore.hh"
+#include "base/StackAllocator.hh"
+#include "io/LivermorePEReader.hh"
+#include "io/SeltzerBergerReader.hh"
+#include "physics/base/CutoffParams.hh"
+#include "physics/base/CutoffView.hh"
+#include "physics/base/Interaction.hh"
+#include "physics/base/ParticleParams.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/Secondary.hh"
+#include "physics/em/LivermorePEModel.hh"
+#include "physics/em/RayleighModel.hh"
+#include "physics/em/SeltzerBergerModel.hh"
+#include "physics/em/detail/BetheHeitlerInteractor.hh"
+#include "physics/em/detail/EPlusGGInteractor.hh"
+#include "physics/em/detail/KleinNishinaInteractor.hh"
+#include "physics/em/detail/LivermorePEInteractor.hh"
+#include "physics/em/detail/MollerBhabhaInteractor.hh"
+#include "physics/em/detail/RayleighInteractor.hh"
+#include "physics/em/detail/SeltzerBergerInteractor.hh"
+#include "physics/material/MaterialParams.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "random/RngEngine.hh"
+#include "random/RngParams.hh"
+#include "BenchRunner.hh"
+
+using namespace celeritas;
+using namespace celeritas::detail;
+
+namespace celeritas_bench
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// TYPES
+//---------------------------------------------------------------------------//
+
+using Energy = units::MevEnergy;
+template<template<Ownership, MemSpace> class S>
+using StateStore = CollectionStateStore<S, MemSpace::host>;
+template<Ownership W, MemSpace M>
+using SecondaryStackData = StackAllocatorData<Secondary, W, M>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Host data and single-track views needed to construct an interactor.
+ *
+ * The particle types are electrons, positrons, and photons; the material is
+ * a single-element material at unit molar density.
+ */
+class InteractorHarness
+{
+  public:
+    // Construct with an element and optional photon production cutoff
+    InteractorHarness(int z, units::AmuMass mass, real_type gamma_cutoff = 0);
+
+    //! Shared particle data
+    const ParticleParams& particles() const { return *particles_; }
+    //! Shared material data
+    const MaterialParams& materials() const { return *materials_; }
+
+    // Set the incident particle
+    void set_particle(PDGNumber pdg);
+
+    //! Incident particle state
+    ParticleTrackView& particle() { return particle_; }
+    //! Material state
+    const MaterialTrackView& material() const { return material_; }
+    //! Production cutoffs
+    CutoffView cutoffs() const { return cutoffs_->get(MaterialId{0}); }
+    //! Incident direction
+    const Real3& direction() const { return direction_; }
+
+    // Reset secondary allocation and return the allocator
+    inline StackAllocator<Secondary>& allocate();
+
+  private:
+    std::shared_ptr<const ParticleParams> particles_;
+    std::shared_ptr<const MaterialParams> materials_;
+    std::shared_ptr<const CutoffParams>   cutoffs_;
+
+    StateStore<ParticleStateData>  particle_states_;
+    StateStore<MaterialStateData>  material_states_;
+    StateStore<SecondaryStackData> secondaries_;
+
+    ParticleTrackView         particle_;
+    MaterialTrackView         material_;
+    StackAllocator<Secondary> allocate_;
+    Real3                     direction_{0, 0, 1};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with an element and optional photon production cutoff.
+ */
+InteractorHarness::InteractorHarness(int            z,
+                                     units::AmuMass mass,
+                                     real_type      gamma_cutoff)
+    : particles_([] {
+        using namespace celeritas::units;
+        constexpr auto zero   = zero_quantity();
+        constexpr auto stable = ParticleDef::stable_decay_constant();
+        return std::make_shared<ParticleParams>(ParticleParams::Input{
+            {"electron",
+             pdg::electron(),
+             MevMass{0.5109989461},
+             ElementaryCharge{-1},
+             stable},
+            {"positron",
+             pdg::positron(),
+             MevMass{0.5109989461},
+             ElementaryCharge{1},
+             stable},
+            {"gamma", pdg::gamma(), zero, zero, stable}});
+    }())
+    , materials_([z, mass] {
+        MaterialParams::Input inp;
+        inp.elements  = {{z, mass, "el"}};
+        inp.materials = {{1.0 * constants::na_avogadro,
+                          293.0,
+                          MatterState::solid,
+                          {{ElementId{0}, 1.0}},
+                          "mat"}};
+        return std::make_shared<MaterialParams>(std::move(inp));
+    }())
+    , cutoffs_([this, gamma_cutoff] {
+        CutoffParams::Input inp;
+        inp.materials = materials_;
+        inp.particles = particles_;
+        if (gamma_cutoff > 0)
+        {
+            inp.cutoffs.insert({pdg::gamma(), {{Energy{gamma_cutoff}, 0.1}}});
+        }
+        return std::make_shared<CutoffParams>(std::move(inp));
+    }())
+    , particle_states_(*particles_, 1)
+    , material_states_(*materials_, 1)
+    , secondaries_(16)
+    , particle_(
+          particles_->host_pointers(), particle_states_.ref(), ThreadId{0})
+    , material_(
+          materials_->host_pointers(), material_states_.ref(), ThreadId{0})
+    , allocate_(secondaries_.ref())
+{
+    material_ = MaterialTrackView::Initializer_t{MaterialId{0}};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the incident particle type.
+ */
+void InteractorHarness::set_particle(PDGNumber pdg)
+{
+    ParticleTrackView::Initializer_t init;
+    init.particle_id = particles_->find(pdg);
+    init.energy      = Energy{1};
+    particle_        = init;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reset secondary allocation and return the allocator.
+ */
+StackAllocator<Secondary>& InteractorHarness::allocate()
+{
+    allocate_.clear();
+    return allocate_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time an interactor over a spectrum of incident energies.
+ *
+ * The function must construct the interactor from the harness and return the
+ * sampled interaction.
+ */
+template<class F>
+void run_interactor(BenchRunner&       run,
+                    const std::string& name,
+                    InteractorHarness& harness,
+                    double             emin,
+                    double             emax,
+                    F                  sample_interaction)
+{
+    if (!run.enabled(name))
+        return;
+
+    const BenchArgs& args = run.args();
+    const auto       energies
+        = sample_log_uniform(emin, emax, args.num_samples, args.seed);
+
+    // Sample with the host track RNG used by the transport loop
+    RngParams                rng_params(args.seed);
+    StateStore<RngStateData> rng_state(rng_params, 1);
+    RngEngine                rng(rng_state.ref(), ThreadId{0});
+
+    run(name, [&](size_type n) {
+        real_type result = 0;
+        for (auto i : range(n))
+        {
+            harness.particle().energy(Energy{energies[i]});
+            Interaction interaction = sample_interaction(rng);
+            CELER_ASSERT(interaction);
+            result += interaction.energy.value();
+        }
+        return result;
+    });
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Benchmark EM interactors over incident energy spectra.
+ *
+ * The incident energies are sampled log-uniformly over the range where each
+ * model is typically applied. Models that need Livermore or Seltzer-Berger
+ * data are skipped if no data path is given.
+ */
+void run_interactor_benchmarks(BenchRunner& run)
+{
+    using units::AmuMass;
+    const std::string& data_path = run.args().data_path;
+
+    {
+        InteractorHarness h(29, AmuMass{63.546});
+        h.set_particle(pdg::gamma());
+        KleinNishinaPointers shared;
+        shared.model_id    = ModelId{0};
+        shared.electron_id = h.particles().find(pdg::electron());
+        shared.gamma_id    = h.particles().find(pdg::gamma());
+        shared.inv_electron_mass
+            = 1 / h.particles().get(shared.electron_id).mass().value();
+
+        auto sample = [&](RngEngine& rng) {
+            KleinNishinaInteractor interact(
+                shared, h.particle(), h.direction(), h.allocate());
+            return interact(rng);
+        };
+        run_interactor(run, "klein_nishina", h, 1e-2, 1e4, sample);
+    }
+    {
+        InteractorHarness h(29, AmuMass{63.546});
+        h.set_particle(pdg::gamma());
+        BetheHeitlerPointers shared;
+        shared.model_id    = ModelId{0};
+        shared.electron_id = h.particles().find(pdg::electron());
+        shared.positron_id = h.particles().find(pdg::positron());
+        shared.gamma_id    = h.particles().find(pdg::gamma());
+        shared.inv_electron_mass
+            = 1 / h.particles().get(shared.electron_id).mass().value();
+        const ElementView element
+            = h.material().material_view().element_view(ElementComponentId{0});
+
+        auto sample = [&](RngEngine& rng) {
+            BetheHeitlerInteractor interact(
+                shared, h.particle(), h.direction(), h.allocate(), element);
+            return interact(rng);
+        };
+        run_interactor(run, "bethe_heitler", h, 1.5, 1e5, sample);
+    }
+    {
+        InteractorHarness h(29, AmuMass{63.546});
+        h.set_particle(pdg::electron());
+        MollerBhabhaPointers shared;
+        shared.model_id    = ModelId{0};
+        shared.electron_id = h.particles().find(pdg::electron());
+        shared.positron_id = h.particles().find(pdg::positron());
+        shared.electron_mass_c_sq
+            = h.particles().get(shared.electron_id).mass().value();
+        const CutoffView cutoffs = h.cutoffs();
+
+        auto sample = [&](RngEngine& rng) {
+            MollerBhabhaInteractor interact(
+                shared, h.particle(), cutoffs, h.direction(), h.allocate());
+            return interact(rng);
+        };
+        run_interactor(run, "moller_bhabha", h, 1e-2, 1e5, sample);
+    }
+    {
+        InteractorHarness h(29, AmuMass{63.546});
+        h.set_particle(pdg::positron());
+        EPlusGGPointers shared;
+        shared.model_id    = ModelId{0};
+        shared.positron_id = h.particles().find(pdg::positron());
+        shared.gamma_id    = h.particles().find(pdg::gamma());
+        shared.electron_mass
+            = h.particles().get(shared.positron_id).mass().value();
+
+        auto sample = [&](RngEngine& rng) {
+            EPlusGGInteractor interact(
+                shared, h.particle(), h.direction(), h.allocate());
+            return interact(rng);
+        };
+        run_interactor(run, "eplusgg", h, 1e-3, 1e5, sample);
+    }
+    {
+        InteractorHarness h(82, AmuMass{207.2});
+        h.set_particle(pdg::gamma());
+        RayleighModel model(ModelId{0}, h.particles(), h.materials());
+
+        auto sample = [&](RngEngine& rng) {
+            RayleighInteractor interact(
+                model.host_group(), h.particle(), h.direction(), ElementId{0});
+            return interact(rng);
+        };
+        run_interactor(run, "rayleigh", h, 1e-3, 1e2, sample);
+    }
+
+    if (data_path.empty())
+    {
+        CELER_LOG(warning) << "No data path given: skipping Livermore "
+                              "photoelectric and Seltzer-Berger benchmarks";
+        return;
+    }
+    if (run.enabled("livermore_pe"))
+    {
+        InteractorHarness h(19, AmuMass{39.0983});
+        h.set_particle(pdg::gamma());
+        LivermorePEReader read_pe(data_path.c_str());
+        LivermorePEModel  model(
+            ModelId{0}, h.particles(), h.materials(), read_pe);
+        const CutoffView cutoffs = h.cutoffs();
+        RelaxationScratchData<Ownership::reference, MemSpace::host> scratch;
+
+        auto sample = [&](RngEngine& rng) {
+            LivermorePEInteractor interact(model.host_pointers(),
+                                           scratch,
+                                           ElementId{0},
+                                           h.particle(),
+                                           cutoffs,
+                                           h.direction(),
+                                           h.allocate());
+            return interact(rng);
+        };
+        run_interactor(run, "livermore_pe", h, 1e-3, 1, sample);
+    }
+    if (run.enabled("seltzer_berger"))
+    {
+        InteractorHarness h(29, AmuMass{63.546}, 0.01);
+        h.set_particle(pdg::electron());
+        SeltzerBergerReader read_sb(data_path.c_str());
+        SeltzerBergerModel  model(
+            ModelId{0}, h.particles(), h.materials(), read_sb);
+        const CutoffView   cutoffs  = h.cutoffs();
+        const MaterialView material = h.material().material_view();
+
+        auto sample = [&](RngEngine& rng) {
+            SeltzerBergerInteractor interact(model.host_pointers(),
+                                             h.particle(),
+                                             h.direction(),
+                                             cutoffs,
+                                             h.allocate(),
+                                             material,
+                                             ElementId{0});
+            return interact(rng);
+        };
+        run_interactor(run, "seltzer_berger", h, 1, 1e4, sample);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_bench
@@ -0,0 +1,178 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LayoutBench.cc
+//---------------------------------------------------------------------------//
+#include "LayoutBench.hh"
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include "base/Algorithms.hh"
+#include "base/ArrayUtils.hh"
+#include "base/SoACollection.hh"
+#include "BenchRunner.hh"
+
+using namespace celeritas;
+
+namespace celeritas_bench
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// TYPES
+//---------------------------------------------------------------------------//
+
+template<VectorLayout L>
+using Real3Storage = Real3StateCollection<L, Ownership::value, MemSpace::host>;
+template<VectorLayout L>
+using Real3Ref = Real3StateCollection<L, Ownership::reference, MemSpace::host>;
+
+//! Tally grid for z binning, as in the interactor demo detector
+struct ZGrid
+{
+    real_type front;
+    real_type inv_delta;
+    int       size;
+};
+
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+//!@{
+//! Move each position along its direction
+real_type push(Real3Ref<VectorLayout::aos>& pos,
+               Real3Ref<VectorLayout::aos>& dir,
+               real_type                    step)
+{
+    Span<Real3>       pos_span = pos[AllItems<Real3>{}];
+    Span<const Real3> dir_span = dir[AllItems<Real3>{}];
+    for (auto i : range(pos_span.size()))
+    {
+        for (auto d : range(3))
+        {
+            pos_span[i][d] += step * dir_span[i][d];
+        }
+    }
+    return pos_span.back()[2];
+}
+
+real_type push(Real3Ref<VectorLayout::soa>& pos,
+               Real3Ref<VectorLayout::soa>& dir,
+               real_type                    step)
+{
+    for (auto d : range(3))
+    {
+        Span<real_type>       pos_d = pos.component(d);
+        Span<const real_type> dir_d = dir.component(d);
+        for (auto i : range(pos_d.size()))
+        {
+            pos_d[i] += step * dir_d[i];
+        }
+    }
+    return pos.component(2).back();
+}
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the (clamped) tally bin of a z position.
+ */
+inline int find_bin(const ZGrid& grid, real_type z)
+{
+    int bin = static_cast<int>(std::floor((z - grid.front) * grid.inv_delta));
+    return celeritas::min(celeritas::max(bin, 0), grid.size - 1);
+}
+
+//!@{
+//! Sum the tally bins of all z positions
+real_type bin_z(const Real3Ref<VectorLayout::aos>& pos, const ZGrid& grid)
+{
+    Span<const Real3> pos_span = pos[AllItems<Real3>{}];
+    long              result   = 0;
+    for (auto i : range(pos_span.size()))
+    {
+        result += find_bin(grid, pos_span[i][2]);
+    }
+    return result;
+}
+
+real_type bin_z(const Real3Ref<VectorLayout::soa>& pos, const ZGrid& grid)
+{
+    Span<const real_type> z = pos.component(2);
+    long                  result = 0;
+    for (auto i : range(z.size()))
+    {
+        result += find_bin(grid, z[i]);
+    }
+    return result;
+}
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Position and direction loops for a single layout.
+ */
+template<VectorLayout L>
+void run_layout(BenchRunner& run, const std::string& suffix)
+{
+    const BenchArgs& args = run.args();
+
+    // Random positions in a 10 cm box and isotropic-ish directions
+    Real3Storage<L> pos_storage;
+    Real3Storage<L> dir_storage;
+    resize(&pos_storage, args.num_samples);
+    resize(&dir_storage, args.num_samples);
+    {
+        auto xyz = sample_uniform(-5, 5, 3 * args.num_samples, args.seed);
+        auto uvw = sample_uniform(-1, 1, 3 * args.num_samples, args.seed + 1);
+        for (auto tid : range(ThreadId{args.num_samples}))
+        {
+            auto  i   = 3 * tid.get();
+            Real3 dir = {uvw[i], uvw[i + 1], uvw[i + 2]};
+            normalize_direction(&dir);
+            pos_storage[tid] = Real3{xyz[i], xyz[i + 1], xyz[i + 2]};
+            dir_storage[tid] = dir;
+        }
+    }
+    Real3Ref<L> pos;
+    pos = pos_storage;
+    Real3Ref<L> dir;
+    dir = dir_storage;
+
+    run("real3_push_" + suffix, [&](size_type n) {
+        CELER_ASSERT(n == pos.size());
+        // Alternate directions so positions stay bounded
+        real_type result = push(pos, dir, 1e-3);
+        result += push(pos, dir, -1e-3);
+        return result;
+    });
+
+    const ZGrid grid{-5, 4, 40};
+    run("real3_zbin_" + suffix, [&](size_type n) {
+        CELER_ASSERT(n == pos.size());
+        return bin_z(pos, grid);
+    });
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Benchmark array-of-structs versus struct-of-arrays state layouts.
+ *
+ * Each batch loops over as many track states as there are samples, touching
+ * either all components (moving along a direction) or only one (tallying the
+ * z position).
+ */
+void run_layout_benchmarks(BenchRunner& run)
+{
+    run_layout<VectorLayout::aos>(run, "aos");
+    run_layout<VectorLayout::soa>(run, "soa");
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_bench
@@ -0,0 +1,107 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas-bench.cc
+//---------------------------------------------------------------------------//
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "celeritas_version.h"
+#include "comm/Communicator.hh"
+#include "comm/Logger.hh"
+#include "comm/ScopedMpiInit.hh"
+#include "BenchIO.hh"
+#include "BenchRunner.hh"
+#include "FieldBench.hh"
+#include "GridBench.hh"
+#include "InteractorBench.hh"
+#include "LayoutBench.hh"
+
+using namespace celeritas;
+using namespace celeritas_bench;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+namespace celeritas_bench
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Run all benchmarks and write results to stdout.
+ */
+void run(std::istream& is)
+{
+    // Read input options
+    auto inp  = nlohmann::json::parse(is);
+    auto args = inp.get<BenchArgs>();
+    CELER_VALIDATE(args,
+                   << "invalid benchmark arguments: num_samples and "
+                      "num_repeats must be positive");
+
+    BenchRunner run(args);
+    run_field_benchmarks(run);
+    run_grid_benchmarks(run);
+    run_interactor_benchmarks(run);
+    run_layout_benchmarks(run);
+
+    nlohmann::json outp = {
+        {"input", args},
+        {"result", run.results()},
+        {
+            "runtime",
+            {
+                {"version", std::string(celeritas_version)},
+            },
+        },
+    };
+    cout << outp.dump() << endl;
+}
+} // namespace celeritas_bench
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute and run.
+ */
+int main(int argc, char* argv[])
+{
+    ScopedMpiInit scoped_mpi(&argc, &argv);
+    if (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized
+        && Communicator::comm_world().size() > 1)
+    {
+        CELER_LOG(critical) << "This app cannot run in parallel";
+        return EXIT_FAILURE;
+    }
+
+    // Process input arguments
+    std::vector<std::string> args(argv, argv + argc);
+    if (args.size() != 2 || args[1] == "--help" || args[1] == "-h")
+    {
+        cerr << "usage: " << args[0] << " {input}.json" << endl;
+        return EXIT_FAILURE;
+    }
+
+    if (args[1] != "-")
+    {
+        std::ifstream infile(args[1]);
+        if (!infile)
+        {
+            CELER_LOG(critical) << "Failed to open '" << args[1] << "'";
+            return EXIT_FAILURE;
+        }
+        run(infile);
+    }
+    else
+    {
+        // Read input from STDIN
+        run(std::cin);
+    }
+
+    return EXIT_SUCCESS;
+}
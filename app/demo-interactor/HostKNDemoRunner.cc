@@ -7,13 +7,16 @@
 //---------------------------------------------------------------------------//
 #include "HostKNDemoRunner.hh"
 
+#include <algorithm>
 #include <iostream>
-#include <random>
 #include "base/ArrayUtils.hh"
 #include "base/CollectionStateStore.hh"
 #include "base/Range.hh"
 #include "base/StackAllocator.hh"
 #include "base/Stopwatch.hh"
+#include "comm/EventDistributor.hh"
+#include "comm/Operations.hh"
+#include "random/RngEngine.hh"
 #include "random/distributions/ExponentialDistribution.hh"
 #include "physics/base/ParticleTrackView.hh"
 #include "physics/base/Units.hh"
@@ -33,8 +36,11 @@ namespace demo_interactor
  * Construct with parameters.
  */
 HostKNDemoRunner::HostKNDemoRunner(constSPParticleParams particles,
-                                   constSPXsGridParams   xs)
-    : pparams_(std::move(particles)), xsparams_(std::move(xs))
+                                   constSPXsGridParams   xs,
+                                   Communicator          comm)
+    : pparams_(std::move(particles))
+    , xsparams_(std::move(xs))
+    , comm_(std::move(comm))
 {
     CELER_EXPECT(pparams_);
     CELER_EXPECT(xsparams_);
@@ -68,8 +74,11 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
     Stopwatch total_time;
     double    transport_time = 0.0;
 
-    // Random number generations
-    std::mt19937 rng(args.seed);
+    // Random number generation: each track gets its own counter-based stream
+    RngParamsData<Ownership::value, MemSpace::host> rng_params;
+    rng_params.seed = args.seed;
+    RngStateData<Ownership::value, MemSpace::host> rng_states;
+    resize(&rng_states, make_const_ref(rng_params), 1);
 
     // Particle data
     ParticleStateData<Ownership::value, MemSpace::host> track_states;
@@ -99,118 +108,147 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
 
     StateHostRef state;
     state.particle    = track_states;
+    auto rng_ref      = make_ref(rng_states);
     state.secondaries = secondaries;
     state.detector    = detector_states;
 
+    // Hand out about 16 batches of tracks per process so that the processes
+    // that draw short-lived tracks take on more of them
+    EventDistributor next_batch(
+        comm_,
+        args.num_tracks,
+        std::max<size_type>(args.num_tracks / (16 * comm_.size()), 1));
+
     // Loop over particle tracks and events per track
-    for (CELER_MAYBE_UNUSED auto n : range(args.num_tracks))
+    for (auto batch = next_batch(); !batch.empty(); batch = next_batch())
     {
-        // Storage for track state
-        Real3     position  = {0, 0, 0};
-        Real3     direction = {0, 0, 1};
-        real_type time      = 0;
-        bool      alive     = true;
-
-        // Create and initialize particle view
-        ParticleTrackView particle(
-            params.particle, state.particle, ThreadId{0});
-
-        // Create helper classes
-        StackAllocator<Secondary> allocate_secondaries(state.secondaries);
-        Detector                  detector(params.detector, state.detector);
-        XsCalculator calc_xs(params.tables.xs, params.tables.reals);
-
-        CELER_ASSERT(state.secondaries.capacity() == args.max_steps);
-        CELER_ASSERT(state.detector.hit_buffer.capacity() == args.max_steps);
-        CELER_ASSERT(allocate_secondaries.get().size() == 0);
-        CELER_ASSERT(detector.num_hits() == 0);
-
-        // Counters
-        size_type num_steps       = 0;
-        auto      remaining_steps = args.max_steps;
-        Stopwatch elapsed_time;
-
-        particle = initial.particle;
-
-        while (alive && --remaining_steps > 0)
+        for (auto n : batch)
         {
-            // Increment alive counter
-            CELER_ASSERT(num_steps < result.alive.size());
-            result.alive[num_steps]++;
-            ++num_steps;
-
-            // Move to collision
-            demo_interactor::move_to_collision(
-                particle, calc_xs, direction, &position, &time, rng);
-
-            // Hit analysis
-            Hit h;
-            h.pos    = position;
-            h.dir    = direction;
-            h.thread = ThreadId(0);
-            h.time   = time;
-
-            // Check for below energy cutoff
-            if (particle.energy() < units::MevEnergy{0.01})
+            // Storage for track state
+            Real3     position  = {0, 0, 0};
+            Real3     direction = {0, 0, 1};
+            real_type time      = 0;
+            bool      alive     = true;
+
+            // Create and initialize particle view
+            ParticleTrackView particle(
+                params.particle, state.particle, ThreadId{0});
+
+            // Key the random stream on the track number
+            RngEngine rng(rng_ref, ThreadId{0});
             {
-                // Particle is below interaction energy
-                h.energy_deposited = particle.energy();
-
-                // Deposit energy and kill
-                detector.buffer_hit(h);
-                alive = false;
-                continue;
+                RngEngine::Initializer_t init;
+                init.seed  = args.seed;
+                init.track = n;
+                rng        = init;
             }
 
-            // Construct the KN interactor
-            KleinNishinaInteractor interact(
-                kn_pointers_, particle, direction, allocate_secondaries);
+            // Create helper classes
+            StackAllocator<Secondary> allocate_secondaries(
+                state.secondaries);
+            Detector     detector(params.detector, state.detector);
+            XsCalculator calc_xs(params.tables.xs, params.tables.reals);
+
+            CELER_ASSERT(state.secondaries.capacity() == args.max_steps);
+            CELER_ASSERT(state.detector.hit_buffer.capacity()
+                         == args.max_steps);
+            CELER_ASSERT(allocate_secondaries.get().size() == 0);
+            CELER_ASSERT(detector.num_hits() == 0);
 
-            // Perform interactions - emits a single particle
-            Interaction interaction = interact(rng);
-            CELER_ASSERT(interaction);
-            CELER_ASSERT(interaction.secondaries.size() == 1);
+            // Counters
+            size_type num_steps       = 0;
+            auto      remaining_steps = args.max_steps;
+            Stopwatch elapsed_time;
 
-            // Deposit energy from the secondary (all local)
+            particle = initial.particle;
+
+            while (alive && --remaining_steps > 0)
             {
-                const auto& secondary = interaction.secondaries.front();
-                h.dir                 = secondary.direction;
-                h.energy_deposited    = secondary.energy;
-                detector.buffer_hit(h);
+                // Increment alive counter
+                CELER_ASSERT(num_steps < result.alive.size());
+                result.alive[num_steps]++;
+                ++num_steps;
+                rng.next_step();
+
+                // Move to collision
+                demo_interactor::move_to_collision(
+                    particle, calc_xs, direction, &position, &time, rng);
+
+                // Hit analysis
+                Hit h;
+                h.pos    = position;
+                h.dir    = direction;
+                h.thread = ThreadId(0);
+                h.time   = time;
+
+                // Check for below energy cutoff
+                if (particle.energy() < units::MevEnergy{0.01})
+                {
+                    // Particle is below interaction energy
+                    h.energy_deposited = particle.energy();
+
+                    // Deposit energy and kill
+                    detector.buffer_hit(h);
+                    alive = false;
+                    continue;
+                }
+
+                // Construct the KN interactor
+                KleinNishinaInteractor interact(
+                    kn_pointers_, particle, direction, allocate_secondaries);
+
+                // Perform interactions - emits a single particle
+                Interaction interaction = interact(rng);
+                CELER_ASSERT(interaction);
+                CELER_ASSERT(interaction.secondaries.size() == 1);
+
+                // Deposit energy from the secondary (all local)
+                {
+                    const auto& secondary = interaction.secondaries.front();
+                    h.dir                 = secondary.direction;
+                    h.energy_deposited    = secondary.energy;
+                    detector.buffer_hit(h);
+                }
+
+                // Update the energy and direction in the state from the
+                // interaction
+                direction = interaction.direction;
+                particle.energy(interaction.energy);
             }
+            CELER_ASSERT(
+                num_steps < args.max_steps
+                    ? allocate_secondaries.get().size() == num_steps - 1
+                    : allocate_secondaries.get().size() == num_steps);
+            CELER_ASSERT(detector.num_hits() == num_steps);
 
-            // Update the energy and direction in the state from the
-            // interaction
-            direction = interaction.direction;
-            particle.energy(interaction.energy);
-        }
-        CELER_ASSERT(num_steps < args.max_steps
-                         ? allocate_secondaries.get().size() == num_steps - 1
-                         : allocate_secondaries.get().size() == num_steps);
-        CELER_ASSERT(detector.num_hits() == num_steps);
-
-        // Store transport time
-        transport_time += elapsed_time();
+            // Store transport time
+            transport_time += elapsed_time();
 
-        // Clear secondaries
-        allocate_secondaries.clear();
-        CELER_ASSERT(allocate_secondaries.get().size() == 0);
+            // Clear secondaries
+            allocate_secondaries.clear();
+            CELER_ASSERT(allocate_secondaries.get().size() == 0);
 
-        // Bin the tally results from the buffer onto the grid
-        for (auto hit_id : range(Detector::HitId{detector.num_hits()}))
-        {
-            detector.process_hit(hit_id);
+            // Bin the tally results from the buffer onto the grid
+            for (auto hit_id : range(Detector::HitId{detector.num_hits()}))
+            {
+                detector.process_hit(hit_id);
+            }
+            detector.clear_buffer();
         }
-        detector.clear_buffer();
     }
 
     // Copy integrated energy deposition
     result.edep.resize(detector_params.tally_grid.size);
     demo_interactor::finalize(params, state, make_span(result.edep));
 
+    // Combine results from all processes; the slowest one sets the timing
+    allreduce(comm_, Operation::sum, make_span(result.alive));
+    allreduce(comm_, Operation::sum, make_span(result.edep));
+    transport_time = allreduce(comm_, Operation::max, transport_time);
+
     // Store timings
     result.time.push_back(transport_time);
-    result.total_time = total_time();
+    result.total_time = allreduce(comm_, Operation::max, total_time());
 
     // Remove trailing zeros from preallocated "alive" size
     while (!result.alive.empty() && result.alive.back() == 0)
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "comm/Communicator.hh"
 #include "physics/base/ParticleParams.hh"
 #include "physics/base/ParticleInterface.hh"
 #include "physics/em/detail/KleinNishina.hh"
@@ -21,6 +22,10 @@ namespace demo_interactor
  *
  * This is an analog to the demo_interactor::KNDemoRunner for device simulation
  * but does all the transport directly on the CPU side.
+ *
+ * When constructed with an MPI communicator, the tracks are handed out in
+ * batches to whichever process is ready for more work, and the results are
+ * combined across processes so that every rank returns the full result.
  */
 class HostKNDemoRunner
 {
@@ -36,7 +41,9 @@ class HostKNDemoRunner
 
   public:
     // Construct with parameters
-    HostKNDemoRunner(constSPParticleParams particles, constSPXsGridParams xs);
+    HostKNDemoRunner(constSPParticleParams   particles,
+                     constSPXsGridParams     xs,
+                     celeritas::Communicator comm = {});
 
     // Run given number of particles
     result_type operator()(demo_interactor::KNDemoRunArgs args);
@@ -44,6 +51,7 @@ class HostKNDemoRunner
   private:
     constSPParticleParams                   pparams_;
     constSPXsGridParams                     xsparams_;
+    celeritas::Communicator                 comm_;
     celeritas::detail::KleinNishinaPointers kn_pointers_;
 };
 
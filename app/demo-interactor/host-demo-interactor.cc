@@ -55,14 +55,17 @@ std::shared_ptr<ParticleParams> load_params()
 //---------------------------------------------------------------------------//
 /*!
  * Run, launch, and output.
+ *
+ * Tracks are distributed dynamically over all processes in the communicator,
+ * and the combined result is written by the first process.
  */
-void run(std::istream& is)
+void run(std::istream& is, const Communicator& comm)
 {
     // Read input options
     auto inp = nlohmann::json::parse(is);
 
     // Construct runner
-    HostKNDemoRunner run(load_params(), demo_interactor::load_xs());
+    HostKNDemoRunner run(load_params(), demo_interactor::load_xs(), comm);
 
     // For now, only do a single run
     auto run_args = inp.at("run").get<demo_interactor::KNDemoRunArgs>();
@@ -71,6 +74,9 @@ void run(std::istream& is)
     CELER_EXPECT(run_args.max_steps > 0);
     auto result = run(run_args);
 
+    if (comm.rank() != 0)
+        return;
+
     nlohmann::json outp = {
         {"run", run_args},
         {"result", result},
@@ -94,12 +100,10 @@ void run(std::istream& is)
 int main(int argc, char* argv[])
 {
     ScopedMpiInit scoped_mpi(&argc, &argv);
-    if (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized
-        && Communicator::comm_world().size() > 1)
-    {
-        CELER_LOG(critical) << "This app cannot run in parallel";
-        return EXIT_FAILURE;
-    }
+    Communicator  comm
+        = (ScopedMpiInit::status() == ScopedMpiInit::Status::disabled
+               ? Communicator{}
+               : Communicator::comm_world());
 
     // Process input arguments
     std::vector<std::string> args(argv, argv + argc);
@@ -117,12 +121,15 @@ int main(int argc, char* argv[])
             CELER_LOG(critical) << "Failed to open '" << args[1] << "'";
             return EXIT_FAILURE;
         }
-        run(infile);
+        run(infile, comm);
     }
     else
     {
         // Read input from STDIN
-        run(std::cin);
+        CELER_VALIDATE(comm.size() == 1,
+                       << "input must be read from a file when running in "
+                          "parallel");
+        run(std::cin, comm);
     }
 
     return EXIT_SUCCESS;
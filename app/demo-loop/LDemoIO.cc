@@ -17,9 +17,12 @@ void to_json(nlohmann::json& j, const LDemoArgs& v)
     j = nlohmann::json{{"geometry_filename", v.geometry_filename},
                        {"physics_filename", v.physics_filename},
                        {"hepmc3_filename", v.hepmc3_filename},
+                       {"physics_cache_filename", v.physics_cache_filename},
                        {"seed", v.seed},
                        {"max_num_tracks", v.max_num_tracks},
-                       {"max_steps", v.max_steps}};
+                       {"max_steps", v.max_steps},
+                       {"storage_factor", v.storage_factor},
+                       {"enable_diagnostics", v.enable_diagnostics}};
 }
 
 void from_json(const nlohmann::json& j, LDemoArgs& v)
@@ -27,9 +30,36 @@ void from_json(const nlohmann::json& j, LDemoArgs& v)
     j.at("geometry_filename").get_to(v.geometry_filename);
     j.at("physics_filename").get_to(v.physics_filename);
     j.at("hepmc3_filename").get_to(v.hepmc3_filename);
+    if (j.count("physics_cache_filename"))
+    {
+        j.at("physics_cache_filename").get_to(v.physics_cache_filename);
+    }
     j.at("seed").get_to(v.seed);
     j.at("max_num_tracks").get_to(v.max_num_tracks);
     j.at("max_steps").get_to(v.max_steps);
+    if (j.count("storage_factor"))
+    {
+        j.at("storage_factor").get_to(v.storage_factor);
+    }
+    if (j.count("enable_diagnostics"))
+    {
+        j.at("enable_diagnostics").get_to(v.enable_diagnostics);
+    }
+}
+
+void to_json(nlohmann::json& j, const LDemoStageTimes& v)
+{
+    j = nlohmann::json{{"pre_step", v.pre_step},
+                       {"along_and_post_step", v.along_and_post_step},
+                       {"interact", v.interact},
+                       {"process_interactions", v.process_interactions},
+                       {"initialize_tracks", v.initialize_tracks}};
+}
+
+void to_json(nlohmann::json& j, const LDemoModelResult& v)
+{
+    j = nlohmann::json{
+        {"label", v.label}, {"time", v.time}, {"num_tracks", v.num_tracks}};
 }
 
 void to_json(nlohmann::json& j, const LDemoResult& v)
@@ -37,7 +67,11 @@ void to_json(nlohmann::json& j, const LDemoResult& v)
     j = nlohmann::json{{"time", v.time},
                        {"alive", v.alive},
                        {"edep", v.edep},
-                       {"total_time", v.total_time}};
+                       {"total_time", v.total_time},
+                       {"stage_time", v.stage_time},
+                       {"secondaries", v.secondaries},
+                       {"initializers", v.initializers},
+                       {"models", v.models}};
 }
 //!@}
 
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <string>
 #include <vector>
 #include <nlohmann/json.hpp>
 #include "base/Types.hh"
@@ -22,27 +23,64 @@ struct LDemoArgs
     using size_type = celeritas::size_type;
 
     // Problem definition
-    std::string geometry_filename; //!< Path to GDML file
-    std::string physics_filename;  //!< Path to ROOT exported Geant4 data
-    std::string hepmc3_filename;   //!< Path to Hepmc3 event data
+    std::string geometry_filename;      //!< Path to GDML file
+    std::string physics_filename;       //!< Path to exported Geant4 data
+    std::string hepmc3_filename;        //!< Path to Hepmc3 event data
+    std::string physics_cache_filename; //!< Optional physics data cache
 
     // Control
     unsigned int seed{};
     size_type    max_num_tracks{};
     size_type    max_steps{};
+    size_type    storage_factor{10};        //!< Initializers per track
+    bool         enable_diagnostics{false}; //!< Time and count each stage
 
     //! Whether the run arguments are valid
     explicit operator bool() const
     {
         return !geometry_filename.empty() && !physics_filename.empty()
                && !hepmc3_filename.empty() && max_num_tracks > 0
-               && max_steps > 0;
+               && max_steps > 0 && storage_factor > 0;
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Real time per step spent in each stage of the stepping loop.
+ */
+struct LDemoStageTimes
+{
+    std::vector<double> pre_step;             //!< Step limits
+    std::vector<double> along_and_post_step;  //!< Propagation, selection
+    std::vector<double> interact;             //!< All model interactions
+    std::vector<double> process_interactions; //!< Interaction results
+    std::vector<double> initialize_tracks;    //!< New tracks from secondaries
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulated interaction time and track count for a single model.
+ */
+struct LDemoModelResult
+{
+    using size_type = celeritas::size_type;
+
+    std::string label;          //!< Model description
+    double      time{};         //!< Real time in interact over all steps
+    size_type   num_tracks{};   //!< Tracks interacting over all steps
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Tallied result and timing from run.
+ *
+ * The per-step tallies are indexed by the step within each batch of events
+ * and combined over all batches and processes: counts and energy are summed,
+ * and times are the maximum over processes.
+ *
+ * The stage times, secondary and initializer counts, and model results are
+ * only tallied if diagnostics are enabled. Diagnostics are off by default
+ * because timing each stage and model synchronizes the device.
  */
 struct LDemoResult
 {
@@ -50,13 +88,21 @@ struct LDemoResult
 
     std::vector<double>    time;  //!< Real time per step
     std::vector<size_type> alive; //!< Num living tracks per step
-    std::vector<double>    edep;  //!< Energy deposition along the grid
+    std::vector<double>    edep;  //!< Energy deposition [MeV] per step
     double                 total_time = 0; //!< All time
+
+    // Diagnostics
+    LDemoStageTimes        stage_time;   //!< Real time per stage per step
+    std::vector<size_type> secondaries;  //!< Num secondaries per step
+    std::vector<size_type> initializers; //!< Num queued tracks per step
+    std::vector<LDemoModelResult> models; //!< Interaction tally per model
 };
 
 void to_json(nlohmann::json& j, const LDemoArgs& value);
 void from_json(const nlohmann::json& j, LDemoArgs& value);
 
+void to_json(nlohmann::json& j, const LDemoStageTimes& value);
+void to_json(nlohmann::json& j, const LDemoModelResult& value);
 void to_json(nlohmann::json& j, const LDemoResult& value);
 
 //---------------------------------------------------------------------------//
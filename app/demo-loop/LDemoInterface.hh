@@ -32,8 +32,10 @@ using celeritas::Ownership;
 struct ControlOptions
 {
     using real_type = celeritas::real_type;
+    using size_type = celeritas::size_type;
 
-    real_type secondary_stack_factor = 3; // Secondary storage per state size
+    real_type secondary_stack_factor  = 3; // Secondary storage per state size
+    size_type host_secondary_overhead = 0; // Extra storage for host threads
 
     //! True if all options are valid
     explicit operator bool() const { return secondary_stack_factor > 0; }
@@ -101,6 +103,10 @@ struct StateData
     Items<real_type>              energy_deposition;
     Items<celeritas::Interaction> interactions;
 
+    // Track slots sorted by selected model
+    Items<celeritas::size_type> model_keys;
+    Items<celeritas::ThreadId>  model_threads;
+
     //! Number of state elements
     CELER_FUNCTION celeritas::size_type size() const
     {
@@ -112,7 +118,8 @@ struct StateData
     {
         return geometry && materials && particles && physics && rng && sim
                && secondaries && !step_length.empty()
-               && !energy_deposition.empty() && !interactions.empty();
+               && !energy_deposition.empty() && !interactions.empty()
+               && !model_keys.empty() && !model_threads.empty();
     }
 
     //! Assign from another set of data
@@ -130,6 +137,8 @@ struct StateData
         step_length       = other.step_length;
         energy_deposition = other.energy_deposition;
         interactions      = other.interactions;
+        model_keys        = other.model_keys;
+        model_threads     = other.model_threads;
         return *this;
     }
 };
@@ -137,6 +146,8 @@ struct StateData
 using ParamsDeviceRef
     = ParamsData<Ownership::const_reference, MemSpace::device>;
 using StateDeviceRef = StateData<Ownership::reference, MemSpace::device>;
+using ParamsHostRef  = ParamsData<Ownership::const_reference, MemSpace::host>;
+using StateHostRef   = StateData<Ownership::reference, MemSpace::host>;
 
 #ifndef __CUDA_ARCH__
 //---------------------------------------------------------------------------//
@@ -161,11 +172,18 @@ resize(StateData<Ownership::value, M>*                               data,
 
     auto sec_size = static_cast<celeritas::size_type>(
         size * params.control.secondary_stack_factor);
+    if (M == MemSpace::host)
+    {
+        sec_size += params.control.host_secondary_overhead;
+    }
     resize(&data->secondaries, sec_size);
 
     resize(&data->step_length, size);
     resize(&data->energy_deposition, size);
+    fill(celeritas::real_type(0), &data->energy_deposition);
     resize(&data->interactions, size);
+    resize(&data->model_keys, size);
+    resize(&data->model_threads, size);
 }
 #endif
 
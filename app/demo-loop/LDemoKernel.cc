@@ -0,0 +1,198 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LDemoKernel.cc
+//---------------------------------------------------------------------------//
+#include "LDemoKernel.hh"
+
+#include <algorithm>
+#include "celeritas_config.h"
+#include "base/StackAllocator.hh"
+#include "LDemoLauncher.hh"
+
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+using namespace celeritas;
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get minimum step length from interactions.
+ *
+ * Track slots are distributed across host threads when OpenMP is enabled.
+ */
+void pre_step(const ParamsHostRef& params, const StateHostRef& states)
+{
+    PreStepLauncher<MemSpace::host> launch(params, states);
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (size_type i = 0; i < states.size(); ++i)
+    {
+        launch(ThreadId{i});
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Propogation, slowing down, and discrete model selection.
+ */
+void along_and_post_step(const ParamsHostRef& params,
+                         const StateHostRef&  states)
+{
+    AlongAndPostStepLauncher<MemSpace::host> launch(params, states);
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (size_type i = 0; i < states.size(); ++i)
+    {
+        launch(ThreadId{i});
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Postprocessing of secondaries and interaction results.
+ */
+void process_interactions(const ParamsHostRef& params,
+                          const StateHostRef&  states)
+{
+    ProcessInteractionsLauncher<MemSpace::host> launch(params, states);
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (size_type i = 0; i < states.size(); ++i)
+    {
+        launch(ThreadId{i});
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sort track slots by the model selected for the discrete interaction.
+ *
+ * The track slots that selected model \c m are stored in
+ * \c states.model_threads between the returned offsets \c m and \c m+1.
+ *
+ * This is a blocked counting sort: each host thread histograms the keys of a
+ * contiguous block of track slots, the histograms are scanned serially to get
+ * the output position of each (block, model) pair, and each thread then
+ * scatters its block. The slots for each model remain in increasing order
+ * regardless of the number of threads.
+ */
+std::vector<size_type>
+sort_by_model(const StateHostRef& states, size_type num_models)
+{
+    const size_type size = states.size();
+
+    ModelKeyLauncher<MemSpace::host> calc_key(states, num_models);
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (size_type i = 0; i < size; ++i)
+    {
+        calc_key(ThreadId{i});
+    }
+
+#if CELERITAS_USE_OPENMP
+    size_type num_blocks = omp_get_max_threads();
+#else
+    size_type num_blocks = 1;
+#endif
+    num_blocks = std::max<size_type>(1, std::min(num_blocks, size));
+    auto block_begin = [size, num_blocks](size_type b) {
+        return static_cast<size_type>(static_cast<ull_int>(size) * b
+                                      / num_blocks);
+    };
+
+    // Count the number of tracks per model in each block (the last column is
+    // for tracks that aren't interacting)
+    const size_type        num_keys = num_models + 1;
+    std::vector<size_type> counts(num_blocks * num_keys, 0);
+    const auto&            keys = states.model_keys;
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (size_type b = 0; b < num_blocks; ++b)
+    {
+        size_type* block_counts = counts.data() + b * num_keys;
+        for (size_type i = block_begin(b), end = block_begin(b + 1); i != end;
+             ++i)
+        {
+            ++block_counts[keys[ThreadId{i}]];
+        }
+    }
+
+    // Convert the counts to the starting output index of each block and model
+    std::vector<size_type> result(num_keys);
+    size_type              running = 0;
+    for (size_type m = 0; m < num_keys; ++m)
+    {
+        result[m] = running;
+        for (size_type b = 0; b < num_blocks; ++b)
+        {
+            size_type count          = counts[b * num_keys + m];
+            counts[b * num_keys + m] = running;
+            running += count;
+        }
+    }
+    CELER_ASSERT(running == size);
+
+    // Scatter the track slots of the interacting tracks
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (size_type b = 0; b < num_blocks; ++b)
+    {
+        size_type* block_offsets = counts.data() + b * num_keys;
+        for (size_type i = block_begin(b), end = block_begin(b + 1); i != end;
+             ++i)
+        {
+            size_type key = keys[ThreadId{i}];
+            if (key < num_models)
+            {
+                states.model_threads[ThreadId{block_offsets[key]++}]
+                    = ThreadId{i};
+            }
+        }
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Deallocate all secondaries once track initializers have been created.
+ */
+void clear_secondaries(const StateHostRef& states)
+{
+    StackAllocator<Secondary> allocate(states.secondaries);
+    allocate.clear();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sum the energy deposited in all track slots and reset the accumulators.
+ *
+ * The slots are summed serially so that the result does not depend on the
+ * number of host threads.
+ */
+real_type reduce_energy_deposition(const StateHostRef& states)
+{
+    real_type result = 0;
+    for (size_type i = 0; i < states.size(); ++i)
+    {
+        real_type& edep = states.energy_deposition[ThreadId{i}];
+        result += edep;
+        edep = 0;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
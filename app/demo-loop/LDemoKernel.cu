@@ -7,11 +7,16 @@
 //---------------------------------------------------------------------------//
 #include "LDemoKernel.hh"
 
+#include <thrust/binary_search.h>
+#include <thrust/device_ptr.h>
+#include <thrust/device_vector.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
 #include "base/KernelParamCalculator.cuda.hh"
-#include "physics/base/CutoffView.hh"
-#include "random/RngEngine.hh"
-#include "sim/SimTrackView.hh"
-#include "KernelUtils.hh"
+#include "base/StackAllocator.hh"
+#include "LDemoLauncher.hh"
 
 using namespace celeritas;
 
@@ -32,19 +37,8 @@ pre_step_kernel(ParamsDeviceRef const params, StateDeviceRef const states)
     if (tid.get() >= states.size())
         return;
 
-    GeoTrackView      geo(params.geometry, states.geometry, tid);
-    GeoMaterialView   geo_mat(params.geo_mats, geo.volume_id());
-    MaterialTrackView mat(params.materials, states.materials, tid);
-    ParticleTrackView particle(params.particles, states.particles, tid);
-    PhysicsTrackView  phys(params.physics,
-                          states.physics,
-                          particle.particle_id(),
-                          geo_mat.material_id(),
-                          tid);
-    RngEngine         rng(states.rng, ThreadId(tid));
-
-    // Sample mfp and calculate minimum step (interaction or step-limited)
-    demo_loop::calc_step_limits(geo, geo_mat, mat, particle, phys, rng);
+    PreStepLauncher<MemSpace::device> launch(params, states);
+    launch(tid);
 }
 
 //---------------------------------------------------------------------------//
@@ -59,25 +53,8 @@ __global__ void along_and_post_step_kernel(ParamsDeviceRef const params,
     if (tid.get() >= states.size())
         return;
 
-    GeoTrackView      geo(params.geometry, states.geometry, tid);
-    GeoMaterialView   geo_mat(params.geo_mats, geo.volume_id());
-    ParticleTrackView particle(params.particles, states.particles, tid);
-    PhysicsTrackView  phys(params.physics,
-                          states.physics,
-                          particle.particle_id(),
-                          geo_mat.material_id(),
-                          tid);
-    RngEngine         rng(states.rng, ThreadId(tid));
-
-    // Move particle and determine the actual distance traveled
-    real_type step = demo_loop::propagate(geo, phys);
-
-    // Calculate energy loss over the step length
-    auto eloss = calc_energy_loss(particle, phys, step);
-    states.energy_deposition[tid] += eloss.value();
-
-    // Select the model for the discrete process
-    demo_loop::select_discrete_model(particle, phys, rng, step, eloss);
+    AlongAndPostStepLauncher<MemSpace::device> launch(params, states);
+    launch(tid);
 }
 
 //---------------------------------------------------------------------------//
@@ -91,37 +68,38 @@ __global__ void process_interactions_kernel(ParamsDeviceRef const params,
     if (tid.get() >= states.size())
         return;
 
-    GeoTrackView      geo(params.geometry, states.geometry, tid);
-    MaterialTrackView mat(params.materials, states.materials, tid);
-    ParticleTrackView particle(params.particles, states.particles, tid);
-    SimTrackView      sim(states.sim, tid);
-    CutoffView        cutoffs(params.cutoffs, mat.material_id());
-
-    // Update the track state from the interaction
-    const Interaction& result = states.interactions[tid];
-    if (action_killed(result.action))
-    {
-        sim.alive(false);
-    }
-    else if (!action_unchanged(result.action))
-    {
-        particle.energy(result.energy);
-        geo.set_dir(result.direction);
-    }
-
-    // Deposit energy from interaction
-    states.energy_deposition[tid] += result.energy_deposition.value();
-
-    // Kill secondaries with energy below the production threshold and deposit
-    // their energy
-    for (auto& secondary : result.secondaries)
-    {
-        if (secondary.energy < cutoffs.energy(secondary.particle_id))
-        {
-            states.energy_deposition[tid] += secondary.energy.value();
-            secondary = {};
-        }
-    }
+    ProcessInteractionsLauncher<MemSpace::device> launch(params, states);
+    launch(tid);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the model sort key and reset the thread ID of each track slot.
+ */
+__global__ void
+sort_by_model_kernel(StateDeviceRef const states, size_type num_models)
+{
+    auto tid = celeritas::KernelParamCalculator::thread_id();
+    if (tid.get() >= states.size())
+        return;
+
+    ModelKeyLauncher<MemSpace::device> launch(states, num_models);
+    launch(tid);
+    states.model_threads[tid] = tid;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Clear secondaries.
+ */
+__global__ void clear_secondaries_kernel(StateDeviceRef const states)
+{
+    auto tid = celeritas::KernelParamCalculator::thread_id();
+    if (tid.get() != 0)
+        return;
+
+    StackAllocator<Secondary> allocate(states.secondaries);
+    allocate.clear();
 }
 
 } // namespace
@@ -169,5 +147,64 @@ void process_interactions(const ParamsDeviceRef& params,
     CDL_LAUNCH_KERNEL(process_interactions, states.size(), params, states);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Sort track slots by the model selected for the discrete interaction.
+ *
+ * The track slots that selected model \c m are stored in
+ * \c states.model_threads between the returned offsets \c m and \c m+1. The
+ * sort is stable so that the slots for each model remain in increasing order.
+ */
+std::vector<size_type>
+sort_by_model(const StateDeviceRef& states, size_type num_models)
+{
+    CDL_LAUNCH_KERNEL(sort_by_model, states.size(), states, num_models);
+
+    auto keys = thrust::device_pointer_cast(
+        states.model_keys[AllItems<size_type, MemSpace::device>{}].data());
+    auto threads = thrust::device_pointer_cast(
+        states.model_threads[AllItems<ThreadId, MemSpace::device>{}].data());
+    thrust::stable_sort_by_key(keys, keys + states.size(), threads);
+    CELER_CUDA_CHECK_ERROR();
+
+    // Find the start of each model's range of track slots
+    thrust::device_vector<size_type> offsets(num_models + 1);
+    thrust::lower_bound(keys,
+                        keys + states.size(),
+                        thrust::counting_iterator<size_type>(0),
+                        thrust::counting_iterator<size_type>(num_models + 1),
+                        offsets.begin());
+    CELER_CUDA_CHECK_ERROR();
+
+    std::vector<size_type> result(offsets.size());
+    thrust::copy(offsets.begin(), offsets.end(), result.begin());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Deallocate all secondaries once track initializers have been created.
+ */
+void clear_secondaries(const StateDeviceRef& states)
+{
+    CDL_LAUNCH_KERNEL(clear_secondaries, 1, states);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sum the energy deposited in all track slots and reset the accumulators.
+ */
+real_type reduce_energy_deposition(const StateDeviceRef& states)
+{
+    auto edep = thrust::device_pointer_cast(
+        states.energy_deposition[AllItems<real_type, MemSpace::device>{}]
+            .data());
+    real_type result
+        = thrust::reduce(edep, edep + states.size(), real_type(0));
+    thrust::fill(edep, edep + states.size(), real_type(0));
+    CELER_CUDA_CHECK_ERROR();
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace demo_loop
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
 #include "base/Assert.hh"
 #include "LDemoInterface.hh"
 
@@ -16,6 +17,18 @@ namespace demo_loop
 void pre_step(const ParamsDeviceRef&, const StateDeviceRef&);
 void along_and_post_step(const ParamsDeviceRef&, const StateDeviceRef&);
 void process_interactions(const ParamsDeviceRef&, const StateDeviceRef&);
+std::vector<celeritas::size_type>
+sort_by_model(const StateDeviceRef&, celeritas::size_type num_models);
+void clear_secondaries(const StateDeviceRef&);
+celeritas::real_type reduce_energy_deposition(const StateDeviceRef&);
+
+void pre_step(const ParamsHostRef&, const StateHostRef&);
+void along_and_post_step(const ParamsHostRef&, const StateHostRef&);
+void process_interactions(const ParamsHostRef&, const StateHostRef&);
+std::vector<celeritas::size_type>
+sort_by_model(const StateHostRef&, celeritas::size_type num_models);
+void clear_secondaries(const StateHostRef&);
+celeritas::real_type reduce_energy_deposition(const StateHostRef&);
 
 //---------------------------------------------------------------------------//
 #if !CELERITAS_USE_CUDA
@@ -33,6 +46,22 @@ inline void process_interactions(const ParamsDeviceRef&, const StateDeviceRef&)
 {
     CELER_NOT_CONFIGURED("CUDA");
 }
+
+inline std::vector<celeritas::size_type>
+sort_by_model(const StateDeviceRef&, celeritas::size_type)
+{
+    CELER_NOT_CONFIGURED("CUDA");
+}
+
+inline void clear_secondaries(const StateDeviceRef&)
+{
+    CELER_NOT_CONFIGURED("CUDA");
+}
+
+inline celeritas::real_type reduce_energy_deposition(const StateDeviceRef&)
+{
+    CELER_NOT_CONFIGURED("CUDA");
+}
 #endif
 //---------------------------------------------------------------------------//
 } // namespace demo_loop
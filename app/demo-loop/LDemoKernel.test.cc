@@ -0,0 +1,177 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LDemoKernel.test.cc
+//---------------------------------------------------------------------------//
+#include "LDemoKernel.hh"
+
+#include <random>
+#include "celeritas_config.h"
+#include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+using namespace celeritas;
+using demo_loop::StateHostRef;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class SortByModelTest : public celeritas::Test
+{
+  protected:
+    using StateHostVal
+        = demo_loop::StateData<Ownership::value, MemSpace::host>;
+
+    //! Allocate only the states used for sorting
+    void build(size_type size)
+    {
+        states = {};
+        make_builder(&states.particles.state).resize(size);
+        make_builder(&states.sim.state).resize(size);
+        make_builder(&states.physics.state).resize(size);
+        make_builder(&states.model_keys).resize(size);
+        make_builder(&states.model_threads).resize(size);
+
+        ref               = {};
+        ref.particles     = states.particles;
+        ref.sim           = states.sim;
+        ref.physics       = states.physics;
+        ref.model_keys    = states.model_keys;
+        ref.model_threads = states.model_threads;
+    }
+
+    //! Set whether a track is alive and which model it selected
+    void set_track(size_type i, bool alive, ModelId model)
+    {
+        states.sim.state[ThreadId{i}].alive        = alive;
+        states.physics.state[ThreadId{i}].model_id = model;
+    }
+
+    //! Sorted thread IDs of a single model
+    std::vector<ThreadId::size_type>
+    model_threads(const std::vector<size_type>& offsets, size_type model)
+    {
+        std::vector<ThreadId::size_type> result;
+        for (auto i : range(offsets[model], offsets[model + 1]))
+        {
+            result.push_back(ref.model_threads[ThreadId{i}].get());
+        }
+        return result;
+    }
+
+    //! Set the number of host threads
+    void set_num_threads(CELER_MAYBE_UNUSED int num_threads)
+    {
+#if CELERITAS_USE_OPENMP
+        omp_set_num_threads(num_threads);
+#endif
+    }
+
+    void SetUp() override
+    {
+#if CELERITAS_USE_OPENMP
+        orig_num_threads_ = omp_get_max_threads();
+#endif
+    }
+
+    void TearDown() override { this->set_num_threads(orig_num_threads_); }
+
+    StateHostVal states;
+    StateHostRef ref;
+
+  private:
+    int orig_num_threads_ = 1;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(SortByModelTest, simple)
+{
+    const size_type num_models = 3;
+    this->build(8);
+    this->set_track(0, true, ModelId{2});
+    this->set_track(1, true, ModelId{0});
+    this->set_track(2, false, ModelId{0});
+    this->set_track(3, true, ModelId{});
+    this->set_track(4, true, ModelId{2});
+    this->set_track(5, true, ModelId{0});
+    this->set_track(6, false, ModelId{});
+    this->set_track(7, true, ModelId{2});
+
+    for (int num_threads : {1, 3})
+    {
+        this->set_num_threads(num_threads);
+        auto offsets = demo_loop::sort_by_model(ref, num_models);
+
+        // The last offset is the number of interacting tracks
+        const size_type expected_offsets[] = {0, 2, 2, 5};
+        EXPECT_VEC_EQ(expected_offsets, offsets);
+
+        const ThreadId::size_type expected_model0[] = {1, 5};
+        EXPECT_VEC_EQ(expected_model0, this->model_threads(offsets, 0));
+        EXPECT_TRUE(this->model_threads(offsets, 1).empty());
+        const ThreadId::size_type expected_model2[] = {0, 4, 7};
+        EXPECT_VEC_EQ(expected_model2, this->model_threads(offsets, 2));
+
+        // Dead and non-interacting tracks get the largest key
+        const size_type expected_keys[] = {2, 0, 3, 3, 2, 0, 3, 2};
+        EXPECT_VEC_EQ(expected_keys,
+                      states.model_keys[AllItems<size_type>{}]);
+    }
+}
+
+TEST_F(SortByModelTest, random)
+{
+    const size_type num_models = 5;
+
+    std::mt19937                       rng;
+    std::bernoulli_distribution        sample_alive(0.8);
+    std::uniform_int_distribution<int> sample_model(-1, num_models - 1);
+
+    for (size_type size : {1, 7, 64, 1001})
+    {
+        this->build(size);
+
+        // Expected stable subset of track slots for each model
+        std::vector<std::vector<ThreadId::size_type>> expected(num_models);
+        for (auto i : range(size))
+        {
+            bool    alive = sample_alive(rng);
+            int     m     = sample_model(rng);
+            ModelId model = (m >= 0 ? ModelId(m) : ModelId{});
+            this->set_track(i, alive, model);
+            if (alive && model)
+            {
+                expected[model.get()].push_back(i);
+            }
+        }
+
+        for (int num_threads : {1, 2, 3, 8})
+        {
+            this->set_num_threads(num_threads);
+            auto offsets = demo_loop::sort_by_model(ref, num_models);
+            ASSERT_EQ(num_models + 1, offsets.size());
+
+            size_type expected_offset = 0;
+            for (auto m : range(num_models))
+            {
+                EXPECT_EQ(expected_offset, offsets[m]);
+                EXPECT_VEC_EQ(expected[m], this->model_threads(offsets, m))
+                    << "model " << m << " of " << size << " tracks with "
+                    << num_threads << " threads";
+                expected_offset += expected[m].size();
+            }
+            EXPECT_EQ(expected_offset, offsets.back());
+        }
+    }
+}
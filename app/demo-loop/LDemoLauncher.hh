@@ -0,0 +1,295 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LDemoLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "physics/base/CutoffView.hh"
+#include "random/RngEngine.hh"
+#include "sim/SimTrackView.hh"
+#include "KernelUtils.hh"
+#include "LDemoInterface.hh"
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample mean free path and calculate physics step limits.
+ *
+ * Each living track first advances its random stream to the new step.
+ *
+ * The launchers apply one stage of the stepping loop to a single track slot.
+ * They are shared between the CUDA kernels and the host loops.
+ */
+template<MemSpace M>
+class PreStepLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef = ParamsData<Ownership::const_reference, M>;
+    using StateRef  = StateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    // Construct with shared and state data
+    CELER_FUNCTION PreStepLauncher(const ParamsRef& params,
+                                   const StateRef&  states)
+        : params_(params), states_(states)
+    {
+    }
+
+    // Apply to a single track
+    inline CELER_FUNCTION void operator()(ThreadId tid) const;
+
+  private:
+    const ParamsRef& params_;
+    const StateRef&  states_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Propagate and process physical changes to the track along the step and
+ * select the process/model for discrete interaction.
+ *
+ * Tracks that leave the world or lose all their energy along the step are
+ * killed before a model is selected.
+ */
+template<MemSpace M>
+class AlongAndPostStepLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef = ParamsData<Ownership::const_reference, M>;
+    using StateRef  = StateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    // Construct with shared and state data
+    CELER_FUNCTION AlongAndPostStepLauncher(const ParamsRef& params,
+                                            const StateRef&  states)
+        : params_(params), states_(states)
+    {
+    }
+
+    // Apply to a single track
+    inline CELER_FUNCTION void operator()(ThreadId tid) const;
+
+  private:
+    const ParamsRef& params_;
+    const StateRef&  states_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Postprocessing of secondaries and interaction results.
+ */
+template<MemSpace M>
+class ProcessInteractionsLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef = ParamsData<Ownership::const_reference, M>;
+    using StateRef  = StateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    // Construct with shared and state data
+    CELER_FUNCTION ProcessInteractionsLauncher(const ParamsRef& params,
+                                               const StateRef&  states)
+        : params_(params), states_(states)
+    {
+    }
+
+    // Apply to a single track
+    inline CELER_FUNCTION void operator()(ThreadId tid) const;
+
+  private:
+    const ParamsRef& params_;
+    const StateRef&  states_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the key used to sort track slots by their selected model.
+ *
+ * The key is the index of the model selected for the discrete interaction, or
+ * the number of models if the track is dead or is not interacting this step.
+ */
+template<MemSpace M>
+class ModelKeyLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using StateRef = StateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    // Construct with state data and the total number of models
+    CELER_FUNCTION ModelKeyLauncher(const StateRef& states, size_type num_models)
+        : states_(states), num_models_(num_models)
+    {
+    }
+
+    // Apply to a single track
+    inline CELER_FUNCTION void operator()(ThreadId tid) const;
+
+  private:
+    const StateRef& states_;
+    size_type       num_models_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void PreStepLauncher<M>::operator()(ThreadId tid) const
+{
+    SimTrackView sim(states_.sim, tid);
+    if (!sim.alive())
+    {
+        // Clear the result of the previous occupant of an empty slot so that
+        // its secondaries aren't counted again
+        states_.interactions[tid] = Interaction::from_absorption();
+        return;
+    }
+
+    GeoTrackView      geo(params_.geometry, states_.geometry, tid);
+    GeoMaterialView   geo_mat(params_.geo_mats, geo.volume_id());
+    MaterialTrackView mat(params_.materials, states_.materials, tid);
+    ParticleTrackView particle(params_.particles, states_.particles, tid);
+    PhysicsTrackView  phys(params_.physics,
+                          states_.physics,
+                          particle.particle_id(),
+                          geo_mat.material_id(),
+                          tid);
+    RngEngine         rng(states_.rng, tid);
+    rng.next_step();
+
+    // Update the material of new tracks and tracks that changed volume
+    mat = {geo_mat.material_id()};
+
+    // Sample mfp and calculate minimum step (interaction or step-limited)
+    demo_loop::calc_step_limits(geo, geo_mat, mat, particle, phys, rng);
+}
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void AlongAndPostStepLauncher<M>::operator()(ThreadId tid) const
+{
+    SimTrackView sim(states_.sim, tid);
+    if (!sim.alive())
+        return;
+
+    GeoTrackView      geo(params_.geometry, states_.geometry, tid);
+    GeoMaterialView   geo_mat(params_.geo_mats, geo.volume_id());
+    ParticleTrackView particle(params_.particles, states_.particles, tid);
+    PhysicsTrackView  phys(params_.physics,
+                          states_.physics,
+                          particle.particle_id(),
+                          geo_mat.material_id(),
+                          tid);
+    RngEngine         rng(states_.rng, tid);
+
+    // Move particle and determine the actual distance traveled
+    real_type step = demo_loop::propagate(geo, phys);
+    if (geo.is_outside())
+    {
+        // Kill the track when it leaves the world
+        sim.alive(false);
+        phys.model_id({});
+        states_.interactions[tid] = Interaction::from_absorption();
+        return;
+    }
+
+    // Calculate energy loss over the step length
+    auto eloss = calc_energy_loss(particle, phys, step);
+    states_.energy_deposition[tid] += eloss.value();
+    if (eloss == particle.energy())
+    {
+        // Kill the track after depositing all of its energy
+        // TODO: stopped positrons should annihilate at rest
+        particle.energy(zero_quantity());
+        sim.alive(false);
+        phys.model_id({});
+        states_.interactions[tid] = Interaction::from_absorption();
+        return;
+    }
+
+    // Select the model for the discrete process
+    demo_loop::select_discrete_model(particle, phys, rng, step, eloss);
+
+    // Tracks that don't interact keep their state and have no secondaries
+    states_.interactions[tid]
+        = Interaction::from_unchanged(particle.energy(), geo.dir());
+}
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void
+ProcessInteractionsLauncher<M>::operator()(ThreadId tid) const
+{
+    SimTrackView sim(states_.sim, tid);
+    if (!sim.alive())
+        return;
+
+    GeoTrackView      geo(params_.geometry, states_.geometry, tid);
+    MaterialTrackView mat(params_.materials, states_.materials, tid);
+    ParticleTrackView particle(params_.particles, states_.particles, tid);
+    CutoffView        cutoffs(params_.cutoffs, mat.material_id());
+
+    // Update the track state from the interaction
+    const Interaction& result = states_.interactions[tid];
+    if (action_killed(result.action))
+    {
+        sim.alive(false);
+    }
+    else if (!action_unchanged(result.action))
+    {
+        particle.energy(result.energy);
+        geo.set_dir(result.direction);
+    }
+
+    // Deposit energy from interaction
+    states_.energy_deposition[tid] += result.energy_deposition.value();
+
+    // Kill secondaries with energy below the production threshold and deposit
+    // their energy
+    for (auto& secondary : result.secondaries)
+    {
+        if (secondary.energy < cutoffs.energy(secondary.particle_id))
+        {
+            states_.energy_deposition[tid] += secondary.energy.value();
+            secondary = {};
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void ModelKeyLauncher<M>::operator()(ThreadId tid) const
+{
+    size_type key = num_models_;
+
+    SimTrackView sim(states_.sim, tid);
+    if (sim.alive())
+    {
+        ModelId model = states_.physics.state[tid].model_id;
+        if (model)
+        {
+            CELER_ASSERT(model.get() < num_models_);
+            key = model.get();
+        }
+    }
+    states_.model_keys[tid] = key;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
@@ -7,7 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "LDemoParams.hh"
 
+#include <fstream>
+#include "base/CollectionCache.hh"
 #include "comm/Logger.hh"
+#include "io/BinaryImporter.hh"
 #include "io/RootImporter.hh"
 #include "io/ImportData.hh"
 #include "io/EventReader.hh"
@@ -23,14 +26,49 @@ using namespace celeritas;
 
 namespace demo_loop
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Hash the contents of the physics input file to identify cached data.
+ */
+std::string hash_file(const std::string& filename)
+{
+    std::ifstream infile(filename, std::ios::in | std::ios::binary);
+    CELER_VALIDATE(infile, << "failed to open '" << filename << "'");
+
+    HashBuilder hash;
+    char        buffer[4096];
+    while (infile.read(buffer, sizeof(buffer)) || infile.gcount() > 0)
+    {
+        hash(buffer, static_cast<std::size_t>(infile.gcount()));
+    }
+    return std::to_string(hash.value());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
 //---------------------------------------------------------------------------//
 LDemoParams load_params(const LDemoArgs& args)
 {
     CELER_LOG(status) << "Loading input files";
     LDemoParams result;
 
-    // Load data from ROOT file
-    const auto data = RootImporter(args.physics_filename.c_str())();
+    // Load data from a ROOT file, or map a binary file so that the physics
+    // tables can be built without copying the vectors
+    ImportData                            data;
+    std::shared_ptr<const BinaryImporter> binary;
+    if (is_root_filename(args.physics_filename))
+    {
+        data = RootImporter(args.physics_filename.c_str())();
+    }
+    else
+    {
+        binary = std::make_shared<BinaryImporter>(
+            args.physics_filename.c_str());
+        data = binary->metadata();
+    }
 
     // Load geometry
     {
@@ -80,10 +118,17 @@ LDemoParams load_params(const LDemoArgs& args)
         PhysicsParams::Input input;
         input.particles = result.particles;
         input.materials = result.materials;
+        if (!args.physics_cache_filename.empty())
+        {
+            input.cache_filename = args.physics_cache_filename;
+            input.cache_key      = hash_file(args.physics_filename);
+        }
 
         // TODO: add remaining processes
         auto process_data
-            = std::make_shared<ImportedProcesses>(std::move(data.processes));
+            = binary ? std::make_shared<ImportedProcesses>(binary)
+                     : std::make_shared<ImportedProcesses>(
+                         std::move(data.processes));
         input.processes.push_back(
             std::make_shared<ComptonProcess>(result.particles, process_data));
         input.processes.push_back(std::make_shared<EIonizationProcess>(
@@ -92,12 +137,11 @@ LDemoParams load_params(const LDemoArgs& args)
         result.physics = std::make_shared<PhysicsParams>(std::move(input));
     }
 
-    // Load track initialization data
+    // Load primaries from all events: each process reads the whole file and
+    // transports only the events it claims
     {
         EventReader read_event(args.hepmc3_filename.c_str(), result.particles);
-        const auto  primaries = read_event();
-
-        // TODO: Initialize TrackInitParams
+        result.primaries = read_event();
     }
 
     // Construct RNG params
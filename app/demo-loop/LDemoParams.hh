@@ -7,10 +7,12 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
 #include "geometry/GeoMaterialParams.hh"
 #include "geometry/GeoParams.hh"
 #include "physics/base/CutoffParams.hh"
 #include "physics/base/ParticleParams.hh"
+#include "physics/base/Primary.hh"
 #include "physics/base/PhysicsParams.hh"
 #include "physics/material/MaterialParams.hh"
 #include "random/RngParams.hh"
@@ -38,11 +40,14 @@ struct LDemoParams
     // Random
     std::shared_ptr<const celeritas::RngParams> rng;
 
+    // Primaries from all events, ordered by event ID
+    std::vector<celeritas::Primary> primaries;
+
     //! True if all params are assigned
     explicit operator bool() const
     {
         return geometry && materials && geo_mats && particles && cutoffs
-               && physics && rng;
+               && physics && rng && !primaries.empty();
     }
 };
 
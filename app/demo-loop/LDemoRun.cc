@@ -7,13 +7,27 @@
 //---------------------------------------------------------------------------//
 #include "LDemoRun.hh"
 
+#include <algorithm>
+#include "celeritas_config.h"
 #include "base/CollectionStateStore.hh"
+#include "base/Range.hh"
+#include "base/StackAllocator.hh"
+#include "base/Stopwatch.hh"
+#include "comm/EventDistributor.hh"
 #include "comm/Logger.hh"
+#include "comm/Operations.hh"
+#include "physics/base/Model.hh"
 #include "physics/base/ModelInterface.hh"
+#include "sim/TrackInitParams.hh"
+#include "sim/TrackInitUtils.hh"
 #include "LDemoParams.hh"
 #include "LDemoInterface.hh"
 #include "LDemoKernel.hh"
 
+#if CELERITAS_USE_CUDA
+#    include <cuda_runtime_api.h>
+#endif
+
 using namespace celeritas;
 
 namespace demo_loop
@@ -65,20 +79,86 @@ build_params_refs(const LDemoParams& p)
     ref.particles = get_pointers<M>(*p.particles);
     ref.physics   = get_pointers<M>(*p.physics);
     ref.rng       = get_pointers<M>(*p.rng);
+
+    // Leave room for secondary slots left unused by host interactions
+    ref.control.host_secondary_overhead
+        = host_secondary_overhead(p.physics->num_models());
     CELER_ENSURE(ref);
     return ref;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for all launched kernels to complete.
+ */
+template<MemSpace M>
+void synchronize();
+
+template<>
+void synchronize<MemSpace::host>()
+{
+}
+
+template<>
+void synchronize<MemSpace::device>()
+{
+#if CELERITAS_USE_CUDA
+    CELER_CUDA_CALL(cudaDeviceSynchronize());
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Optionally time a stage of the stepping loop.
+ *
+ * If timing is enabled, the device is synchronized after the stage so that
+ * the elapsed time includes the kernel execution. Otherwise the stage is
+ * launched without any synchronization and the returned time is zero.
+ */
+template<MemSpace M>
+class StageTimer
+{
+  public:
+    //! Construct with whether timing is enabled
+    explicit StageTimer(bool enabled) : enabled_(enabled) {}
+
+    //! Whether timing is enabled
+    explicit operator bool() const { return enabled_; }
+
+    //! Launch the stage and return the elapsed time [s]
+    template<class F>
+    double operator()(F&& launch) const
+    {
+        if (!enabled_)
+        {
+            launch();
+            return 0;
+        }
+        Stopwatch get_time;
+        launch();
+        synchronize<M>();
+        return get_time();
+    }
+
+  private:
+    bool enabled_;
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Launch interaction kernels for all applicable models.
  *
- * For now, just launch *all* the models.
+ * The track slots are first sorted by the selected model so that each model
+ * is launched only over the compact subset of tracks that will interact with
+ * it. Models that weren't selected by any track are skipped. If timing is
+ * enabled, the elapsed time and number of tracks are tallied for each model.
  */
 template<MemSpace M>
 void launch_models(LDemoParams const& host_params,
                    ParamsData<Ownership::const_reference, M> const& params,
-                   StateData<Ownership::reference, M> const&        states)
+                   StateData<Ownership::reference, M> const&        states,
+                   const StageTimer<M>&                             time_stage,
+                   std::vector<LDemoModelResult>*                   models)
 {
     // TODO: these *should* be able to be persistent across steps, rather than
     // recreated at every step.
@@ -86,6 +166,7 @@ void launch_models(LDemoParams const& host_params,
     refs.params.particle     = params.particles;
     refs.params.material     = params.materials;
     refs.params.physics      = params.physics;
+    refs.params.cutoffs      = params.cutoffs;
     refs.states.particle     = states.particles;
     refs.states.material     = states.materials;
     refs.states.physics      = states.physics;
@@ -95,69 +176,384 @@ void launch_models(LDemoParams const& host_params,
     refs.states.interactions = states.interactions;
     CELER_ASSERT(refs);
 
-    // Loop over physics models IDs and invoke `interact`
-    for (auto model_id : range(ModelId{host_params.physics->num_models()}))
+    // Group the track slots by model
+    const auto& physics = *host_params.physics;
+    std::vector<size_type> offsets
+        = demo_loop::sort_by_model(states, physics.num_models());
+    CELER_ASSERT(offsets.size() == physics.num_models() + 1);
+    Span<const ThreadId> sorted_threads
+        = states.model_threads[AllItems<ThreadId, M>{}];
+
+    // Loop over physics models IDs and invoke `interact` on their tracks
+    for (auto model_id : range(ModelId{physics.num_models()}))
     {
-        const Model& model = host_params.physics->model(model_id);
-        model.interact(refs);
+        size_type begin = offsets[model_id.get()];
+        size_type end   = offsets[model_id.get() + 1];
+        if (begin == end)
+            continue;
+
+        refs.thread_ids = sorted_threads.subspan(begin, end - begin);
+        double time     = time_stage(
+            [&] { physics.model(model_id).interact(refs); });
+        if (time_stage)
+        {
+            CELER_ASSERT(models && model_id.get() < models->size());
+            LDemoModelResult& tally = (*models)[model_id.get()];
+            tally.time += time;
+            tally.num_tracks += end - begin;
+        }
     }
 }
 
 //---------------------------------------------------------------------------//
-} // namespace
+/*!
+ * Create an empty interaction tally for each model.
+ */
+std::vector<LDemoModelResult> build_model_results(const PhysicsParams& physics)
+{
+    std::vector<LDemoModelResult> result(physics.num_models());
+    for (auto model_id : range(ModelId{physics.num_models()}))
+    {
+        result[model_id.get()].label = physics.model(model_id).label();
+    }
+    return result;
+}
 
 //---------------------------------------------------------------------------//
-LDemoResult run_gpu(LDemoArgs args)
+/*!
+ * Get the number of secondaries allocated this step.
+ */
+size_type num_secondaries(const StateHostRef& states)
 {
-    CELER_EXPECT(args);
+    return StackAllocator<Secondary>(states.secondaries).size();
+}
 
-    // Load all the problem data
-    LDemoParams params = load_params(args);
+size_type num_secondaries(CELER_MAYBE_UNUSED const StateDeviceRef& states)
+{
+    size_type result = 0;
+#if CELERITAS_USE_CUDA
+    using AllSizes = AllItems<size_type, MemSpace::device>;
+    auto size      = states.secondaries.size[AllSizes{}];
+    CELER_ASSERT(size.size() == 1);
+    CELER_CUDA_CALL(cudaMemcpy(
+        &result, size.data(), sizeof(size_type), cudaMemcpyDeviceToHost));
+#else
+    CELER_NOT_CONFIGURED("CUDA");
+#endif
+    return result;
+}
 
-    // Create param interfaces (TODO unify with sim/TrackInterface)
-    ParamsDeviceRef params_ref = build_params_refs<MemSpace::device>(params);
+//---------------------------------------------------------------------------//
+/*!
+ * Add a value to the tally for the given step, extending it if needed.
+ *
+ * Steps are counted from the start of each batch of events, so the tallies
+ * from all batches (and all processes) line up.
+ */
+template<class T>
+void tally_step(size_type step, T value, std::vector<T>* tally)
+{
+    CELER_EXPECT(tally);
+    if (step >= tally->size())
+    {
+        tally->resize(step + 1);
+    }
+    (*tally)[step] += value;
+}
 
-    // Create states (TODO state store?)
-    StateData<Ownership::value, MemSpace::device> state_storage;
-    // TODO: allocate correct size from LDemoParams
-    resize(&state_storage,
-           build_params_refs<MemSpace::host>(params),
-           args.max_num_tracks);
-    StateDeviceRef states_ref = make_ref(state_storage);
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the per-stage diagnostics for a single step.
+ */
+struct StepDiagnostics
+{
+    double    pre_step{};
+    double    along_and_post_step{};
+    double    interact{};
+    double    process_interactions{};
+    double    initialize_tracks{};
+    size_type num_secondaries{};
+    size_type num_initializers{};
+
+    void operator()(size_type step, LDemoResult* result) const
+    {
+        LDemoStageTimes& times = result->stage_time;
+        tally_step(step, pre_step, &times.pre_step);
+        tally_step(step, along_and_post_step, &times.along_and_post_step);
+        tally_step(step, interact, &times.interact);
+        tally_step(step, process_interactions, &times.process_interactions);
+        tally_step(step, initialize_tracks, &times.initialize_tracks);
+        tally_step(step, num_secondaries, &result->secondaries);
+        tally_step(step, num_initializers, &result->initializers);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the primaries belonging to a range of events.
+ *
+ * The primaries are ordered by event ID, as read from the event file.
+ */
+std::vector<Primary> batch_primaries(const std::vector<Primary>& primaries,
+                                     Range<size_type>            events)
+{
+    auto event_less = [](const Primary& p, size_type event) {
+        return p.event_id.get() < event;
+    };
+    auto first = std::lower_bound(
+        primaries.begin(), primaries.end(), *events.begin(), event_less);
+    auto last = std::lower_bound(
+        first, primaries.end(), *events.end(), event_less);
+    return {first, last};
+}
 
-    CELER_NOT_IMPLEMENTED("TODO: stepping loop");
+//---------------------------------------------------------------------------//
+/*!
+ * Resize a per-step tally to the longest one over all processes.
+ */
+template<class T>
+void resize_steps(const Communicator& comm, std::vector<T>* tally)
+{
+    tally->resize(allreduce(comm, Operation::max, tally->size()));
+}
 
-    bool any_alive = true;
-    while (any_alive)
+//---------------------------------------------------------------------------//
+/*!
+ * Combine the tallies from all processes.
+ *
+ * Track counts and energy deposition are summed. The real time of each step
+ * and stage is the maximum over processes, since the slowest one sets the
+ * pace. This is collective over the communicator.
+ */
+void reduce_result(const Communicator& comm, LDemoResult* result)
+{
+    // Per-step tallies
+    resize_steps(comm, &result->time);
+    resize_steps(comm, &result->alive);
+    resize_steps(comm, &result->edep);
+    allreduce(comm, Operation::max, make_span(result->time));
+    allreduce(comm, Operation::sum, make_span(result->alive));
+    allreduce(comm, Operation::sum, make_span(result->edep));
+    result->total_time
+        = allreduce(comm, Operation::max, result->total_time);
+
+    // Diagnostics (the model list is the same on every process)
+    LDemoStageTimes& times = result->stage_time;
+    for (std::vector<double>* stage : {&times.pre_step,
+                                       &times.along_and_post_step,
+                                       &times.interact,
+                                       &times.process_interactions,
+                                       &times.initialize_tracks})
     {
-        demo_loop::pre_step(params_ref, states_ref);
-        demo_loop::along_and_post_step(params_ref, states_ref);
-        launch_models(params, params_ref, states_ref);
-        demo_loop::process_interactions(params_ref, states_ref);
-        // TODO: Create primaries from secondaries
+        resize_steps(comm, stage);
+        allreduce(comm, Operation::max, make_span(*stage));
     }
+    resize_steps(comm, &result->secondaries);
+    resize_steps(comm, &result->initializers);
+    allreduce(comm, Operation::sum, make_span(result->secondaries));
+    allreduce(comm, Operation::sum, make_span(result->initializers));
+    for (LDemoModelResult& model : result->models)
+    {
+        model.time = allreduce(comm, Operation::max, model.time);
+        model.num_tracks
+            = allreduce(comm, Operation::sum, model.num_tracks);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the subset of the problem data needed to initialize tracks.
+ *
+ * TODO: remove once sim/TrackInterface is unified with LDemoInterface.
+ */
+template<MemSpace M>
+celeritas::ParamsData<Ownership::const_reference, M>
+build_init_params_refs(const ParamsData<Ownership::const_reference, M>& p)
+{
+    celeritas::ParamsData<Ownership::const_reference, M> ref;
+    ref.geometry  = p.geometry;
+    ref.materials = p.materials;
+    ref.particles = p.particles;
+    ref.rng       = p.rng;
+    CELER_ENSURE(ref);
+    return ref;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the subset of the state data needed to initialize tracks.
+ */
+template<MemSpace M>
+celeritas::StateData<Ownership::reference, M>
+build_init_state_refs(StateData<Ownership::reference, M>& s)
+{
+    celeritas::StateData<Ownership::reference, M> ref;
+    ref.geometry     = s.geometry;
+    ref.particles    = s.particles;
+    ref.rng          = s.rng;
+    ref.sim          = s.sim;
+    ref.interactions = s.interactions;
+    CELER_ENSURE(ref);
+    return ref;
 }
 
 //---------------------------------------------------------------------------//
-LDemoResult run_cpu(LDemoArgs args)
+/*!
+ * Transport all primaries in the given memory space.
+ *
+ * The events are handed out in batches to the processes of the communicator
+ * by an \c EventDistributor, and each process transports the primaries of
+ * its batches one batch at a time. A single process transports all the
+ * events in one batch.
+ *
+ * Each step creates track initializers from the surviving secondaries and
+ * uses them to fill the empty track slots. Secondaries are initialized first
+ * so that they can copy the geometry state of their parents; any slots that
+ * are still empty are then filled with the remaining primaries. Primaries are
+ * only queued when there is an empty slot for them so that they never take
+ * up the initializer storage needed for secondaries. A batch ends when no
+ * tracks or initializers are left or after \c max_steps .
+ *
+ * The per-step tallies are indexed by the step within a batch and combined
+ * over batches and processes, so every process returns the same result.
+ */
+template<MemSpace M>
+LDemoResult run(const LDemoArgs& args, const Communicator& comm)
 {
     CELER_EXPECT(args);
 
-    // Load all the problem data
-    LDemoParams params     = load_params(args);
-    auto        params_ref = build_params_refs<MemSpace::host>(params);
+    // Load all the problem data and create param interfaces
+    LDemoParams params = load_params(args);
+    ParamsData<Ownership::const_reference, M> params_ref
+        = build_params_refs<M>(params);
+    auto init_params_ref = build_init_params_refs(params_ref);
 
-    StateData<Ownership::value, MemSpace::host> state_storage;
-    resize(&state_storage, build_params_refs<MemSpace::host>(params), 1);
-    auto states_ref = make_ref(state_storage);
+    // Create states
+    StateData<Ownership::value, M> state_storage;
+    resize(&state_storage,
+           build_params_refs<MemSpace::host>(params),
+           args.max_num_tracks);
+    StateData<Ownership::reference, M> states_ref = make_ref(state_storage);
+    auto init_states_ref = build_init_state_refs(states_ref);
+
+    LDemoResult   result;
+    StageTimer<M> time_stage(args.enable_diagnostics);
+    if (time_stage)
+    {
+        result.models = build_model_results(*params.physics);
+    }
+
+    Stopwatch get_total_time;
 
-    CELER_NOT_IMPLEMENTED("TODO: CPU stepping loop");
+    // Hand out a few batches of events to each process so that the ones that
+    // draw cheap events take on more of them
+    const size_type num_events = params.primaries.back().event_id.get() + 1;
+    EventDistributor next_batch(
+        comm,
+        num_events,
+        comm.size() > 1
+            ? std::max<size_type>(num_events / (4 * comm.size()), 1)
+            : num_events);
 
-    bool any_alive = false;
-    while (any_alive)
+    for (auto batch = next_batch(); !batch.empty(); batch = next_batch())
     {
-        launch_models(params, params_ref, states_ref);
+        TrackInitParams::Input input;
+        input.primaries = batch_primaries(params.primaries, batch);
+        if (input.primaries.empty())
+            continue;
+        input.storage_factor = args.storage_factor;
+        TrackInitParams track_inits(input);
+        const celeritas::TrackInitParamsHostRef& primaries
+            = track_inits.host_pointers();
+
+        // Create track initializer storage
+        celeritas::TrackInitStateData<Ownership::value, M> inits;
+        resize(&inits, primaries, args.max_num_tracks);
+
+        // Fill the empty track slots with primaries
+        extend_from_primaries(primaries, &inits, inits.vacancies.size());
+        initialize_tracks(init_params_ref, init_states_ref, &inits);
+        size_type num_alive = states_ref.size() - inits.vacancies.size();
+
+        for (size_type step = 0; num_alive > 0 && step < args.max_steps;
+             ++step)
+        {
+            Stopwatch       get_step_time;
+            StepDiagnostics diagnostics;
+            diagnostics.pre_step = time_stage(
+                [&] { demo_loop::pre_step(params_ref, states_ref); });
+            diagnostics.along_and_post_step = time_stage([&] {
+                demo_loop::along_and_post_step(params_ref, states_ref);
+            });
+            diagnostics.interact = time_stage([&] {
+                launch_models(params,
+                              params_ref,
+                              states_ref,
+                              time_stage,
+                              &result.models);
+            });
+            diagnostics.process_interactions = time_stage([&] {
+                demo_loop::process_interactions(params_ref, states_ref);
+            });
+            if (time_stage)
+            {
+                diagnostics.num_secondaries = num_secondaries(states_ref);
+            }
+
+            // Create new tracks from secondaries and release the secondary
+            // storage for the next step, then fill any empty slots that are
+            // left with the remaining primaries
+            diagnostics.initialize_tracks = time_stage([&] {
+                extend_from_secondaries(
+                    init_params_ref, init_states_ref, &inits);
+                demo_loop::clear_secondaries(states_ref);
+                initialize_tracks(init_params_ref, init_states_ref, &inits);
+                if (inits.vacancies.size() > 0 && inits.num_primaries > 0)
+                {
+                    extend_from_primaries(
+                        primaries, &inits, inits.vacancies.size());
+                    initialize_tracks(
+                        init_params_ref, init_states_ref, &inits);
+                }
+            });
+
+            synchronize<M>();
+            tally_step<double>(step, get_step_time(), &result.time);
+            tally_step(step, num_alive, &result.alive);
+            tally_step<double>(
+                step,
+                demo_loop::reduce_energy_deposition(states_ref),
+                &result.edep);
+            if (time_stage)
+            {
+                // Tracks waiting for an empty slot
+                diagnostics.num_initializers = inits.initializers.size()
+                                               + inits.num_primaries;
+                diagnostics(step, &result);
+            }
+
+            num_alive = states_ref.size() - inits.vacancies.size();
+        }
     }
+    result.total_time = get_total_time();
+
+    reduce_result(comm, &result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+LDemoResult run_gpu(LDemoArgs args, const Communicator& comm)
+{
+    return run<MemSpace::device>(args, comm);
+}
+
+//---------------------------------------------------------------------------//
+LDemoResult run_cpu(LDemoArgs args, const Communicator& comm)
+{
+    return run<MemSpace::host>(args, comm);
 }
 
 //---------------------------------------------------------------------------//
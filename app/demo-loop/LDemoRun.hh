@@ -7,12 +7,14 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "comm/Communicator.hh"
 #include "LDemoIO.hh"
 
 namespace demo_loop
 {
 //---------------------------------------------------------------------------//
-LDemoResult run_gpu(LDemoArgs args);
+LDemoResult run_gpu(LDemoArgs args, const celeritas::Communicator& comm);
+LDemoResult run_cpu(LDemoArgs args, const celeritas::Communicator& comm);
 
 //---------------------------------------------------------------------------//
 } // namespace demo_loop
@@ -35,8 +35,11 @@ namespace
 //---------------------------------------------------------------------------//
 /*!
  * Run, launch, and output.
+ *
+ * The events are distributed among all processes in the communicator, and
+ * the combined result is written by the first process.
  */
-void run(std::istream& is)
+void run(std::istream& is, const celeritas::Communicator& comm)
 {
     // Read input options
     auto inp = nlohmann::json::parse(is);
@@ -45,7 +48,12 @@ void run(std::istream& is)
     auto run_args = inp.at("run").get<LDemoArgs>();
     CELER_EXPECT(run_args);
 
-    auto result = run_gpu(run_args);
+    // Run on the GPU if one is available, otherwise use host threads
+    auto result = celeritas::device() ? run_gpu(run_args, comm)
+                                      : run_cpu(run_args, comm);
+
+    if (comm.rank() != 0)
+        return;
 
     nlohmann::json outp = {
         {"run", run_args},
@@ -79,12 +87,6 @@ int main(int argc, char* argv[])
                ? Communicator{}
                : Communicator::comm_world());
 
-    if (comm.size() > 1)
-    {
-        CELER_LOG(critical) << "TODO: this app cannot run in parallel";
-        return EXIT_FAILURE;
-    }
-
     // Process input arguments
     std::vector<std::string> args(argv, argv + argc);
     if (args.size() != 2 || args[1] == "--help" || args[1] == "-h")
@@ -98,8 +100,8 @@ int main(int argc, char* argv[])
 
     if (!celeritas::device())
     {
-        CELER_LOG(critical) << "CUDA capability is disabled";
-        return EXIT_FAILURE;
+        CELER_LOG(warning) << "CUDA capability is disabled: transporting on "
+                              "host";
     }
 
     std::string   filename = args[1];
@@ -107,6 +109,12 @@ int main(int argc, char* argv[])
     std::istream* instream = nullptr;
     if (filename == "-")
     {
+        if (comm.size() > 1)
+        {
+            CELER_LOG(critical) << "Input must be read from a file when "
+                                   "running in parallel";
+            return EXIT_FAILURE;
+        }
         instream = &std::cin;
         filename = "<stdin>"; // For nicer output on failure
     }
@@ -124,7 +132,7 @@ int main(int argc, char* argv[])
 
     try
     {
-        run(*instream);
+        run(*instream, comm);
     }
     catch (const std::exception& e)
     {
@@ -67,3 +67,8 @@ except json.decoder.JSONDecodeError as e:
 print(json.dumps(result, indent=1))
 with open(f'{exe}.out.json', 'w') as f:
     json.dump(result, f)
+
+alive = result['result']['alive']
+if not alive or not all(alive):
+    print("fatal: expected living tracks at every step but got", alive)
+    exit(1)
@@ -9,6 +9,7 @@
 
 #include "base/ArrayUtils.hh"
 #include "base/Range.hh"
+#include "comm/Device.hh"
 
 using celeritas::range;
 
@@ -63,14 +64,23 @@ ImageStore::ImageStore(ImageRunArgs params)
     }
 
     // Allocate storage
-    dims_  = {num_y, num_x};
-    image_ = celeritas::DeviceVector<int>(num_y * num_x);
-    CELER_ENSURE(!image_.empty());
+    dims_ = {num_y, num_x};
+    if (celeritas::device())
+    {
+        image_ = celeritas::DeviceVector<int>(num_y * num_x);
+    }
+    else
+    {
+        host_image_.resize(num_y * num_x);
+    }
+    CELER_ENSURE(!image_.empty() || !host_image_.empty());
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Access image on host for initializing.
+ * Access image on host for initializing or writing.
+ *
+ * The image data is only accessible if the image is stored on the host.
  */
 ImagePointers ImageStore::host_interface()
 {
@@ -81,6 +91,7 @@ ImagePointers ImageStore::host_interface()
     result.right_ax    = right_ax_;
     result.pixel_width = pixel_width_;
     result.dims        = dims_;
+    result.image       = celeritas::make_span(host_image_);
 
     return result;
 }
@@ -91,6 +102,8 @@ ImagePointers ImageStore::host_interface()
  */
 ImagePointers ImageStore::device_interface()
 {
+    CELER_EXPECT(this->on_device());
+
     ImagePointers result;
 
     result.origin      = origin_;
@@ -109,6 +122,11 @@ ImagePointers ImageStore::device_interface()
  */
 auto ImageStore::data_to_host() const -> VecInt
 {
+    if (!this->on_device())
+    {
+        return host_image_;
+    }
+
     VecInt result(dims_[0] * dims_[1]);
     image_.copy_to_host(celeritas::make_span(result));
     return result;
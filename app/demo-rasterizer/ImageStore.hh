@@ -20,6 +20,9 @@ namespace demo_rasterizer
 //---------------------------------------------------------------------------//
 /*!
  * Initialization and storage for a raster image.
+ *
+ * The image is stored on the device if one is available, otherwise on the
+ * host.
  */
 class ImageStore
 {
@@ -38,7 +41,7 @@ class ImageStore
 
     //// DEVICE ACCESSORS ////
 
-    //! Access image on host for initializing
+    //! Access image on host for initializing or writing
     ImagePointers host_interface();
 
     //! Access image on device for writing
@@ -61,6 +64,9 @@ class ImageStore
     //! Dimensions {j, i} of the image
     const UInt2& dims() const { return dims_; }
 
+    //! Whether the image is stored on the device
+    bool on_device() const { return !image_.empty(); }
+
     // Copy out the image to the host
     VecInt data_to_host() const;
 
@@ -71,6 +77,7 @@ class ImageStore
     real_type                    pixel_width_;
     UInt2                        dims_;
     celeritas::DeviceVector<int> image_;
+    VecInt                       host_image_;
 };
 
 //---------------------------------------------------------------------------//
@@ -15,8 +15,8 @@ namespace demo_rasterizer
 /*!
  * Modify a line of a rasterized image.
  *
- * The rasterizer starts at the left side of an image and traces rightward.
- * Each "line" is a single thread.
+ * The rasterizer starts at the left side of an image (or of an image tile)
+ * and traces rightward. Each "line" is a single thread on the device.
  */
 class ImageTrackView
 {
@@ -33,8 +33,8 @@ class ImageTrackView
     inline CELER_FUNCTION
     ImageTrackView(const ImagePointers& shared, ThreadId tid);
 
-    // Calculate start position
-    inline CELER_FUNCTION Real3 start_pos() const;
+    // Calculate start position at the left edge of pixel i
+    inline CELER_FUNCTION Real3 start_pos(unsigned int i = 0) const;
 
     //! Start direction (rightward axis)
     CELER_FUNCTION const Real3& start_dir() const { return shared_.right_ax; }
@@ -22,15 +22,19 @@ ImageTrackView::ImageTrackView(const ImagePointers& shared, ThreadId tid)
 
 //---------------------------------------------------------------------------//
 /*!
- * Calculate starting position.
+ * Calculate starting position at the left edge of pixel i.
  */
-CELER_FUNCTION auto ImageTrackView::start_pos() const -> Real3
+CELER_FUNCTION auto ImageTrackView::start_pos(unsigned int i) const -> Real3
 {
+    CELER_EXPECT(i < shared_.dims[1]);
+
     Real3     result;
-    real_type down_offset = (j_index_ + real_type(0.5)) * shared_.pixel_width;
-    for (int i = 0; i < 3; ++i)
+    real_type down_offset  = (j_index_ + real_type(0.5)) * shared_.pixel_width;
+    real_type right_offset = i * shared_.pixel_width;
+    for (int ax = 0; ax < 3; ++ax)
     {
-        result[i] = shared_.origin[i] + shared_.down_ax[i] * down_offset;
+        result[ax] = shared_.origin[ax] + shared_.down_ax[ax] * down_offset
+                     + shared_.right_ax[ax] * right_offset;
     }
     return result;
 }
@@ -0,0 +1,74 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RDemoKernel.cc
+//---------------------------------------------------------------------------//
+#include "RDemoKernel.hh"
+
+#include <algorithm>
+#include "RDemoLauncher.hh"
+
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+using namespace celeritas;
+
+namespace demo_rasterizer
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Trace an image on the host, one tile at a time.
+ *
+ * The image is divided into tiles of \c tile_dims (rows, columns) pixels.
+ * With OpenMP, tiles are handed to the threads dynamically as each thread
+ * finishes its previous tile, so regions of the image with complex geometry
+ * do not hold up the threads that trace simple regions. Each row of a tile
+ * is traced by a single ray, and each thread reuses the geometry state slot
+ * matching its thread number: the state must be at least as large as the
+ * maximum number of threads.
+ */
+void trace(const GeoParamsCRefHost&      geo_params,
+           const GeoStateRefHost&        geo_state,
+           const ImagePointers&          image,
+           const Array<unsigned int, 2>& tile_dims)
+{
+    CELER_EXPECT(image);
+    CELER_EXPECT(tile_dims[0] > 0 && tile_dims[1] > 0);
+
+    const unsigned int num_tile_rows
+        = (image.dims[0] + tile_dims[0] - 1) / tile_dims[0];
+    const unsigned int num_tile_cols
+        = (image.dims[1] + tile_dims[1] - 1) / tile_dims[1];
+    const int num_tiles = num_tile_rows * num_tile_cols;
+
+    TraceLauncher<MemSpace::host> launch(geo_params, geo_state, image);
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (int tile = 0; tile < num_tiles; ++tile)
+    {
+#if CELERITAS_USE_OPENMP
+        ThreadId tid(omp_get_thread_num());
+#else
+        ThreadId tid(0);
+#endif
+        CELER_ASSERT(tid < geo_state.size());
+
+        // Pixel ranges of this tile
+        unsigned int j_begin = (tile / num_tile_cols) * tile_dims[0];
+        unsigned int i_begin = (tile % num_tile_cols) * tile_dims[1];
+        unsigned int j_end = std::min(j_begin + tile_dims[0], image.dims[0]);
+        unsigned int i_end = std::min(i_begin + tile_dims[1], image.dims[1]);
+
+        for (unsigned int j = j_begin; j < j_end; ++j)
+        {
+            launch(tid, j, i_begin, i_end);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_rasterizer
@@ -7,6 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "celeritas_config.h"
+#include "base/Array.hh"
+#include "base/Assert.hh"
 #include "geometry/GeoInterface.hh"
 #include "ImageInterface.hh"
 
@@ -21,10 +24,28 @@ using GeoParamsCRefDevice
     = celeritas::GeoParamsData<Ownership::const_reference, MemSpace::device>;
 using GeoStateRefDevice
     = celeritas::GeoStateData<Ownership::reference, MemSpace::device>;
+using GeoParamsCRefHost
+    = celeritas::GeoParamsData<Ownership::const_reference, MemSpace::host>;
+using GeoStateRefHost
+    = celeritas::GeoStateData<Ownership::reference, MemSpace::host>;
 
 void trace(const GeoParamsCRefDevice& geo_params,
            const GeoStateRefDevice&   geo_state,
            const ImagePointers&       image);
 
+void trace(const GeoParamsCRefHost&                 geo_params,
+           const GeoStateRefHost&                   geo_state,
+           const ImagePointers&                     image,
+           const celeritas::Array<unsigned int, 2>& tile_dims);
+
+//---------------------------------------------------------------------------//
+#if !CELERITAS_USE_CUDA
+inline void trace(const GeoParamsCRefDevice&,
+                  const GeoStateRefDevice&,
+                  const ImagePointers&)
+{
+    CELER_NOT_CONFIGURED("CUDA");
+}
+#endif
 //---------------------------------------------------------------------------//
 } // namespace demo_rasterizer
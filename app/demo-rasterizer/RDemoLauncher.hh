@@ -0,0 +1,138 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RDemoLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+#include "base/Macros.hh"
+#include "geometry/GeoInterface.hh"
+#include "geometry/GeoTrackView.hh"
+#include "ImageTrackView.hh"
+
+namespace demo_rasterizer
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Trace a horizontal segment of the image.
+ *
+ * A single geometry track is started at the left edge of the first pixel and
+ * moved rightward to the end of the last pixel. Each pixel is assigned the
+ * volume that the track spends the longest distance in.
+ *
+ * The launcher is shared between the CUDA kernel, which traces a full row
+ * per thread, and the host loop, which traces one row of an image tile at a
+ * time and reuses a geometry state per worker thread.
+ */
+template<celeritas::MemSpace M>
+class TraceLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef
+        = celeritas::GeoParamsData<celeritas::Ownership::const_reference, M>;
+    using StateRef
+        = celeritas::GeoStateData<celeritas::Ownership::reference, M>;
+    using ThreadId = celeritas::ThreadId;
+    //!@}
+
+  public:
+    // Construct with geometry and image data
+    CELER_FUNCTION TraceLauncher(const ParamsRef&     geo_params,
+                                 const StateRef&      geo_state,
+                                 const ImagePointers& image)
+        : geo_params_(geo_params), geo_state_(geo_state), image_(image)
+    {
+    }
+
+    // Trace pixels [begin, end) of row j using the given geometry state
+    inline CELER_FUNCTION void operator()(ThreadId     tid,
+                                          unsigned int j,
+                                          unsigned int begin,
+                                          unsigned int end) const;
+
+  private:
+    const ParamsRef&     geo_params_;
+    const StateRef&      geo_state_;
+    const ImagePointers& image_;
+
+    // Get the volume ID, with -1 for outside
+    static inline CELER_FUNCTION int geo_id(const celeritas::GeoTrackView&);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+template<celeritas::MemSpace M>
+CELER_FUNCTION void TraceLauncher<M>::operator()(ThreadId     tid,
+                                                 unsigned int j,
+                                                 unsigned int begin,
+                                                 unsigned int end) const
+{
+    using celeritas::real_type;
+    CELER_EXPECT(begin < end && end <= image_.dims[1]);
+
+    ImageTrackView          image(image_, ThreadId{j});
+    celeritas::GeoTrackView geo(geo_params_, geo_state_, tid);
+    const real_type         max_step = (end - begin) * image_.pixel_width;
+
+    // Start track at the left edge of the first pixel
+    geo = celeritas::GeoTrackInitializer{image.start_pos(begin),
+                                         image.start_dir()};
+
+    int       cur_id   = geo_id(geo);
+    real_type geo_dist = std::fmin(geo.next_step(), max_step);
+
+    // Track along each pixel
+    for (unsigned int i = begin; i < end; ++i)
+    {
+        real_type pix_dist = image_.pixel_width;
+        real_type max_dist = 0;
+        int       max_id   = cur_id;
+        while (geo_dist <= pix_dist)
+        {
+            // Move to geometry boundary
+            pix_dist -= geo_dist;
+
+            if (max_id == cur_id)
+            {
+                max_dist += geo_dist;
+            }
+            else if (geo_dist > max_dist)
+            {
+                max_dist = geo_dist;
+                max_id   = cur_id;
+            }
+
+            // Cross surface
+            geo.move_next_step();
+            cur_id   = geo_id(geo);
+            geo_dist = std::fmin(geo.next_step(), max_step);
+        }
+
+        // Move to pixel boundary
+        geo_dist -= pix_dist;
+        if (pix_dist > max_dist)
+        {
+            max_dist = pix_dist;
+            max_id   = cur_id;
+        }
+        image.set_pixel(i, max_id);
+    }
+}
+
+//---------------------------------------------------------------------------//
+template<celeritas::MemSpace M>
+CELER_FUNCTION int TraceLauncher<M>::geo_id(const celeritas::GeoTrackView& geo)
+{
+    if (geo.is_outside())
+        return -1;
+    return geo.volume_id().get();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_rasterizer
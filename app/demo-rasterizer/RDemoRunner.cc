@@ -16,18 +16,23 @@
 #include "ImageTrackView.hh"
 #include "RDemoKernel.hh"
 
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
 using namespace celeritas;
 
 namespace demo_rasterizer
 {
 //---------------------------------------------------------------------------//
 /*!
- * Construct with image parameters
+ * Construct with geometry and the tile size for tracing on the host.
  */
-RDemoRunner::RDemoRunner(SPConstGeo geometry)
-    : geo_params_(std::move(geometry))
+RDemoRunner::RDemoRunner(SPConstGeo geometry, UInt2 tile_dims)
+    : geo_params_(std::move(geometry)), tile_dims_(tile_dims)
 {
     CELER_EXPECT(geo_params_);
+    CELER_EXPECT(tile_dims_[0] > 0 && tile_dims_[1] > 0);
 }
 
 //---------------------------------------------------------------------------//
@@ -38,15 +43,48 @@ void RDemoRunner::operator()(ImageStore* image) const
 {
     CELER_EXPECT(image);
 
-    CollectionStateStore<GeoStateData, MemSpace::device> geo_state(
-        *geo_params_, image->dims()[0]);
+    const UInt2& dims     = image->dims();
+    size_type    num_rays = dims[0];
+    double       time     = 0;
+    if (image->on_device())
+    {
+        // One geometry state per row
+        CollectionStateStore<GeoStateData, MemSpace::device> geo_state(
+            *geo_params_, dims[0]);
+
+        CELER_LOG(status) << "Tracing geometry on device";
+        Stopwatch get_time;
+        trace(geo_params_->device_pointers(),
+              geo_state.ref(),
+              image->device_interface());
+        time = get_time();
+    }
+    else
+    {
+        // One geometry state per host thread
+#if CELERITAS_USE_OPENMP
+        size_type num_workers = omp_get_max_threads();
+#else
+        size_type num_workers = 1;
+#endif
+        CollectionStateStore<GeoStateData, MemSpace::host> geo_state(
+            *geo_params_, num_workers);
+
+        // Each row of each tile is a separate ray
+        num_rays *= (dims[1] + tile_dims_[1] - 1) / tile_dims_[1];
 
-    CELER_LOG(status) << "Tracing geometry";
-    Stopwatch get_time;
-    trace(geo_params_->device_pointers(),
-          geo_state.ref(),
-          image->device_interface());
-    CELER_LOG(diagnostic) << color_code('x') << "... " << get_time() << " s"
+        CELER_LOG(status) << "Tracing geometry on host with " << num_workers
+                          << " threads";
+        Stopwatch get_time;
+        trace(geo_params_->host_pointers(),
+              geo_state.ref(),
+              image->host_interface(),
+              tile_dims_);
+        time = get_time();
+    }
+    CELER_LOG(diagnostic) << color_code('x') << "... " << time << " s ("
+                          << num_rays / time << " rays/s, "
+                          << dims[0] * dims[1] / time << " pixels/s)"
                           << color_code(' ');
 }
 
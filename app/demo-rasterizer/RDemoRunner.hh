@@ -15,7 +15,11 @@ namespace demo_rasterizer
 {
 //---------------------------------------------------------------------------//
 /*!
- * Set up and run rasterization of the given device image.
+ * Set up and run rasterization of the given image.
+ *
+ * If the image is on the device, each row is traced by a CUDA thread.
+ * Otherwise the image is split into tiles of \c tile_dims (rows, columns)
+ * that are traced in parallel on the host.
  */
 class RDemoRunner
 {
@@ -24,17 +28,19 @@ class RDemoRunner
     //! Type aliases
     using SPConstGeo = std::shared_ptr<const celeritas::GeoParams>;
     using Args       = ImageRunArgs;
+    using UInt2      = celeritas::Array<unsigned int, 2>;
     //!@}
 
   public:
-    // Construct with geometry
-    explicit RDemoRunner(SPConstGeo geometry);
+    // Construct with geometry and host tile size
+    explicit RDemoRunner(SPConstGeo geometry, UInt2 tile_dims = {8, 128});
 
     // Trace an image
     void operator()(ImageStore* image) const;
 
   private:
     SPConstGeo geo_params_;
+    UInt2      tile_dims_;
 };
 
 //---------------------------------------------------------------------------//
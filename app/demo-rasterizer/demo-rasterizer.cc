@@ -53,8 +53,13 @@ void run(std::istream& is)
     // Construct image
     ImageStore image(inp.at("image").get<ImageRunArgs>());
 
-    // Construct runner
-    RDemoRunner run(geo_params);
+    // Construct runner, optionally with the tile size for host tracing
+    RDemoRunner::UInt2 tile_dims{8, 128};
+    if (inp.count("tile_dims"))
+    {
+        inp.at("tile_dims").get_to(tile_dims);
+    }
+    RDemoRunner run(geo_params, tile_dims);
     run(&image);
 
     // Get geometry names
@@ -66,7 +71,7 @@ void run(std::istream& is)
     }
 
     // Write image
-    CELER_LOG(status) << "Transferring image from GPU to disk";
+    CELER_LOG(status) << "Writing image to disk";
     std::string out_filename = inp.at("output");
     auto        image_data   = image.data_to_host();
     std::ofstream(out_filename, std::ios::binary)
@@ -104,8 +109,13 @@ void run(std::istream& is)
 int main(int argc, char* argv[])
 {
     ScopedMpiInit scoped_mpi(&argc, &argv);
-    if (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized
-        && Communicator::comm_world().size() > 1)
+
+    Communicator comm
+        = (ScopedMpiInit::status() == ScopedMpiInit::Status::disabled
+               ? Communicator{}
+               : Communicator::comm_world());
+
+    if (comm.size() > 1)
     {
         CELER_LOG(critical) << "This app cannot run in parallel";
         return EXIT_FAILURE;
@@ -138,12 +148,11 @@ int main(int argc, char* argv[])
     }
 
     // Initialize GPU
-    celeritas::activate_device(Device(0));
+    celeritas::activate_device(Device::from_round_robin(comm));
 
     if (!celeritas::device())
     {
-        CELER_LOG(critical) << "CUDA capability is disabled";
-        return EXIT_FAILURE;
+        CELER_LOG(warning) << "CUDA capability is disabled: tracing on host";
     }
 
     try
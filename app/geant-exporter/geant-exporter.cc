@@ -35,6 +35,8 @@
 #include "comm/Communicator.hh"
 #include "comm/Logger.hh"
 #include "comm/ScopedMpiInit.hh"
+#include "io/BinaryExporter.hh"
+#include "io/BinaryImporter.hh"
 #include "io/ImportParticle.hh"
 #include "io/ImportPhysicsTable.hh"
 #include "io/ImportData.hh"
@@ -404,7 +406,9 @@ std::vector<ImportVolume> store_volumes(const G4VPhysicalVolume* world_volume)
  * tables, material, and volume information constructed by the physics list
  * loaded by the GDML geometry.
  *
- * The data is stored into a ROOT file as an \c ImportData struct.
+ * The data is stored into a ROOT file as an \c ImportData struct, or into a
+ * memory-mappable binary file (see \c BinaryExporter) if the output filename
+ * does not end in ".root".
  */
 int main(int argc, char* argv[])
 {
@@ -420,11 +424,12 @@ int main(int argc, char* argv[])
     if (argc != 3)
     {
         // Incorrect number of arguments: print help and exit
-        cout << "Usage: " << argv[0] << " geometry.gdml output.root" << endl;
+        cout << "Usage: " << argv[0] << " geometry.gdml output.{root,bin}"
+             << endl;
         return 2;
     }
     std::string gdml_input_filename  = argv[1];
-    std::string root_output_filename = argv[2];
+    std::string output_filename      = argv[2];
 
     //// Initialize Geant4 ////
 
@@ -468,19 +473,7 @@ int main(int argc, char* argv[])
 
     //// Export data ////
 
-    CELER_LOG(status) << "Creating ROOT file";
-    std::unique_ptr<TFile> root_output(
-        TFile::Open(root_output_filename.c_str(), "recreate"));
-    CELER_ASSERT(root_output && !root_output->IsZombie());
-    CELER_LOG(info) << "Created ROOT output file '" << root_output_filename
-                    << "'";
-
-    TTree      tree_data("geant4_data", "geant4_data");
     ImportData import_data;
-    TBranch*   branch = tree_data.Branch("ImportData", &import_data);
-    CELER_ASSERT(branch);
-
-    // Populate ImportData members
     import_data.particles = store_particles();
     import_data.elements  = store_elements();
     import_data.materials = store_materials();
@@ -488,6 +481,26 @@ int main(int argc, char* argv[])
     import_data.volumes   = store_volumes(world_phys_volume);
     CELER_ENSURE(import_data);
 
+    if (!is_root_filename(output_filename))
+    {
+        // Write memory-mappable binary file
+        CELER_LOG(status) << "Writing binary output file '" << output_filename
+                          << "'";
+        BinaryExporter write(output_filename);
+        write(import_data);
+        return EXIT_SUCCESS;
+    }
+
+    CELER_LOG(status) << "Creating ROOT file";
+    std::unique_ptr<TFile> root_output(
+        TFile::Open(output_filename.c_str(), "recreate"));
+    CELER_ASSERT(root_output && !root_output->IsZombie());
+    CELER_LOG(info) << "Created ROOT output file '" << output_filename << "'";
+
+    TTree    tree_data("geant4_data", "geant4_data");
+    TBranch* branch = tree_data.Branch("ImportData", &import_data);
+    CELER_ASSERT(branch);
+
     // Write data to disk and close ROOT file
     tree_data.Fill();
     int err_code = root_output->Write();
@@ -11,23 +11,29 @@
 #include "Assert.hh"
 #include "Macros.hh"
 #include "Types.hh"
+#include "detail/AtomicsImpl.hh"
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
  * Add to a value, returning the original value.
+ *
+ * On host this is a true atomic operation with the given memory ordering, so
+ * it is safe to call from multiple host threads. Device atomics are always
+ * relaxed.
  */
 template<class T>
-CELER_FORCEINLINE_FUNCTION T atomic_add(T* address, T value)
+CELER_FORCEINLINE_FUNCTION T
+atomic_add(T*                             address,
+           T                              value,
+           CELER_MAYBE_UNUSED MemoryOrder order = MemoryOrder::seq_cst)
 {
 #ifdef __CUDA_ARCH__
     return atomicAdd(address, value);
 #else
     CELER_EXPECT(address);
-    T initial = *address;
-    *address += value;
-    return initial;
+    return detail::host_atomic_add(address, value, order);
 #endif
 }
 
@@ -38,7 +44,8 @@ CELER_FORCEINLINE_FUNCTION T atomic_add(T* address, T value)
  *
  * From CUDA C Programming guide v10.1 p127
  */
-inline __device__ double atomic_add(double* address, double val)
+inline __device__ double
+atomic_add(double* address, double val, MemoryOrder = MemoryOrder::seq_cst)
 {
     CELER_EXPECT(address);
     ull_int* address_as_ull = reinterpret_cast<ull_int*>(address);
@@ -63,15 +70,16 @@ inline __device__ double atomic_add(double* address, double val)
  * Set the value to the minimum of the actual and given, returning old.
  */
 template<class T>
-CELER_FORCEINLINE_FUNCTION T atomic_min(T* address, T value)
+CELER_FORCEINLINE_FUNCTION T
+atomic_min(T*                             address,
+           T                              value,
+           CELER_MAYBE_UNUSED MemoryOrder order = MemoryOrder::seq_cst)
 {
 #ifdef __CUDA_ARCH__
     return atomicMin(address, value);
 #else
     CELER_EXPECT(address);
-    T initial = *address;
-    *address  = celeritas::min(initial, value);
-    return initial;
+    return detail::host_atomic_min(address, value, order);
 #endif
 }
 
@@ -80,15 +88,34 @@ CELER_FORCEINLINE_FUNCTION T atomic_min(T* address, T value)
  * Set the value to the maximum of the actual and given, returning old.
  */
 template<class T>
-CELER_FORCEINLINE_FUNCTION T atomic_max(T* address, T value)
+CELER_FORCEINLINE_FUNCTION T
+atomic_max(T*                             address,
+           T                              value,
+           CELER_MAYBE_UNUSED MemoryOrder order = MemoryOrder::seq_cst)
 {
 #ifdef __CUDA_ARCH__
     return atomicMax(address, value);
 #else
     CELER_EXPECT(address);
-    T initial = *address;
-    *address  = celeritas::max(initial, value);
-    return initial;
+    return detail::host_atomic_max(address, value, order);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Replace the value, returning the original value.
+ */
+template<class T>
+CELER_FORCEINLINE_FUNCTION T
+atomic_exchange(T*                             address,
+                T                              value,
+                CELER_MAYBE_UNUSED MemoryOrder order = MemoryOrder::seq_cst)
+{
+#ifdef __CUDA_ARCH__
+    return atomicExch(address, value);
+#else
+    CELER_EXPECT(address);
+    return detail::host_atomic_exchange(address, value, order);
 #endif
 }
 
@@ -101,7 +128,8 @@ CELER_FORCEINLINE_FUNCTION T atomic_max(T* address, T value)
  * TODO: combine this algorithm with the atomic_add and genericize on operation
  * if we ever need to implement the atomics for other types.
  */
-inline __device__ ull_int atomic_max(ull_int* address, ull_int val)
+inline __device__ ull_int
+atomic_max(ull_int* address, ull_int val, MemoryOrder = MemoryOrder::seq_cst)
 {
     CELER_EXPECT(address);
     ull_int old = *address;
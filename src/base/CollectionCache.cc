@@ -0,0 +1,141 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CollectionCache.cc
+//---------------------------------------------------------------------------//
+#include "CollectionCache.hh"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unistd.h>
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! File header for a collection cache
+struct CacheHeader
+{
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint64_t key;
+    std::uint64_t payload_size;
+    std::uint64_t checksum;
+};
+
+static_assert(sizeof(CacheHeader) == 40, "Unexpected cache header padding");
+
+constexpr char          cache_magic[] = "CELERCOL";
+constexpr std::uint32_t cache_version = 1;
+constexpr std::uint32_t byte_order    = 0x01020304u;
+
+//---------------------------------------------------------------------------//
+std::uint64_t checksum(const std::string& payload)
+{
+    HashBuilder hash;
+    hash(payload.data(), payload.size());
+    return hash.value();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a cache file atomically.
+ */
+void write_cache_file(const std::string& filename,
+                      std::uint64_t      key,
+                      const std::string& payload)
+{
+    CacheHeader header;
+    std::memcpy(header.magic, cache_magic, sizeof(header.magic));
+    header.version      = cache_version;
+    header.byte_order   = byte_order;
+    header.key          = key;
+    header.payload_size = payload.size();
+    header.checksum     = checksum(payload);
+
+    const std::string temp_filename = filename + ".tmp"
+                                      + std::to_string(::getpid());
+    {
+        std::ofstream out(temp_filename, std::ios::out | std::ios::binary);
+        CELER_VALIDATE(out,
+                       << "failed to open '" << temp_filename
+                       << "' (cannot write collection cache)");
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(payload.data(), payload.size());
+        CELER_VALIDATE(out,
+                       << "failed to write collection cache '"
+                       << temp_filename << "'");
+    }
+
+    int err = std::rename(temp_filename.c_str(), filename.c_str());
+    if (err != 0)
+    {
+        std::remove(temp_filename.c_str());
+    }
+    CELER_VALIDATE(err == 0,
+                   << "failed to move collection cache to '" << filename
+                   << "'");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the payload of a cache file if it exists and matches the key.
+ *
+ * A missing file or a key mismatch (stale cache) returns false. A file that
+ * exists but is not a valid cache raises a RuntimeError.
+ */
+bool read_cache_file(const std::string& filename,
+                     std::uint64_t      key,
+                     std::string*       payload)
+{
+    CELER_EXPECT(payload);
+
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    if (!in)
+    {
+        return false;
+    }
+
+    CacheHeader header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    CELER_VALIDATE(in
+                       && std::memcmp(header.magic,
+                                      cache_magic,
+                                      sizeof(header.magic))
+                              == 0,
+                   << "'" << filename
+                   << "' is not a collection cache file (delete it to "
+                      "rebuild)");
+    CELER_VALIDATE(header.byte_order == byte_order,
+                   << "collection cache '" << filename
+                   << "' was written with a different byte order");
+    if (header.version != cache_version || header.key != key)
+    {
+        // Written by a different code version or from different input
+        return false;
+    }
+
+    std::string result{std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>()};
+    CELER_VALIDATE(result.size() == header.payload_size
+                       && checksum(result) == header.checksum,
+                   << "collection cache '" << filename
+                   << "' is corrupt (delete it to rebuild)");
+    *payload = std::move(result);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
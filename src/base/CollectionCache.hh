@@ -0,0 +1,149 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CollectionCache.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "Collection.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate a 64-bit FNV-1a hash of trivially copyable data and strings.
+ *
+ * This is used to construct the key that identifies the inputs to a cached
+ * collection group.
+ */
+class HashBuilder
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type = std::uint64_t;
+    //!@}
+
+  public:
+    // Add raw bytes
+    inline void operator()(const void* data, std::size_t size);
+
+    // Add a string, including its length
+    inline void operator()(const std::string& str);
+
+    // Add a trivially copyable value
+    template<class T>
+    inline void operator()(const T& value);
+
+    //! Hash of all data added so far
+    result_type value() const { return hash_; }
+
+  private:
+    result_type hash_ = 0xcbf29ce484222325ull;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Archive for writing host collection groups to a byte buffer.
+ *
+ * A collection group supports caching by providing a free function
+ * \code
+   template<class A>
+   void serialize(A& ar, FooData<Ownership::value, MemSpace::host>& data);
+ * \endcode
+ * that applies the archive to each member in turn. The same function is used
+ * for reading and writing. Collections are stored as their size and element
+ * width followed by the raw element data, so elements must be trivially
+ * copyable: this holds for all collection groups since they're copied
+ * directly to device memory.
+ */
+class CollectionWriter
+{
+  public:
+    // Write a host collection
+    template<class T, class I>
+    inline void
+    operator()(const Collection<T, Ownership::value, MemSpace::host, I>& col);
+
+    // Write a trivially copyable value
+    template<class T>
+    inline void operator()(const T& value);
+
+    //! Access the written data
+    const std::string& bytes() const { return buffer_; }
+
+  private:
+    std::string buffer_;
+
+    inline void write(const void* data, std::size_t size);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Archive for reading host collection groups from a byte buffer.
+ *
+ * Any inconsistency between the buffer and the data being read raises a
+ * RuntimeError.
+ */
+class CollectionReader
+{
+  public:
+    // Construct with a buffer that must outlive this reader
+    explicit inline CollectionReader(const std::string& bytes);
+
+    // Read a host collection
+    template<class T, class I>
+    inline void
+    operator()(Collection<T, Ownership::value, MemSpace::host, I>& col);
+
+    // Read a trivially copyable value
+    template<class T>
+    inline void operator()(T& value);
+
+    //! Whether the entire buffer has been read
+    bool done() const { return pos_ == bytes_.size(); }
+
+  private:
+    const std::string& bytes_;
+    std::size_t        pos_ = 0;
+
+    inline void read(void* data, std::size_t size);
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Save a host collection group to a cache file
+template<class D>
+inline void save_collection_cache(const std::string& filename,
+                                  std::uint64_t      key,
+                                  const D&           data);
+
+// Load a host collection group from a cache file if it matches the key
+template<class D>
+inline bool load_collection_cache(const std::string& filename,
+                                  std::uint64_t      key,
+                                  D*                 data);
+
+namespace detail
+{
+// Write a cache file atomically
+void write_cache_file(const std::string& filename,
+                      std::uint64_t      key,
+                      const std::string& payload);
+
+// Read the payload of a cache file if it exists and matches the key
+bool read_cache_file(const std::string& filename,
+                     std::uint64_t      key,
+                     std::string*       payload);
+} // namespace detail
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "CollectionCache.i.hh"
@@ -0,0 +1,222 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CollectionCache.i.hh
+//---------------------------------------------------------------------------//
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "Assert.hh"
+#include "CollectionBuilder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// HASH BUILDER
+//---------------------------------------------------------------------------//
+/*!
+ * Add raw bytes to the hash.
+ */
+void HashBuilder::operator()(const void* data, std::size_t size)
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        hash_ ^= bytes[i];
+        hash_ *= 0x100000001b3ull;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add a string, including its length so that adjacent strings are distinct.
+ */
+void HashBuilder::operator()(const std::string& str)
+{
+    (*this)(static_cast<std::uint64_t>(str.size()));
+    (*this)(str.data(), str.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add a trivially copyable value.
+ *
+ * The value should not contain padding, since its contents are undefined.
+ */
+template<class T>
+void HashBuilder::operator()(const T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values can be hashed");
+    (*this)(&value, sizeof(T));
+}
+
+//---------------------------------------------------------------------------//
+// COLLECTION WRITER
+//---------------------------------------------------------------------------//
+/*!
+ * Write a host collection.
+ */
+template<class T, class I>
+void CollectionWriter::operator()(
+    const Collection<T, Ownership::value, MemSpace::host, I>& col)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Collection elements must be trivially copyable");
+    (*this)(static_cast<std::uint64_t>(col.size()));
+    (*this)(static_cast<std::uint32_t>(sizeof(T)));
+    if (!col.empty())
+    {
+        auto items = col[AllItems<T, MemSpace::host>{}];
+        this->write(items.data(), items.size() * sizeof(T));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a trivially copyable value.
+ */
+template<class T>
+void CollectionWriter::operator()(const T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values can be written");
+    this->write(&value, sizeof(T));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Append bytes to the buffer.
+ */
+void CollectionWriter::write(const void* data, std::size_t size)
+{
+    buffer_.append(static_cast<const char*>(data), size);
+}
+
+//---------------------------------------------------------------------------//
+// COLLECTION READER
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a buffer that must outlive this reader.
+ */
+CollectionReader::CollectionReader(const std::string& bytes) : bytes_(bytes)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a host collection.
+ */
+template<class T, class I>
+void CollectionReader::operator()(
+    Collection<T, Ownership::value, MemSpace::host, I>& col)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Collection elements must be trivially copyable");
+    CELER_EXPECT(col.empty());
+
+    std::uint64_t size;
+    std::uint32_t width;
+    (*this)(size);
+    (*this)(width);
+    CELER_VALIDATE(width == sizeof(T),
+                   << "cached collection element size " << width
+                   << " does not match expected size " << sizeof(T));
+    CELER_VALIDATE(size <= (bytes_.size() - pos_) / sizeof(T),
+                   << "cached collection size " << size
+                   << " exceeds the remaining data");
+    if (size > 0)
+    {
+        make_builder(&col).resize(size);
+        auto items = col[AllItems<T, MemSpace::host>{}];
+        this->read(items.data(), items.size() * sizeof(T));
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read a trivially copyable value.
+ */
+template<class T>
+void CollectionReader::operator()(T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable values can be read");
+    this->read(&value, sizeof(T));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy bytes out of the buffer.
+ */
+void CollectionReader::read(void* data, std::size_t size)
+{
+    CELER_VALIDATE(size <= bytes_.size() - pos_,
+                   << "unexpected end of cached data");
+    std::memcpy(data, bytes_.data() + pos_, size);
+    pos_ += size;
+}
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Save a host collection group to a cache file.
+ *
+ * The key should be a hash of all the inputs used to construct the data. The
+ * file is written to a temporary path and moved into place so that
+ * concurrent jobs never see a partially written cache.
+ */
+template<class D>
+void save_collection_cache(const std::string& filename,
+                           std::uint64_t      key,
+                           const D&           data)
+{
+    CELER_EXPECT(!filename.empty());
+    CELER_EXPECT(data);
+
+    CollectionWriter write;
+    // The serialize function is shared with the reader so it takes a mutable
+    // reference, but the writer never modifies the data
+    serialize(write, const_cast<D&>(data));
+    detail::write_cache_file(filename, key, write.bytes());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load a host collection group from a cache file if it matches the key.
+ *
+ * \return Whether the cache existed and matched the key. If not, the data is
+ * unmodified.
+ */
+template<class D>
+bool load_collection_cache(const std::string& filename,
+                           std::uint64_t      key,
+                           D*                 data)
+{
+    CELER_EXPECT(!filename.empty());
+    CELER_EXPECT(data);
+
+    std::string payload;
+    if (!detail::read_cache_file(filename, key, &payload))
+    {
+        return false;
+    }
+
+    D                result;
+    CollectionReader read(payload);
+    serialize(read, result);
+    CELER_VALIDATE(read.done(),
+                   << "cache file '" << filename
+                   << "' contains more data than expected");
+    CELER_VALIDATE(result,
+                   << "cache file '" << filename
+                   << "' contains invalid data");
+    *data = std::move(result);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
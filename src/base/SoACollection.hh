@@ -0,0 +1,209 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SoACollection.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <type_traits>
+#include "Array.hh"
+#include "Collection.hh"
+#include "detail/SoAReference.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//! Memory layout of fixed-size vector items in a collection
+enum class VectorLayout
+{
+    aos, //!< Array of structs: Collection<Array<T, N>>
+    soa  //!< Struct of arrays: SoACollection<T, N>
+};
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Element access types for an SoA collection
+template<class T, size_type N, Ownership W>
+struct SoACollectionTraits
+{
+    using reference_type       = SoAReference<T, N>;
+    using const_reference_type = Array<T, N>;
+};
+
+template<class T, size_type N>
+struct SoACollectionTraits<T, N, Ownership::reference>
+{
+    using reference_type       = SoAReference<T, N>;
+    using const_reference_type = SoAReference<T, N>;
+};
+
+template<class T, size_type N>
+struct SoACollectionTraits<T, N, Ownership::const_reference>
+{
+    using reference_type       = Array<T, N>;
+    using const_reference_type = Array<T, N>;
+};
+} // namespace detail
+
+//---------------------------------------------------------------------------//
+/*!
+ * Store fixed-size vectors (e.g. \c Real3) as one collection per component.
+ *
+ * This is a drop-in replacement for \c Collection<Array<T,N>> in state data
+ * where most loops touch only one component of many tracks: each component
+ * is contiguous so host loops over \c component() can auto-vectorize, and
+ * device loads are coalesced. Single elements are accessed through a proxy
+ * reference (\c detail::SoAReference) that converts to and assigns from
+ * \c Array<T,N>; read-only access returns a copy.
+ *
+ * Ownership, memory space, and assignment semantics are the same as for \c
+ * Collection, and the free function \c resize works on both layouts, so a
+ * state group can select its layout at compile time with \c VectorCollection.
+ *
+ * \code
+    template<Ownership W, MemSpace M>
+    struct MyStateData
+    {
+        static constexpr VectorLayout layout = VectorLayout::soa;
+        Real3StateCollection<layout, W, M> pos;
+    };
+
+    // Vectorizable host loop over z positions
+    for (real_type& z : states.pos.component(2))
+        z += delta;
+   \endcode
+ */
+template<class T,
+         size_type N,
+         Ownership W,
+         MemSpace  M,
+         class I = ItemId<Array<T, N>>>
+class SoACollection
+{
+    using TraitsT = detail::SoACollectionTraits<T, N, W>;
+
+  public:
+    //!@{
+    //! Type aliases
+    using value_type           = Array<T, N>;
+    using ComponentT           = Collection<T, W, M, I>;
+    using SpanT                = typename ComponentT::SpanT;
+    using SpanConstT           = typename ComponentT::SpanConstT;
+    using reference_type       = typename TraitsT::reference_type;
+    using const_reference_type = typename TraitsT::const_reference_type;
+    using size_type            = typename I::size_type;
+    using ItemIdT              = I;
+    //!@}
+
+  public:
+    //// CONSTRUCTION ////
+
+    //!@{
+    //! Default constructors
+    SoACollection()                     = default;
+    SoACollection(const SoACollection&) = default;
+    SoACollection(SoACollection&&)      = default;
+    //!@}
+
+    //!@{
+    //! Default assignment
+    SoACollection& operator=(const SoACollection&) = default;
+    SoACollection& operator=(SoACollection&&) = default;
+    //!@}
+
+    // Assign from another collection
+    template<Ownership W2, MemSpace M2>
+    inline SoACollection&
+    operator=(const SoACollection<T, N, W2, M2, I>& other);
+
+    // Assign (mutable!) from another collection
+    template<Ownership W2, MemSpace M2>
+    inline SoACollection& operator=(SoACollection<T, N, W2, M2, I>& other);
+
+    //// ACCESS ////
+
+    // Access a single element
+    inline CELER_FUNCTION reference_type       operator[](ItemIdT i);
+    inline CELER_FUNCTION const_reference_type operator[](ItemIdT i) const;
+
+    // Access a single component of all elements
+    inline CELER_FUNCTION SpanT      component(size_type d);
+    inline CELER_FUNCTION SpanConstT component(size_type d) const;
+
+    //! Number of elements
+    CELER_CONSTEXPR_FUNCTION size_type size() const
+    {
+        return components_[0].size();
+    }
+
+    //! Whether the collection is unassigned
+    CELER_CONSTEXPR_FUNCTION bool empty() const
+    {
+        return components_[0].empty();
+    }
+
+  private:
+    //// DATA ////
+
+    Array<ComponentT, N> components_{};
+
+    //// HELPER FUNCTIONS ////
+
+    template<class C>
+    static inline CELER_FUNCTION value_type load(C&          components,
+                                                 ItemIdT     i,
+                                                 value_type* tag);
+
+    template<class C>
+    static inline CELER_FUNCTION detail::SoAReference<T, N>
+    load(C& components, ItemIdT i, detail::SoAReference<T, N>* tag);
+
+    //// FRIENDS ////
+
+    template<class T2, size_type N2, Ownership W2, MemSpace M2, class I2>
+    friend class SoACollection;
+
+    template<class T2, size_type N2, MemSpace M2, class I2>
+    friend void resize(SoACollection<T2, N2, Ownership::value, M2, I2>*,
+                       typename I2::size_type);
+};
+
+//---------------------------------------------------------------------------//
+//! SoA collection indexed by ThreadId for use in States
+template<class T, size_type N, Ownership W, MemSpace M>
+using StateSoACollection = SoACollection<T, N, W, M, ThreadId>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Select the storage layout of a collection of fixed-size vectors.
+ */
+template<VectorLayout L,
+         class T,
+         size_type N,
+         Ownership W,
+         MemSpace  M,
+         class I = ItemId<Array<T, N>>>
+using VectorCollection
+    = std::conditional_t<L == VectorLayout::soa,
+                         SoACollection<T, N, W, M, I>,
+                         Collection<Array<T, N>, W, M, I>>;
+
+//! Collection of Real3 indexed by ThreadId with a selectable layout
+template<VectorLayout L, Ownership W, MemSpace M>
+using Real3StateCollection = VectorCollection<L, real_type, 3, W, M, ThreadId>;
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Resize all components of an SoA collection
+template<class T, size_type N, MemSpace M, class I>
+inline void resize(SoACollection<T, N, Ownership::value, M, I>* collection,
+                   typename I::size_type                         size);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "SoACollection.i.hh"
@@ -0,0 +1,151 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SoACollection.i.hh
+//---------------------------------------------------------------------------//
+#include "base/Assert.hh"
+#include "CollectionBuilder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//!@{
+/*!
+ * Assign from another collection.
+ *
+ * Each component is assigned with the semantics of \c Collection assignment.
+ */
+template<class T, size_type N, Ownership W, MemSpace M, class I>
+template<Ownership W2, MemSpace M2>
+SoACollection<T, N, W, M, I>& SoACollection<T, N, W, M, I>::operator=(
+    const SoACollection<T, N, W2, M2, I>& other)
+{
+    for (size_type d = 0; d != N; ++d)
+    {
+        components_[d] = other.components_[d];
+    }
+    return *this;
+}
+
+template<class T, size_type N, Ownership W, MemSpace M, class I>
+template<Ownership W2, MemSpace M2>
+SoACollection<T, N, W, M, I>&
+SoACollection<T, N, W, M, I>::operator=(SoACollection<T, N, W2, M2, I>& other)
+{
+    for (size_type d = 0; d != N; ++d)
+    {
+        components_[d] = other.components_[d];
+    }
+    return *this;
+}
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access a single element.
+ */
+template<class T, size_type N, Ownership W, MemSpace M, class I>
+CELER_FUNCTION auto SoACollection<T, N, W, M, I>::operator[](ItemIdT i)
+    -> reference_type
+{
+    CELER_EXPECT(i < this->size());
+    return load(components_, i, static_cast<reference_type*>(nullptr));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access a single element (const).
+ */
+template<class T, size_type N, Ownership W, MemSpace M, class I>
+CELER_FUNCTION auto SoACollection<T, N, W, M, I>::operator[](ItemIdT i) const
+    -> const_reference_type
+{
+    CELER_EXPECT(i < this->size());
+    return load(components_, i, static_cast<const_reference_type*>(nullptr));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access a single component of all elements.
+ */
+template<class T, size_type N, Ownership W, MemSpace M, class I>
+CELER_FUNCTION auto SoACollection<T, N, W, M, I>::component(size_type d)
+    -> SpanT
+{
+    CELER_EXPECT(d < N);
+    return components_[d][AllItems<T, M>{}];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access a single component of all elements (const).
+ */
+template<class T, size_type N, Ownership W, MemSpace M, class I>
+CELER_FUNCTION auto SoACollection<T, N, W, M, I>::component(size_type d) const
+    -> SpanConstT
+{
+    CELER_EXPECT(d < N);
+    return components_[d][AllItems<T, M>{}];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the components of a single element.
+ */
+template<class T, size_type N, Ownership W, MemSpace M, class I>
+template<class C>
+CELER_FUNCTION auto
+SoACollection<T, N, W, M, I>::load(C& components, ItemIdT i, value_type*)
+    -> value_type
+{
+    value_type result;
+    for (size_type d = 0; d != N; ++d)
+    {
+        result[d] = components[d][i];
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a proxy reference to a single element.
+ */
+template<class T, size_type N, Ownership W, MemSpace M, class I>
+template<class C>
+CELER_FUNCTION auto
+SoACollection<T, N, W, M, I>::load(C&                          components,
+                                   ItemIdT                     i,
+                                   detail::SoAReference<T, N>*)
+    -> detail::SoAReference<T, N>
+{
+    Array<T*, N> ptrs;
+    for (size_type d = 0; d != N; ++d)
+    {
+        ptrs[d] = &components[d][i];
+    }
+    return detail::SoAReference<T, N>{ptrs};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resize all components of an SoA collection.
+ *
+ * This is the analog of \c resize for a single \c Collection, so state
+ * groups can allocate either layout with the same code.
+ */
+template<class T, size_type N, MemSpace M, class I>
+void resize(SoACollection<T, N, Ownership::value, M, I>* collection,
+            typename I::size_type                         size)
+{
+    CELER_EXPECT(collection);
+    CELER_EXPECT(size > 0);
+    for (size_type d = 0; d != N; ++d)
+    {
+        resize(&collection->components_[d], size);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -85,6 +85,28 @@ namespace celeritas
  * These separate kernel launches are needed as grid-level synchronization
  * points.
  *
+ * On host, many threads allocating one item at a time contend on the single
+ * shared size counter. An allocator constructed with a nonzero \c chunk_size
+ * instead reserves blocks of that many slots and hands them out locally, so
+ * that each host thread should own a single chunked allocator for the
+ * duration of a parallel loop:
+ * \code
+ #pragma omp parallel
+ {
+     StackAllocator<Secondary> allocate(ptrs, 64);
+     #pragma omp for
+     for (size_type i = 0; i < num_tracks; ++i)
+     {
+         Interactor interact(..., allocate);
+         ...
+     }
+ }
+ * \endcode
+ * Slots left unused at the end of a thread's last chunk remain
+ * default-constructed in the stack, so chunked allocation should only be used
+ * for types (such as \c Secondary) whose default value is a valid "empty"
+ * entry.
+ *
  * \todo Instead of returning a pointer, return IdRange<T>. Rename
  * StackAllocatorData to StackAllocation and have it look like a collection so
  * that *it* will provide access to the data. Better yet, have a
@@ -108,6 +130,10 @@ class StackAllocator
     // Construct with shared data
     explicit inline CELER_FUNCTION StackAllocator(const Pointers& data);
 
+    // Construct with shared data, reserving slots in chunks
+    inline CELER_FUNCTION
+    StackAllocator(const Pointers& data, size_type chunk_size);
+
     // Total storage capacity (always safe)
     inline CELER_FUNCTION size_type capacity() const;
 
@@ -133,8 +159,16 @@ class StackAllocator
   private:
     const Pointers& data_;
 
+    // Thread-local chunk of reserved slots
+    size_type   chunk_size_{0};
+    value_type* chunk_begin_{nullptr};
+    value_type* chunk_end_{nullptr};
+
     //// HELPER FUNCTIONS ////
 
+    // Allocate directly from the shared stack
+    inline CELER_FUNCTION result_type allocate_shared(size_type count);
+
     using SizeId    = ItemId<size_type>;
     using StorageId = ItemId<T>;
     static CELER_CONSTEXPR_FUNCTION SizeId size_id() { return SizeId{0}; }
@@ -6,6 +6,7 @@
 //! \file StackAllocator.i.hh
 //---------------------------------------------------------------------------//
 #include <new>
+#include "Algorithms.hh"
 #include "Atomics.hh"
 
 namespace celeritas
@@ -21,6 +22,22 @@ CELER_FUNCTION StackAllocator<T>::StackAllocator(const Pointers& shared)
     CELER_EXPECT(shared);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a chunk size for thread-local reservations.
+ *
+ * Each time the current chunk is exhausted, a new block of \c chunk_size
+ * slots (or the requested count, if larger) is reserved from the shared stack.
+ */
+template<class T>
+CELER_FUNCTION
+StackAllocator<T>::StackAllocator(const Pointers& shared, size_type chunk_size)
+    : data_(shared), chunk_size_(chunk_size)
+{
+    CELER_EXPECT(shared);
+    CELER_EXPECT(chunk_size > 0);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the maximum number of values that can be allocated.
@@ -45,6 +62,7 @@ template<class T>
 CELER_FUNCTION void StackAllocator<T>::clear()
 {
     data_.size[this->size_id()] = 0;
+    chunk_begin_ = chunk_end_ = nullptr;
 }
 
 //---------------------------------------------------------------------------//
@@ -52,7 +70,10 @@ CELER_FUNCTION void StackAllocator<T>::clear()
  * Allocate space for a given number of items.
  *
  * Returns NULL if allocation failed due to out-of-memory. Ensures that the
- * shared size reflects the amount of data allocated.
+ * shared size reflects the amount of data allocated. In chunked mode the
+ * items come from the thread-local chunk when possible; a request that
+ * doesn't fit in a partially used chunk is allocated directly from the shared
+ * stack.
  */
 template<class T>
 CELER_FUNCTION auto StackAllocator<T>::operator()(size_type count)
@@ -60,8 +81,54 @@ CELER_FUNCTION auto StackAllocator<T>::operator()(size_type count)
 {
     CELER_EXPECT(count > 0);
 
+    if (chunk_size_ == 0)
+    {
+        return this->allocate_shared(count);
+    }
+
+    size_type remaining = chunk_end_ - chunk_begin_;
+    if (remaining < count)
+    {
+        if (remaining > 0)
+        {
+            // Keep the rest of the current chunk for later allocations so
+            // that only the end of the last chunk is ever left unused
+            return this->allocate_shared(count);
+        }
+
+        // Reserve a new chunk
+        size_type   reserve = celeritas::max(count, chunk_size_);
+        value_type* chunk   = this->allocate_shared(reserve);
+        if (!chunk && reserve > count)
+        {
+            // Not enough room for a full chunk: try for just this allocation
+            reserve = count;
+            chunk   = this->allocate_shared(reserve);
+        }
+        if (!chunk)
+        {
+            return nullptr;
+        }
+        chunk_begin_ = chunk;
+        chunk_end_   = chunk + reserve;
+    }
+
+    value_type* result = chunk_begin_;
+    chunk_begin_ += count;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate space in the shared stack.
+ */
+template<class T>
+CELER_FUNCTION auto StackAllocator<T>::allocate_shared(size_type count)
+    -> result_type
+{
     // Atomic add 'count' to the shared size
-    size_type start = atomic_add(&data_.size[this->size_id()], count);
+    size_type start = atomic_add(
+        &data_.size[this->size_id()], count, MemoryOrder::relaxed);
     if (CELER_UNLIKELY(start + count > data_.storage.size()))
     {
         // Out of memory: restore the old value so that another thread can
@@ -76,8 +143,10 @@ CELER_FUNCTION auto StackAllocator<T>::operator()(size_type count)
             // allocate. Restore the actual allocated size to the start value.
             // This might allow another thread with a smaller allocation to
             // succeed, but it also guarantees that at the end of the kernel,
-            // the size reflects the actual capacity.
-            data_.size[this->size_id()] = start;
+            // the size reflects the actual capacity. The store must be
+            // atomic since other threads may still be adding to the size.
+            atomic_exchange(
+                &data_.size[this->size_id()], start, MemoryOrder::relaxed);
         }
 
         // TODO It might be useful to set an "out of memory" flag to make it
@@ -56,5 +56,13 @@ enum class Ownership
     const_reference, //!< Immutable reference to the data
 };
 
+//! Memory ordering of host atomic operations (device atomics are relaxed)
+enum class MemoryOrder
+{
+    relaxed, //!< No synchronization: only atomicity is guaranteed
+    acq_rel, //!< Acquire on read, release on write
+    seq_cst, //!< Single total order of all sequentially consistent ops
+};
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -0,0 +1,124 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AtomicsImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <type_traits>
+#include "../Types.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// HOST ATOMICS
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a memory order to a GCC/Clang atomic builtin constant.
+ */
+inline constexpr int to_builtin(MemoryOrder order)
+{
+    return order == MemoryOrder::relaxed
+               ? __ATOMIC_RELAXED
+               : order == MemoryOrder::acq_rel ? __ATOMIC_ACQ_REL
+                                               : __ATOMIC_SEQ_CST;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Memory order for the load side of a failed compare-exchange.
+ *
+ * The failure ordering cannot contain a release.
+ */
+inline constexpr int to_builtin_failure(MemoryOrder order)
+{
+    return order == MemoryOrder::relaxed
+               ? __ATOMIC_RELAXED
+               : order == MemoryOrder::acq_rel ? __ATOMIC_ACQUIRE
+                                               : __ATOMIC_SEQ_CST;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Atomically replace a value with op(old), returning the old value.
+ *
+ * This compare-and-swap loop works for any trivially copyable type,
+ * including floating point values which have no native fetch-add builtin.
+ */
+template<class T, class F>
+inline T host_atomic_update(T* address, F op, MemoryOrder order)
+{
+    T expected;
+    __atomic_load(address, &expected, __ATOMIC_RELAXED);
+    T desired = op(expected);
+    while (!__atomic_compare_exchange(address,
+                                      &expected,
+                                      &desired,
+                                      /* weak = */ true,
+                                      to_builtin(order),
+                                      to_builtin_failure(order)))
+    {
+        // 'expected' was updated with the current value
+        desired = op(expected);
+    }
+    return expected;
+}
+
+//---------------------------------------------------------------------------//
+//!@{
+//! Add to a value on host, returning the original value.
+template<class T>
+inline typename std::enable_if<std::is_integral<T>::value, T>::type
+host_atomic_add(T* address, T value, MemoryOrder order)
+{
+    return __atomic_fetch_add(address, value, to_builtin(order));
+}
+
+template<class T>
+inline typename std::enable_if<!std::is_integral<T>::value, T>::type
+host_atomic_add(T* address, T value, MemoryOrder order)
+{
+    return host_atomic_update(
+        address, [value](T old) { return old + value; }, order);
+}
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the value to the minimum of the actual and given, returning old.
+ */
+template<class T>
+inline T host_atomic_min(T* address, T value, MemoryOrder order)
+{
+    return host_atomic_update(
+        address, [value](T old) { return value < old ? value : old; }, order);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Set the value to the maximum of the actual and given, returning old.
+ */
+template<class T>
+inline T host_atomic_max(T* address, T value, MemoryOrder order)
+{
+    return host_atomic_update(
+        address, [value](T old) { return old < value ? value : old; }, order);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Replace the value on host, returning the original value.
+ */
+template<class T>
+inline T host_atomic_exchange(T* address, T value, MemoryOrder order)
+{
+    return __atomic_exchange_n(address, value, to_builtin(order));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,85 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SoAReference.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Array.hh"
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Proxy reference to a single element of a structure-of-arrays collection.
+ *
+ * This acts like an \c Array<T,N>& whose components are stored in N separate
+ * arrays: it converts to a value, assigns a value to all components, and
+ * gives mutable access to individual components. Like other proxy references
+ * (e.g. \c std::vector<bool>::reference) it can't be bound to a \c T& so
+ * long-lived references to the element must be replaced with copies.
+ */
+template<class T, size_type N>
+class SoAReference
+{
+  public:
+    //!@{
+    //! Type aliases
+    using value_type = Array<T, N>;
+    using Pointers   = Array<T*, N>;
+    //!@}
+
+  public:
+    //! Construct with pointers to each component
+    explicit CELER_FUNCTION SoAReference(const Pointers& ptrs) : ptrs_(ptrs)
+    {
+    }
+
+    //! Copy the referenced components into a value
+    CELER_FUNCTION operator value_type() const
+    {
+        value_type result;
+        for (size_type i = 0; i != N; ++i)
+        {
+            result[i] = *ptrs_[i];
+        }
+        return result;
+    }
+
+    //! Assign all components from a value
+    CELER_FUNCTION SoAReference& operator=(const value_type& value)
+    {
+        for (size_type i = 0; i != N; ++i)
+        {
+            *ptrs_[i] = value[i];
+        }
+        return *this;
+    }
+
+    //! Assign all components from another element (value semantics)
+    CELER_FUNCTION SoAReference& operator=(const SoAReference& other)
+    {
+        return *this = static_cast<value_type>(other);
+    }
+
+    //! Access a single component
+    CELER_FUNCTION T& operator[](size_type i) const
+    {
+        CELER_EXPECT(i < N);
+        return *ptrs_[i];
+    }
+
+  private:
+    Pointers ptrs_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,134 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EventDistributor.cc
+//---------------------------------------------------------------------------//
+#include "EventDistributor.hh"
+
+#include <algorithm>
+#include "celeritas_config.h"
+#if CELERITAS_USE_MPI
+#    include <mpi.h>
+#endif
+
+#include "base/Assert.hh"
+#include "Logger.hh"
+#include "Operations.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Rank that owns the shared counter
+constexpr int counter_rank = 0;
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct collectively with the total number of events and batch size.
+ *
+ * The counter lives in an MPI window on rank 0 (the other ranks expose no
+ * memory). A shared passive-target epoch is opened for the lifetime of this
+ * object so that each request is a single fetch-and-add plus flush.
+ */
+EventDistributor::EventDistributor(const Communicator& comm,
+                                   size_type           num_events,
+                                   size_type           batch_size)
+    : comm_(comm), num_events_(num_events), batch_size_(batch_size)
+{
+    CELER_EXPECT(batch_size_ > 0);
+
+    if (!comm_)
+        return;
+
+#if CELERITAS_USE_MPI
+    counter_type* counter = nullptr;
+    MPI_Aint      num_bytes
+        = (comm_.rank() == counter_rank ? sizeof(counter_type) : 0);
+    CELER_MPI_CALL(MPI_Win_allocate(num_bytes,
+                                    sizeof(counter_type),
+                                    MPI_INFO_NULL,
+                                    comm_.mpi_comm(),
+                                    &counter,
+                                    &win_));
+    if (comm_.rank() == counter_rank)
+    {
+        *counter = 0;
+    }
+    CELER_MPI_CALL(MPI_Win_lock_all(MPI_MODE_NOCHECK, win_));
+    CELER_MPI_CALL(MPI_Win_sync(win_));
+#endif
+
+    // Nobody may claim events until the counter is initialized
+    barrier(comm_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Release the shared counter collectively.
+ *
+ * Errors are logged rather than thrown since the destructor can't propagate
+ * exceptions.
+ */
+EventDistributor::~EventDistributor()
+{
+    if (!comm_)
+        return;
+
+#if CELERITAS_USE_MPI
+    try
+    {
+        CELER_MPI_CALL(MPI_Win_unlock_all(win_));
+        CELER_MPI_CALL(MPI_Win_free(&win_));
+    }
+    catch (const std::exception& e)
+    {
+        CELER_LOG_LOCAL(error)
+            << "Failed to release event distributor counter: " << e.what();
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Claim the next batch of events.
+ *
+ * The last batch may be smaller than the batch size, and once all events have
+ * been claimed an empty range is returned.
+ */
+auto EventDistributor::operator()() -> BatchRange
+{
+    counter_type begin = local_counter_;
+    if (comm_)
+    {
+#if CELERITAS_USE_MPI
+        const counter_type increment = batch_size_;
+        CELER_MPI_CALL(
+            MPI_Fetch_and_op(&increment,
+                             &begin,
+                             detail::MpiType<counter_type>::get(),
+                             counter_rank,
+                             0,
+                             MPI_SUM,
+                             win_));
+        CELER_MPI_CALL(MPI_Win_flush(counter_rank, win_));
+#endif
+    }
+    else
+    {
+        local_counter_ += batch_size_;
+    }
+
+    begin                  = std::min<counter_type>(begin, num_events_);
+    const counter_type end = std::min<counter_type>(begin + batch_size_,
+                                                    num_events_);
+    return {static_cast<size_type>(begin), static_cast<size_type>(end)};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
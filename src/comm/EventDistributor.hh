@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EventDistributor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Range.hh"
+#include "base/Types.hh"
+#include "Communicator.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Hand out batches of events to the processes of a communicator on request.
+ *
+ * The index of the next unclaimed event is a single counter stored on rank 0
+ * and accessed with one-sided atomic fetch-and-add operations, so a process
+ * that finishes its batch early immediately claims another without waiting
+ * for (or interrupting) the others. The total work is thus balanced even when
+ * the cost per event varies widely. Every event in [0, num_events) is
+ * returned to exactly one process.
+ *
+ * Construction and destruction are collective over the communicator. With a
+ * null communicator the batches are handed out sequentially without MPI.
+ *
+ * \code
+    EventDistributor next_batch(comm, num_events, 16);
+    for (auto batch = next_batch(); !batch.empty(); batch = next_batch())
+    {
+        for (size_type event : batch)
+        {
+            ...
+        }
+    }
+   \endcode
+ */
+class EventDistributor
+{
+  public:
+    //!@{
+    //! Type aliases
+    using BatchRange = Range<size_type>;
+    //!@}
+
+  public:
+    // Construct collectively with the total number of events and batch size
+    EventDistributor(const Communicator& comm,
+                     size_type           num_events,
+                     size_type           batch_size);
+
+    // Release the shared counter collectively
+    ~EventDistributor();
+
+    //!@{
+    //! Prevent copying and moving: the shared counter is a collective object
+    EventDistributor(const EventDistributor&) = delete;
+    EventDistributor& operator=(const EventDistributor&) = delete;
+    //!@}
+
+    // Claim the next batch of events, empty if all have been claimed
+    BatchRange operator()();
+
+    //! Total number of events
+    size_type num_events() const { return num_events_; }
+
+    //! Maximum number of events in a batch
+    size_type batch_size() const { return batch_size_; }
+
+  private:
+    using counter_type = unsigned long long;
+
+    Communicator   comm_;
+    size_type      num_events_;
+    size_type      batch_size_;
+    counter_type   local_counter_{0};
+    detail::MpiWin win_ = detail::MpiWinNull();
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
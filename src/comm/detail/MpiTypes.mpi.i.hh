@@ -29,6 +29,13 @@ inline MpiComm MpiCommSelf()
     return MPI_COMM_SELF;
 }
 
+using MpiWin = MPI_Win;
+
+inline MpiWin MpiWinNull()
+{
+    return MPI_WIN_NULL;
+}
+
 template<class T>
 struct MpiType;
 
@@ -0,0 +1,77 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file DormandPrinceStepper.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+
+#include "FieldInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Integrate with the Dormand-Prince 5(4) embedded Runge-Kutta pair.
+ *
+ * The fifth-order solution is propagated and its difference from the
+ * embedded fourth-order solution is the truncation error, so no step
+ * doubling is needed. The mid-step state for the chord test is from the
+ * fourth-order continuous extension of Shampine (1986), which reuses the
+ * same stages.
+ *
+ * The last stage is evaluated at the end state ("first same as last"). The
+ * stepper keeps it, so when the next step starts where this one ended (i.e.
+ * the step was accepted) only six new equation evaluations are needed,
+ * compared to eleven for \c RungeKuttaStepper . The first stage is also
+ * kept so that retrying a rejected step with a shorter length from the same
+ * state costs six evaluations.
+ *
+ * This is a drop-in replacement for \c RungeKuttaStepper . Because of the
+ * saved stages, a stepper instance should be used by a single track.
+ */
+template<class FieldEquation_T>
+class DormandPrinceStepper
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Result = StepperResult;
+    //!@}
+
+  public:
+    //! Construct with the equation of motion
+    CELER_FUNCTION
+    DormandPrinceStepper(const FieldEquation_T& eq) : equation_(eq) {}
+
+    // Integrate one step with an error estimate
+    inline CELER_FUNCTION auto
+    operator()(real_type step, const OdeState& beg_state) -> Result;
+
+  private:
+    //// DATA ////
+
+    // Equation of motion
+    const FieldEquation_T& equation_;
+
+    // Start and end states of the last step, and the slopes there
+    OdeState last_beg_state_;
+    OdeState last_beg_slope_;
+    OdeState last_end_state_;
+    OdeState last_end_slope_;
+    bool     has_last_{false};
+
+    //// HELPER FUNCTIONS ////
+
+    // Evaluate the slope at the start of the step, reusing a saved stage
+    inline CELER_FUNCTION OdeState beg_slope(const OdeState& beg_state);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "DormandPrinceStepper.i.hh"
@@ -0,0 +1,184 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file DormandPrinceStepper.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/ArrayUtils.hh"
+#include "FieldUtils.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Integrate one step with an error estimate.
+ *
+ * With the stages \em k_i evaluated using the Dormand-Prince tableau (J. R.
+ * Dormand and P. J. Prince, J. Comput. Appl. Math. 6, 19-26, 1980), the
+ * fifth-order solution is
+ * \f[
+ *  y_{n+1} = y_n + h \sum_{i=1}^{6} b_i k_i
+ * \f]
+ * and the error is \f$ h \sum_{i=1}^{7} e_i k_i \f$ where \em e is the
+ * difference between the fifth- and fourth-order weights. The seventh stage
+ * is the slope at the end state.
+ */
+template<class T>
+CELER_FUNCTION auto
+DormandPrinceStepper<T>::operator()(real_type step, const OdeState& beg_state)
+    -> Result
+{
+    using celeritas::axpy;
+    using R = real_type;
+
+    // Coefficients of the tableau
+    constexpr R a21 = 1 / R(5);
+
+    constexpr R a31 = 3 / R(40);
+    constexpr R a32 = 9 / R(40);
+
+    constexpr R a41 = 44 / R(45);
+    constexpr R a42 = -56 / R(15);
+    constexpr R a43 = 32 / R(9);
+
+    constexpr R a51 = 19372 / R(6561);
+    constexpr R a52 = -25360 / R(2187);
+    constexpr R a53 = 64448 / R(6561);
+    constexpr R a54 = -212 / R(729);
+
+    constexpr R a61 = 9017 / R(3168);
+    constexpr R a62 = -355 / R(33);
+    constexpr R a63 = 46732 / R(5247);
+    constexpr R a64 = 49 / R(176);
+    constexpr R a65 = -5103 / R(18656);
+
+    // Fifth-order weights (also the seventh row of the tableau)
+    constexpr R b1 = 35 / R(384);
+    constexpr R b3 = 500 / R(1113);
+    constexpr R b4 = 125 / R(192);
+    constexpr R b5 = -2187 / R(6784);
+    constexpr R b6 = 11 / R(84);
+
+    // Difference between the fifth- and fourth-order weights
+    constexpr R e1 = 71 / R(57600);
+    constexpr R e3 = -71 / R(16695);
+    constexpr R e4 = 71 / R(1920);
+    constexpr R e5 = -17253 / R(339200);
+    constexpr R e6 = 22 / R(525);
+    constexpr R e7 = -1 / R(40);
+
+    // Continuous extension weights at the mid-step
+    constexpr R m1 = 6025192743 / R(30085553152);
+    constexpr R m3 = 51252292925 / R(65400821598);
+    constexpr R m4 = -2691868925 / R(45128329728);
+    constexpr R m5 = 187940372067 / R(1594534317056);
+    constexpr R m6 = -1776094331 / R(19743644256);
+    constexpr R m7 = 11237099 / R(235043384);
+
+    // Evaluate the stages
+    OdeState k1 = this->beg_slope(beg_state);
+
+    OdeState y = beg_state;
+    axpy(a21 * step, k1, &y);
+    OdeState k2 = equation_(y);
+
+    y = beg_state;
+    axpy(a31 * step, k1, &y);
+    axpy(a32 * step, k2, &y);
+    OdeState k3 = equation_(y);
+
+    y = beg_state;
+    axpy(a41 * step, k1, &y);
+    axpy(a42 * step, k2, &y);
+    axpy(a43 * step, k3, &y);
+    OdeState k4 = equation_(y);
+
+    y = beg_state;
+    axpy(a51 * step, k1, &y);
+    axpy(a52 * step, k2, &y);
+    axpy(a53 * step, k3, &y);
+    axpy(a54 * step, k4, &y);
+    OdeState k5 = equation_(y);
+
+    y = beg_state;
+    axpy(a61 * step, k1, &y);
+    axpy(a62 * step, k2, &y);
+    axpy(a63 * step, k3, &y);
+    axpy(a64 * step, k4, &y);
+    axpy(a65 * step, k5, &y);
+    OdeState k6 = equation_(y);
+
+    Result result;
+
+    // Fifth-order end state and the slope there
+    result.end_state = beg_state;
+    axpy(b1 * step, k1, &result.end_state);
+    axpy(b3 * step, k3, &result.end_state);
+    axpy(b4 * step, k4, &result.end_state);
+    axpy(b5 * step, k5, &result.end_state);
+    axpy(b6 * step, k6, &result.end_state);
+    OdeState k7 = equation_(result.end_state);
+
+    // Error estimate
+    result.err_state = OdeState{};
+    axpy(e1 * step, k1, &result.err_state);
+    axpy(e3 * step, k3, &result.err_state);
+    axpy(e4 * step, k4, &result.err_state);
+    axpy(e5 * step, k5, &result.err_state);
+    axpy(e6 * step, k6, &result.err_state);
+    axpy(e7 * step, k7, &result.err_state);
+
+    // Mid-step state
+    R half_step      = step / 2;
+    result.mid_state = beg_state;
+    axpy(m1 * half_step, k1, &result.mid_state);
+    axpy(m3 * half_step, k3, &result.mid_state);
+    axpy(m4 * half_step, k4, &result.mid_state);
+    axpy(m5 * half_step, k5, &result.mid_state);
+    axpy(m6 * half_step, k6, &result.mid_state);
+    axpy(m7 * half_step, k7, &result.mid_state);
+
+    // Save the first and last stages for the next step
+    last_beg_state_ = beg_state;
+    last_beg_slope_ = k1;
+    last_end_state_ = result.end_state;
+    last_end_slope_ = k7;
+    has_last_       = true;
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Evaluate the slope at the start of the step, reusing a saved stage.
+ *
+ * A saved slope is only reused if this step starts exactly at the start
+ * (the previous step was rejected) or the end (it was accepted) of the
+ * previous step.
+ */
+template<class T>
+CELER_FUNCTION OdeState
+DormandPrinceStepper<T>::beg_slope(const OdeState& beg_state)
+{
+    auto same_state = [](const OdeState& a, const OdeState& b) {
+        return a.pos == b.pos && a.mom == b.mom;
+    };
+
+    if (has_last_)
+    {
+        if (same_state(beg_state, last_end_state_))
+        {
+            return last_end_slope_;
+        }
+        if (same_state(beg_state, last_beg_state_))
+        {
+            return last_beg_slope_;
+        }
+    }
+    return equation_(beg_state);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
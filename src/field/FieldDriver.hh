@@ -10,8 +10,6 @@
 #include "base/Macros.hh"
 #include "base/Types.hh"
 
-#include "RungeKuttaStepper.hh"
-#include "MagFieldEquation.hh"
 #include "FieldParamsPointers.hh"
 #include "FieldInterface.hh"
 
@@ -21,15 +19,19 @@ namespace celeritas
 /*!
  * Integrate with and control the quality of the field integration stepper.
  *
+ * The stepper must provide the \c RungeKuttaStepper interface: called with a
+ * step length and a starting state, it returns the end state, the mid-step
+ * state, and the truncation error as a \c StepperResult .
+ *
  * \note This class is based on G4ChordFinder and G4MagIntegratorDriver.
  */
+template<class StepperT>
 class FieldDriver
 {
   public:
     // Construct with shared data and the stepper
     inline CELER_FUNCTION
-    FieldDriver(const FieldParamsPointers&           shared,
-                RungeKuttaStepper<MagFieldEquation>& stepper);
+    FieldDriver(const FieldParamsPointers& shared, StepperT& stepper);
 
     // For a given trial step, advance by a sub_step within a tolerance error
     inline CELER_FUNCTION real_type operator()(real_type step, OdeState* state);
@@ -54,13 +56,15 @@ class FieldDriver
         return shared_.delta_intersection;
     }
 
+    CELER_FUNCTION bool reuse_safety() const { return shared_.reuse_safety; }
+
   private:
     //// DATA ////
 
     // Shared constant properties
     const FieldParamsPointers& shared_;
     // Stepper for this field driver
-    RungeKuttaStepper<MagFieldEquation>& stepper_;
+    StepperT& stepper_;
 
     //// CONSTANTS ////
 
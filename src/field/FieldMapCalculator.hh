@@ -0,0 +1,79 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldMapCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "FieldMapInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate a tabulated magnetic field at a position.
+ *
+ * The field is linearly interpolated along each axis of the map: trilinear
+ * for a cartesian map, bilinear in (r, z) for a cylindrical map. Positions
+ * outside the map have no field.
+ *
+ * The optional cache stores the last cell found for a track. If the next
+ * position is inside the same cell, the cell search is skipped.
+ *
+ * \code
+    FieldMapCalculator calc_field(field_map);
+    FieldMapCache      cache;
+    Real3 value = calc_field(pos, &cache);
+   \endcode
+ */
+class FieldMapCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using FieldMapPointers
+        = FieldMapData<Ownership::const_reference, MemSpace::native>;
+    //!@}
+
+  public:
+    // Construct from shared field map data
+    explicit inline CELER_FUNCTION
+    FieldMapCalculator(const FieldMapPointers& shared);
+
+    // Calculate the field at a position, updating the track's cache
+    inline CELER_FUNCTION Real3 operator()(const Real3&   pos,
+                                           FieldMapCache* cache) const;
+
+    // Calculate the field at a position
+    inline CELER_FUNCTION Real3 operator()(const Real3& pos) const;
+
+  private:
+    const FieldMapPointers& shared_;
+
+    //// HELPER FUNCTIONS ////
+
+    // Convert a position to grid coordinates
+    inline CELER_FUNCTION Real3 to_grid(const Real3& pos) const;
+
+    // Find the cell containing the grid coordinates
+    inline CELER_FUNCTION bool
+    find_cell(const Real3& coords, FieldMapCache* cell) const;
+
+    // Interpolate the field inside a cell
+    inline CELER_FUNCTION Real3 interpolate(const Real3&         coords,
+                                            const FieldMapCache& cell) const;
+
+    // Convert the field to cartesian components
+    inline CELER_FUNCTION Real3 to_cartesian(const Real3& pos,
+                                             const Real3& coords,
+                                             const Real3& value) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "FieldMapCalculator.i.hh"
@@ -0,0 +1,201 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldMapCalculator.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from shared field map data.
+ */
+CELER_FUNCTION
+FieldMapCalculator::FieldMapCalculator(const FieldMapPointers& shared)
+    : shared_(shared)
+{
+    CELER_EXPECT(shared_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the field at a position, updating the track's cache.
+ */
+CELER_FUNCTION Real3 FieldMapCalculator::operator()(const Real3&   pos,
+                                                    FieldMapCache* cache) const
+{
+    CELER_EXPECT(cache);
+    Real3 coords = this->to_grid(pos);
+
+    bool in_cell = static_cast<bool>(*cache);
+    for (size_type ax = 0; ax != 3 && in_cell; ++ax)
+    {
+        in_cell = coords[ax] >= cache->lower[ax]
+                  && coords[ax] <= cache->upper[ax];
+    }
+    if (!in_cell && !this->find_cell(coords, cache))
+    {
+        // Outside the map
+        return {0, 0, 0};
+    }
+
+    return this->to_cartesian(pos, coords, this->interpolate(coords, *cache));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the field at a position without a cache.
+ */
+CELER_FUNCTION Real3 FieldMapCalculator::operator()(const Real3& pos) const
+{
+    FieldMapCache cache;
+    return (*this)(pos, &cache);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a position to grid coordinates.
+ */
+CELER_FUNCTION Real3 FieldMapCalculator::to_grid(const Real3& pos) const
+{
+    if (shared_.geometry == FieldMapGeometry::cylindrical)
+    {
+        return {std::sqrt(pos[0] * pos[0] + pos[1] * pos[1]), 0, pos[2]};
+    }
+    return pos;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the cell containing the grid coordinates.
+ *
+ * Returns false if the coordinates are outside the map, in which case the
+ * cell is left unchanged. A coordinate on the upper edge of the map belongs
+ * to the last cell.
+ */
+CELER_FUNCTION bool
+FieldMapCalculator::find_cell(const Real3& coords, FieldMapCache* cell) const
+{
+    // Only update the cell once all axes are found so that a failed search
+    // doesn't leave mixed bounds with a stale offset
+    FieldMapCache result;
+    size_type     offset = 0;
+    for (size_type ax = 0; ax != 3; ++ax)
+    {
+        const UniformGridData& grid = shared_.axes[ax];
+        offset *= shared_.axis_size(ax);
+        if (!grid)
+        {
+            // Unused axis of a cylindrical map
+            result.lower[ax] = result.upper[ax] = 0;
+            continue;
+        }
+        if (!(coords[ax] >= grid.front && coords[ax] <= grid.back))
+        {
+            return false;
+        }
+
+        auto bin = static_cast<size_type>((coords[ax] - grid.front)
+                                          / grid.delta);
+        bin      = min(bin, grid.size - 2);
+        offset += bin;
+        result.lower[ax] = grid.front + bin * grid.delta;
+        result.upper[ax] = grid.front + (bin + 1) * grid.delta;
+    }
+    result.offset = offset;
+    *cell         = result;
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interpolate the field inside a cell.
+ *
+ * Each corner of the cell is weighted by the product of the fractional
+ * distances to the opposite faces along each axis.
+ */
+CELER_FUNCTION Real3
+FieldMapCalculator::interpolate(const Real3&         coords,
+                                const FieldMapCache& cell) const
+{
+    // Fractional position and value stride along each axis
+    Real3     frac;
+    size_type stride[3];
+    size_type axis_stride = 1;
+    for (size_type ax = 3; ax-- != 0;)
+    {
+        const UniformGridData& grid = shared_.axes[ax];
+        if (grid)
+        {
+            frac[ax]   = (coords[ax] - cell.lower[ax]) / grid.delta;
+            stride[ax] = axis_stride;
+        }
+        else
+        {
+            frac[ax]   = 0;
+            stride[ax] = 0;
+        }
+        axis_stride *= shared_.axis_size(ax);
+    }
+
+    Real3 result{0, 0, 0};
+    for (size_type corner = 0; corner != 8; ++corner)
+    {
+        real_type weight = 1;
+        size_type offset = cell.offset;
+        for (size_type ax = 0; ax != 3; ++ax)
+        {
+            bool upper = corner & (1u << ax);
+            if (upper && !stride[ax])
+            {
+                // Unused axis: no upper corner
+                weight = 0;
+                break;
+            }
+            weight *= upper ? frac[ax] : 1 - frac[ax];
+            offset += upper ? stride[ax] : 0;
+        }
+        if (weight == 0)
+        {
+            continue;
+        }
+
+        const Real3& value = shared_.values[ItemId<Real3>(offset)];
+        for (size_type d = 0; d != 3; ++d)
+        {
+            result[d] += weight * value[d];
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert the field to cartesian components.
+ */
+CELER_FUNCTION Real3 FieldMapCalculator::to_cartesian(const Real3& pos,
+                                                      const Real3& coords,
+                                                      const Real3& value) const
+{
+    if (shared_.geometry != FieldMapGeometry::cylindrical)
+    {
+        return value;
+    }
+
+    // Rotate (B_r, B_phi) about the z axis; B_r vanishes on the axis
+    real_type r       = coords[0];
+    real_type cos_phi = r > 0 ? pos[0] / r : 1;
+    real_type sin_phi = r > 0 ? pos[1] / r : 0;
+    return {value[0] * cos_phi - value[1] * sin_phi,
+            value[0] * sin_phi + value[1] * cos_phi,
+            value[2]};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,108 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldMapInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Array.hh"
+#include "base/Collection.hh"
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/grid/UniformGridInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Coordinate system of a tabulated field map.
+ *
+ * A cartesian map is tabulated on (x, y, z) with field components
+ * (B_x, B_y, B_z). A cylindrical map is symmetric about the z axis: it is
+ * tabulated on (r, z) with field components (B_r, B_phi, B_z).
+ */
+enum class FieldMapGeometry
+{
+    cartesian,
+    cylindrical
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Persistent shared data for a tabulated magnetic field.
+ *
+ * The three axes are (x, y, z) for a cartesian map and (r, unused, z) for a
+ * cylindrical map, in which case the middle axis is unassigned. Field values
+ * are stored with the last axis varying fastest: value (i, j, k) is at
+ * \c (i * size_1 + j) * size_2 + k where an unassigned axis has size 1.
+ *
+ * \sa FieldMapParams
+ * \sa FieldMapCalculator
+ */
+template<Ownership W, MemSpace M>
+struct FieldMapData
+{
+    template<class T>
+    using Items = Collection<T, W, M>;
+
+    //// DATA ////
+
+    FieldMapGeometry          geometry{FieldMapGeometry::cartesian};
+    Array<UniformGridData, 3> axes;
+    Items<Real3>              values; //!< [axis 0][axis 1][axis 2]
+
+    //// MEMBER FUNCTIONS ////
+
+    //! Number of grid points along an axis (1 if unassigned)
+    CELER_FUNCTION size_type axis_size(size_type ax) const
+    {
+        return axes[ax] ? axes[ax].size : 1;
+    }
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return axes[0] && axes[2]
+               && (geometry == FieldMapGeometry::cylindrical ? !axes[1]
+                                                             : bool(axes[1]))
+               && values.size()
+                      == axis_size(0) * axis_size(1) * axis_size(2);
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    FieldMapData& operator=(const FieldMapData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        geometry = other.geometry;
+        axes     = other.axes;
+        values   = other.values;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Most recently used field map cell of a single track.
+ *
+ * Successive field evaluations of a track (e.g. the sub-steps of a single
+ * Runge-Kutta step) usually land in the same cell, in which case the cell
+ * index is reused rather than recalculated from the grid.
+ */
+struct FieldMapCache
+{
+    size_type offset = static_cast<size_type>(-1); //!< Lower corner value
+    Real3     lower{0, 0, 0}; //!< Grid coordinates of the lower corner
+    Real3     upper{0, 0, 0}; //!< Grid coordinates of the upper corner
+
+    //! True if a cell has been cached
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return offset != static_cast<size_type>(-1);
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
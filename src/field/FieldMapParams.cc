@@ -0,0 +1,48 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldMapParams.cc
+//---------------------------------------------------------------------------//
+#include "FieldMapParams.hh"
+
+#include "base/Assert.hh"
+#include "base/CollectionBuilder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct on both host and device.
+ */
+FieldMapParams::FieldMapParams(const Input& input)
+{
+    const bool is_cyl = input.geometry == FieldMapGeometry::cylindrical;
+    CELER_VALIDATE(input.axes[0] && input.axes[2],
+                   << "invalid field map grid: the first and last axes must "
+                      "have at least two increasing points");
+    CELER_VALIDATE(is_cyl ? !input.axes[1] : bool(input.axes[1]),
+                   << "invalid field map grid: the middle axis must be "
+                   << (is_cyl ? "unassigned for a cylindrical map"
+                              : "assigned for a cartesian map"));
+
+    FieldMapData<Ownership::value, MemSpace::host> host_data;
+    host_data.geometry = input.geometry;
+    host_data.axes     = input.axes;
+
+    size_type num_values = host_data.axis_size(0) * host_data.axis_size(1)
+                           * host_data.axis_size(2);
+    CELER_VALIDATE(input.values.size() == num_values,
+                   << "wrong number of field map values (expected "
+                   << num_values << ", got " << input.values.size() << ")");
+    make_builder(&host_data.values)
+        .insert_back(input.values.begin(), input.values.end());
+
+    // Move to mirrored data, copying to device
+    data_ = CollectionMirror<FieldMapData>{std::move(host_data)};
+    CELER_ENSURE(this->data_);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,61 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldMapParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/CollectionMirror.hh"
+#include "FieldMapInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Data management for a tabulated, spatially varying magnetic field.
+ *
+ * The input axes are uniform grids in native length units and the values are
+ * in native field units, ordered as described in \c FieldMapData . The
+ * unused middle axis of a cylindrical map should be left unassigned.
+ *
+ * \sa FieldMapReader
+ */
+class FieldMapParams
+{
+  public:
+    //!@{
+    //! References to constructed data
+    using HostRef
+        = FieldMapData<Ownership::const_reference, MemSpace::host>;
+    using DeviceRef
+        = FieldMapData<Ownership::const_reference, MemSpace::device>;
+    //!@}
+
+    //! Input data to construct this class
+    struct Input
+    {
+        FieldMapGeometry          geometry{FieldMapGeometry::cartesian};
+        Array<UniformGridData, 3> axes;
+        std::vector<Real3>        values;
+    };
+
+  public:
+    // Construct with field map input data
+    explicit FieldMapParams(const Input& input);
+
+    //! Access field map data on the host
+    const HostRef& host_pointers() const { return data_.host(); }
+
+    //! Access field map data on the device
+    const DeviceRef& device_pointers() const { return data_.device(); }
+
+  private:
+    // Host/device storage and reference
+    CollectionMirror<FieldMapData> data_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,112 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldMapReader.cc
+//---------------------------------------------------------------------------//
+#include "FieldMapReader.hh"
+
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include "base/Assert.hh"
+#include "base/Units.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the path to the field map file.
+ */
+FieldMapReader::FieldMapReader(std::string filename)
+    : filename_(std::move(filename))
+{
+    CELER_EXPECT(!filename_.empty());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the field map.
+ */
+auto FieldMapReader::operator()() const -> result_type
+{
+    std::ifstream infile(filename_);
+    CELER_VALIDATE(infile,
+                   << "failed to open '" << filename_
+                   << "' (should contain a magnetic field map)");
+
+    // Strip comments
+    std::stringstream input_stream;
+    for (std::string line; std::getline(infile, line);)
+    {
+        input_stream << line.substr(0, line.find('#')) << '\n';
+    }
+
+    result_type result;
+
+    std::string geometry;
+    input_stream >> geometry;
+    if (geometry == "cartesian")
+    {
+        result.geometry = FieldMapGeometry::cartesian;
+    }
+    else if (geometry == "cylindrical")
+    {
+        result.geometry = FieldMapGeometry::cylindrical;
+    }
+    else
+    {
+        CELER_VALIDATE(false,
+                       << "invalid field map geometry '" << geometry
+                       << "' in '" << filename_
+                       << "' (expected 'cartesian' or 'cylindrical')");
+    }
+
+    // Read axis bounds
+    size_type num_values = 1;
+    for (size_type ax = 0; ax != 3; ++ax)
+    {
+        if (ax == 1 && result.geometry == FieldMapGeometry::cylindrical)
+        {
+            continue;
+        }
+
+        real_type front;
+        real_type back;
+        size_type size;
+        input_stream >> front >> back >> size;
+        CELER_VALIDATE(input_stream && size >= 2 && front < back,
+                       << "invalid bounds for axis " << ax << " in '"
+                       << filename_ << "'");
+        result.axes[ax] = UniformGridData::from_bounds(
+            front * units::centimeter, back * units::centimeter, size);
+        num_values *= size;
+    }
+
+    // Read field values
+    result.values.resize(num_values);
+    for (Real3& value : result.values)
+    {
+        input_stream >> value[0] >> value[1] >> value[2];
+        CELER_VALIDATE(input_stream,
+                       << "unexpected end of file '" << filename_
+                       << "' (expected " << num_values << " field values)");
+        for (real_type& v : value)
+        {
+            v *= units::tesla;
+        }
+    }
+
+    // Check that we've reached the end of the file
+    real_type dummy;
+    input_stream >> dummy;
+    CELER_VALIDATE(!input_stream,
+                   << "extra data at the end of '" << filename_
+                   << "' (data is inconsistent with the axes)");
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,51 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldMapReader.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include "FieldMapParams.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Read a tabulated magnetic field from a text file.
+ *
+ * The file is whitespace-delimited, and anything following a \c # on a line
+ * is ignored. It starts with the geometry (\c cartesian or \c cylindrical),
+ * followed by the \c front, \c back, and \c size of each axis: x, y, and z
+ * for a cartesian map, or r and z for a cylindrical map. The remainder of
+ * the file is one field vector per grid point with the last axis varying
+ * fastest. Lengths are in cm and field values are in tesla.
+ *
+ * \code
+    FieldMapReader read_map("solenoid.txt");
+    auto field_map = std::make_shared<FieldMapParams>(read_map());
+   \endcode
+ */
+class FieldMapReader
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type = FieldMapParams::Input;
+    //!@}
+
+  public:
+    // Construct with the path to the field map file
+    explicit FieldMapReader(std::string filename);
+
+    // Read the field map
+    result_type operator()() const;
+
+  private:
+    std::string filename_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
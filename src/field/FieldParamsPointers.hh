@@ -56,6 +56,9 @@ struct FieldParamsPointers
     //! the maximum number of steps (or trials)
     size_type max_nsteps = 100;
 
+    //! skip boundary checks inside the last safety sphere of the track
+    bool reuse_safety = true;
+
     //! Check whether data are assigned appropriately
     explicit inline CELER_FUNCTION operator bool() const
     {
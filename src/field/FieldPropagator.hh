@@ -33,8 +33,17 @@ namespace celeritas
  * the closest distance between two positions by the field stepper and the
  * linear projection to the volume boundary.
  *
+ * The driver is a \c FieldDriver instantiated with the chosen stepper.
+ *
+ * The last safety sphere of the track, i.e. the position of the last safety
+ * query and the distance to the nearest boundary from it, is stored in the
+ * geometry state. While a sub-step chord stays inside the sphere, the
+ * boundary check is skipped without querying the navigator. This can be
+ * disabled with the \c reuse_safety field parameter.
+ *
  * \note This follows similar methods as in Geant4's G4PropagatorInField class.
  */
+template<class DriverT>
 class FieldPropagator
 {
   public:
@@ -47,22 +56,35 @@ class FieldPropagator
         bool      on_boundary; //!< Flag for the geometry limited step
     };
 
+    //! Number of geometry queries made and avoided
+    struct Counters
+    {
+        size_type safety{0};      //!< Safety distance queries
+        size_type linear_step{0}; //!< Linear distance-to-boundary queries
+        size_type avoided{0};     //!< Sub-steps inside the safety sphere
+    };
+
   public:
     // Construct with shared parameters and the field driver
     inline CELER_FUNCTION FieldPropagator(GeoTrackView*            track,
                                           const ParticleTrackView& particle,
-                                          FieldDriver&             driver);
+                                          DriverT&                 driver);
 
     // Propagate in a field
     inline CELER_FUNCTION result_type operator()(real_type step);
 
+    //! Geometry queries by this propagator
+    CELER_FUNCTION const Counters& counters() const { return counters_; }
+
   private:
     //// DATA ////
 
     GeoTrackView* track_;
-    FieldDriver&  driver_;
+    DriverT&      driver_;
     OdeState      state_;
 
+    Counters counters_;
+
     //// HELPER TYPES ////
 
     // A helper input/output for private member functions
@@ -12,10 +12,11 @@ namespace celeritas
 /*!
  * Construct with shared field parameters and the field driver.
  */
+template<class DriverT>
 CELER_FUNCTION
-FieldPropagator::FieldPropagator(GeoTrackView*            track,
-                                 const ParticleTrackView& particle,
-                                 FieldDriver&             driver)
+FieldPropagator<DriverT>::FieldPropagator(GeoTrackView*            track,
+                                          const ParticleTrackView& particle,
+                                          DriverT&                 driver)
     : track_(track), driver_(driver)
 {
     CELER_ASSERT(particle.charge() != zero_quantity());
@@ -38,7 +39,9 @@ FieldPropagator::FieldPropagator(GeoTrackView*            track,
  * trajectory for a given step length within a required accuracy or intersects
  * with a new volume (geometry limited step).
  */
-CELER_FUNCTION auto FieldPropagator::operator()(real_type step) -> result_type
+template<class DriverT>
+CELER_FUNCTION auto FieldPropagator<DriverT>::operator()(real_type step)
+    -> result_type
 {
     result_type result;
 
@@ -101,11 +104,17 @@ CELER_FUNCTION auto FieldPropagator::operator()(real_type step) -> result_type
 /*!
  * Check whether the final position of the field integration for a given step
  * is inside the current volume or beyond any boundary of adjacent volumes.
+ *
+ * If the chord is inside the last safety sphere, which shrinks by the
+ * distance from its center to the start of the chord, no boundary can be
+ * crossed and the navigator is not queried. Otherwise the safety sphere is
+ * updated at the start of the chord.
  */
-CELER_FUNCTION
-void FieldPropagator::query_intersection(const Real3&  beg_pos,
-                                         const Real3&  end_pos,
-                                         Intersection* intersect)
+template<class DriverT>
+CELER_FUNCTION void
+FieldPropagator<DriverT>::query_intersection(const Real3&  beg_pos,
+                                             const Real3&  end_pos,
+                                             Intersection* intersect)
 {
     intersect->intersected = false;
 
@@ -115,7 +124,21 @@ void FieldPropagator::query_intersection(const Real3&  beg_pos,
     real_type length = norm(chord);
     CELER_ASSERT(length > 0);
 
+    if (driver_.reuse_safety())
+    {
+        // Check the remaining safety at the start of the chord
+        Real3 from_center = beg_pos;
+        axpy(real_type(-1.0), track_->safety_center(), &from_center);
+        if (length <= track_->safety_radius() - norm(from_center))
+        {
+            ++counters_.avoided;
+            return;
+        }
+    }
+
     real_type safety = track_->find_safety(beg_pos);
+    ++counters_.safety;
+    track_->set_safety(beg_pos, safety);
     if (length > safety)
     {
         // Check whether the linear step length to the next boundary is
@@ -124,6 +147,8 @@ void FieldPropagator::query_intersection(const Real3&  beg_pos,
         normalize_direction(&dir);
 
         real_type linear_step = track_->compute_step(beg_pos, dir, &safety);
+        ++counters_.linear_step;
+        track_->set_safety(beg_pos, safety);
 
         intersect->intersected = (linear_step <= length);
         intersect->scale       = linear_step / length;
@@ -142,8 +167,9 @@ void FieldPropagator::query_intersection(const Real3&  beg_pos,
  * Find the intersection point within a required accuracy using an iterative
  * method and return the final state by the field driver.
  */
-CELER_FUNCTION
-OdeState FieldPropagator::find_intersection(const OdeState& beg_state,
+template<class DriverT>
+CELER_FUNCTION OdeState
+FieldPropagator<DriverT>::find_intersection(const OdeState& beg_state,
                                             Intersection*   intersect)
 {
     intersect->intersected = false;
@@ -176,6 +202,7 @@ OdeState FieldPropagator::find_intersection(const OdeState& beg_state,
             normalize_direction(&dir);
             real_type safety      = 0;
             real_type linear_step = track_->compute_step(beg_pos, dir, &safety);
+            ++counters_.linear_step;
 
             intersect->scale = (linear_step / intersect->step);
             intersect->step  = trial_step * intersect->scale;
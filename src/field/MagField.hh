@@ -9,25 +9,45 @@
 
 #include "base/Array.hh"
 #include "base/Macros.hh"
+#include "FieldMapInterface.hh"
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
  * The MagField evaluates the magnetic field value at a given position.
+ *
+ * The field is either uniform or interpolated from a shared field map. A
+ * field map instance caches the last map cell it used, so it should be
+ * constructed once per track and reused for all the field evaluations of a
+ * step.
  */
 class MagField
 {
+  public:
+    //!@{
+    //! Type aliases
+    using FieldMapPointers
+        = FieldMapData<Ownership::const_reference, MemSpace::native>;
+    //!@}
+
   public:
     // Construct from a uniform field
     explicit inline CELER_FUNCTION MagField(const Real3& value);
 
+    // Construct from a tabulated field
+    explicit inline CELER_FUNCTION MagField(const FieldMapPointers& field_map);
+
     // Return a magnetic field value at a given position
-    inline CELER_FUNCTION Real3 operator()() const;
+    inline CELER_FUNCTION Real3 operator()(const Real3& pos) const;
 
   private:
     // Shared/persistent field data
-    Real3 value_;
+    Real3                   value_{0, 0, 0};
+    const FieldMapPointers* field_map_{nullptr};
+
+    // Last field map cell used by this track
+    mutable FieldMapCache cache_;
 };
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 
 #include "base/Assert.hh"
+#include "FieldMapCalculator.hh"
 
 namespace celeritas
 {
@@ -17,13 +18,27 @@ namespace celeritas
 CELER_FUNCTION
 MagField::MagField(const Real3& value) : value_(value) {}
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a tabulated magnetic field.
+ */
+CELER_FUNCTION
+MagField::MagField(const FieldMapPointers& field_map) : field_map_(&field_map)
+{
+    CELER_EXPECT(field_map);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Return a magnetic field value at a given position.
  */
-CELER_FUNCTION Real3 MagField::operator()() const
+CELER_FUNCTION Real3 MagField::operator()(const Real3& pos) const
 {
-    return value_;
+    if (!field_map_)
+    {
+        return value_;
+    }
+    return FieldMapCalculator(*field_map_)(pos, &cache_);
 }
 
 //---------------------------------------------------------------------------//
@@ -14,7 +14,7 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 /*!
- * Construct with a constant magnetic field.
+ * Construct with a magnetic field.
  */
 CELER_FUNCTION
 MagFieldEquation::MagFieldEquation(const MagField&         field,
@@ -41,7 +41,7 @@ CELER_FUNCTION
 auto MagFieldEquation::operator()(const OdeState& y) const -> OdeState
 {
     // Get a magnetic field value at a given position
-    Real3 mag_vec = field_();
+    Real3 mag_vec = field_(y.pos);
 
     real_type momentum_mag2 = dot_product(y.mom, y.mom);
     CELER_ASSERT(momentum_mag2 > 0.0);
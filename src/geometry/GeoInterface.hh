@@ -81,6 +81,8 @@ struct GeoStateData
     Items<Real3>     pos;
     Items<Real3>     dir;
     Items<real_type> next_step;
+    Items<Real3>     safety_center; //!< Position of the last safety query
+    Items<real_type> safety_radius; //!< Safety distance at that position
 
     // Wrapper for NavStatePool, vector, or void*
     detail::VGNavCollection<W, M> vgstate;
@@ -92,7 +94,9 @@ struct GeoStateData
     explicit CELER_FUNCTION operator bool() const
     {
         return this->size() > 0 && dir.size() == this->size()
-               && next_step.size() == this->size() && vgstate && vgnext;
+               && next_step.size() == this->size()
+               && safety_center.size() == this->size()
+               && safety_radius.size() == this->size() && vgstate && vgnext;
     }
 
     //! State size
@@ -106,11 +110,13 @@ struct GeoStateData
                           && W == Ownership::reference,
                       "Only supported assignment is from value to reference");
         CELER_EXPECT(other);
-        pos       = other.pos;
-        dir       = other.dir;
-        next_step = other.next_step;
-        vgstate   = other.vgstate;
-        vgnext    = other.vgnext;
+        pos           = other.pos;
+        dir           = other.dir;
+        next_step     = other.next_step;
+        safety_center = other.safety_center;
+        safety_radius = other.safety_radius;
+        vgstate       = other.vgstate;
+        vgnext        = other.vgnext;
         return *this;
     }
 };
@@ -132,6 +138,8 @@ void resize(
     make_builder(&data->pos).resize(size);
     make_builder(&data->dir).resize(size);
     make_builder(&data->next_step).resize(size);
+    make_builder(&data->safety_center).resize(size);
+    make_builder(&data->safety_radius).resize(size);
     data->vgstate.resize(params.max_depth, size);
     data->vgnext.resize(params.max_depth, size);
 
@@ -75,6 +75,11 @@ class GeoTrackView
         CELER_ASSERT(!dirty_);
         return next_step_;
     }
+    CELER_FUNCTION const Real3& safety_center() const
+    {
+        return safety_center_;
+    }
+    CELER_FUNCTION real_type safety_radius() const { return safety_radius_; }
     //!@}
 
     //!@{
@@ -91,6 +96,14 @@ class GeoTrackView
     }
     //!@}
 
+    //! Save a sphere around a point that no boundary is closer than radius
+    //! (cleared whenever the track changes volume)
+    CELER_FUNCTION void set_safety(const Real3& center, real_type radius)
+    {
+        safety_center_ = center;
+        safety_radius_ = radius;
+    }
+
     //! Get the volume ID in the current cell.
     inline CELER_FUNCTION VolumeId volume_id() const;
 
@@ -117,6 +130,8 @@ class GeoTrackView
     Real3&     pos_;
     Real3&     dir_;
     real_type& next_step_;
+    Real3&     safety_center_;
+    real_type& safety_radius_;
     // Flag to trigger update of geometry information if and only if needed
     bool dirty_;
     //!@}
@@ -25,6 +25,8 @@ GeoTrackView::GeoTrackView(const GeoParamsRef& data,
     , pos_(stateview.pos[thread])
     , dir_(stateview.dir[thread])
     , next_step_(stateview.next_step[thread])
+    , safety_center_(stateview.safety_center[thread])
+    , safety_radius_(stateview.safety_radius[thread])
     , dirty_(true)
 {
 }
@@ -40,8 +42,9 @@ GeoTrackView::GeoTrackView(const GeoParamsRef& data,
 CELER_FUNCTION GeoTrackView& GeoTrackView::operator=(const Initializer_t& init)
 {
     // Initialize position/direction
-    pos_ = init.pos;
-    dir_ = init.dir;
+    pos_           = init.pos;
+    dir_           = init.dir;
+    safety_radius_ = 0;
 
     // Set up current state and locate daughter volume.
     vgstate_.Clear();
@@ -75,7 +78,9 @@ GeoTrackView& GeoTrackView::operator=(const DetailedInitializer& init)
     {
         // Copy the navigation state and position from the parent state
         init.other.vgstate_.CopyTo(&vgstate_);
-        pos_ = init.other.pos_;
+        pos_           = init.other.pos_;
+        safety_center_ = init.other.safety_center_;
+        safety_radius_ = init.other.safety_radius_;
     }
     // Set up the next state and initialize the direction
     dir_ = init.dir;
@@ -170,6 +175,9 @@ CELER_FUNCTION real_type GeoTrackView::move_by(real_type dist)
 CELER_FUNCTION void GeoTrackView::move_next_volume()
 {
     vgstate_ = vgnext_;
+
+    // The safety sphere belongs to the previous volume
+    safety_radius_ = 0;
     if (this->is_outside())
         this->find_next_step_outside();
     else
@@ -248,5 +256,8 @@ CELER_FUNCTION void GeoTrackView::propagate_state(Real3 pos, Real3 dir) const
     vgstate_ = vgnext_;
     vgstate_.SetBoundaryState(true);
     vgnext_.Clear();
+
+    // The safety sphere belongs to the previous volume
+    safety_radius_ = 0;
 }
 } // namespace celeritas
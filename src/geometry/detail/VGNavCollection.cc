@@ -17,13 +17,23 @@ namespace detail
 //---------------------------------------------------------------------------//
 // HOST VALUE
 //---------------------------------------------------------------------------//
-void VGNavCollection<Ownership::value, MemSpace::host>::resize(int max_depth,
-                                                               size_type size)
+/*!
+ * Allocate a contiguous buffer and construct the states in place.
+ */
+void VGNavCollection<Ownership::value, MemSpace::host>::resize(int       md,
+                                                               size_type sz)
 {
-    CELER_EXPECT(max_depth > 0);
-    CELER_EXPECT(size == 1);
+    CELER_EXPECT(md > 0);
+    CELER_EXPECT(sz > 0);
 
-    nav_state.reset(NavState::MakeInstance(max_depth));
+    this->stride = NavState::SizeOfInstanceAlignAware(md);
+    this->storage.reset(new char[this->stride * sz]);
+    for (size_type i = 0; i < sz; ++i)
+    {
+        NavState::MakeInstanceAt(md, this->storage.get() + i * this->stride);
+    }
+    this->max_depth = md;
+    this->size      = sz;
 }
 
 //---------------------------------------------------------------------------//
@@ -35,20 +45,29 @@ void VGNavCollection<Ownership::value, MemSpace::host>::resize(int max_depth,
 void VGNavCollection<Ownership::reference, MemSpace::host>::operator=(
     VGNavCollection<Ownership::value, MemSpace::host>& other)
 {
-    ptr = other.nav_state.get();
+    CELER_ASSERT(other);
+    storage   = other.storage.get();
+    stride    = other.stride;
+    max_depth = other.max_depth;
+    size      = other.size;
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Get the navigation state at the given thread, which must be zero.
+ * Get the navigation state at the given thread.
+ *
+ * The max_depth_param is used for error checking against the allocated
+ * max_depth.
  */
-auto VGNavCollection<Ownership::reference, MemSpace::host>::at(int,
-                                                               ThreadId id) const
-    -> NavState&
+auto VGNavCollection<Ownership::reference, MemSpace::host>::at(
+    int max_depth_param, ThreadId id) const -> NavState&
 {
     CELER_EXPECT(*this);
-    CELER_EXPECT(id.get() == 0);
-    return *ptr;
+    CELER_EXPECT(id < this->size);
+    CELER_EXPECT(max_depth_param == this->max_depth);
+
+    return *reinterpret_cast<NavState*>(this->storage
+                                        + id.get() * this->stride);
 }
 
 //---------------------------------------------------------------------------//
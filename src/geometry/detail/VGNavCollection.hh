@@ -44,41 +44,49 @@ struct VGNavCollection<Ownership::reference, MemSpace::device>;
 // HOST MEMSPACE
 //---------------------------------------------------------------------------//
 /*!
- * Manage a single navigation state in host memory.
+ * Manage a pool of navigation states in host memory.
  *
- * Since navigation states are allocated on the heap, and don't have a default
- * contructor, we must use a `unique_ptr` to manage its memory.
+ * Navigation states have a size that depends on the geometry depth and don't
+ * have a default constructor, so they're constructed in place in a single
+ * contiguous buffer. As with the NavStatePool used for device states, each
+ * state occupies an aligned "stride" of bytes.
  */
 template<>
 struct VGNavCollection<Ownership::value, MemSpace::host>
 {
     using NavState = vecgeom::cxx::NavigationState;
 
-    std::unique_ptr<NavState> nav_state;
+    std::unique_ptr<char[]> storage;       //!< Buffer for all states
+    size_type               stride    = 0; //!< Aligned state size [bytes]
+    int                     max_depth = 0;
+    size_type               size      = 0;
 
-    // Resize with a number of states (must be 1)
+    // Resize with a number of states
     void resize(int max_depth, size_type size);
     // Whether the collection is assigned
-    explicit operator bool() const { return static_cast<bool>(nav_state); }
+    explicit operator bool() const { return static_cast<bool>(storage); }
 };
 
 //---------------------------------------------------------------------------//
 /*!
- * Reference a host-owned navigation state.
+ * Reference host-owned navigation states.
  */
 template<>
 struct VGNavCollection<Ownership::reference, MemSpace::host>
 {
     using NavState = vecgeom::cxx::NavigationState;
 
-    NavState* ptr = nullptr;
+    char*     storage   = nullptr;
+    size_type stride    = 0;
+    int       max_depth = 0;
+    size_type size      = 0;
 
     // Obtain reference from host memory
     void operator=(VGNavCollection<Ownership::value, MemSpace::host>& other);
     // Get the navigation state for a given thread
-    NavState& at(int, ThreadId id) const;
+    NavState& at(int max_depth, ThreadId id) const;
     //! True if the collection is assigned/valiid
-    explicit operator bool() const { return static_cast<bool>(ptr); }
+    explicit operator bool() const { return static_cast<bool>(storage); }
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,226 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BinaryExporter.cc
+//---------------------------------------------------------------------------//
+#include "BinaryExporter.hh"
+
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "base/Assert.hh"
+#include "detail/BinaryFormat.hh"
+#include "ImportData.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate the metadata and real blocks of the binary file.
+ */
+class BinaryWriter
+{
+  public:
+    //! Write a trivially copyable value to the metadata
+    template<class T>
+    void write(T value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "Only trivially copyable types can be written");
+        const char* data = reinterpret_cast<const char*>(&value);
+        meta_.insert(meta_.end(), data, data + sizeof(T));
+    }
+
+    //! Write an enum as a 32-bit integer
+    template<class E>
+    void write_enum(E value)
+    {
+        this->write(static_cast<std::int32_t>(value));
+    }
+
+    //! Write a size
+    void write_size(std::size_t size)
+    {
+        this->write(static_cast<std::uint64_t>(size));
+    }
+
+    //! Write a string as its length followed by its characters
+    void write(const std::string& str)
+    {
+        this->write_size(str.size());
+        meta_.insert(meta_.end(), str.begin(), str.end());
+    }
+
+    //! Append values to the real block and write their location
+    void write_reals(const std::vector<double>& values)
+    {
+        this->write_size(reals_.size());
+        this->write_size(values.size());
+        reals_.insert(reals_.end(), values.begin(), values.end());
+    }
+
+    //! Metadata block
+    const std::vector<char>& meta() const { return meta_; }
+
+    //! Real block
+    const std::vector<double>& reals() const { return reals_; }
+
+  private:
+    std::vector<char>   meta_;
+    std::vector<double> reals_;
+};
+
+//---------------------------------------------------------------------------//
+void write(BinaryWriter& out, const ImportParticle& p)
+{
+    out.write(p.name);
+    out.write(std::int32_t(p.pdg));
+    out.write(p.mass);
+    out.write(p.charge);
+    out.write(p.spin);
+    out.write(p.lifetime);
+    out.write(std::uint8_t(p.is_stable));
+}
+
+void write(BinaryWriter& out, const ImportElement& el)
+{
+    out.write(el.name);
+    out.write(std::uint32_t(el.atomic_number));
+    out.write(el.atomic_mass);
+    out.write(el.radiation_length_tsai);
+    out.write(el.coulomb_factor);
+}
+
+void write(BinaryWriter& out, const ImportMaterial& mat)
+{
+    out.write(mat.name);
+    out.write_enum(mat.state);
+    out.write(mat.temperature);
+    out.write(mat.density);
+    out.write(mat.electron_density);
+    out.write(mat.number_density);
+    out.write(mat.radiation_length);
+    out.write(mat.nuclear_int_length);
+
+    out.write_size(mat.pdg_cutoffs.size());
+    for (const auto& pdg_cut : mat.pdg_cutoffs)
+    {
+        out.write(std::int32_t(pdg_cut.first));
+        out.write(pdg_cut.second.energy);
+        out.write(pdg_cut.second.range);
+    }
+
+    out.write_size(mat.elements.size());
+    for (const ImportMatElemComponent& comp : mat.elements)
+    {
+        out.write(std::uint32_t(comp.element_id));
+        out.write(comp.mass_fraction);
+        out.write(comp.number_fraction);
+    }
+}
+
+void write(BinaryWriter& out, const ImportProcess& proc)
+{
+    out.write(std::int32_t(proc.particle_pdg));
+    out.write_enum(proc.process_type);
+    out.write_enum(proc.process_class);
+
+    out.write_size(proc.models.size());
+    for (ImportModelClass model : proc.models)
+    {
+        out.write_enum(model);
+    }
+
+    out.write_size(proc.tables.size());
+    for (const ImportPhysicsTable& table : proc.tables)
+    {
+        out.write_enum(table.table_type);
+        out.write_enum(table.x_units);
+        out.write_enum(table.y_units);
+        out.write_size(table.physics_vectors.size());
+        for (const ImportPhysicsVector& vec : table.physics_vectors)
+        {
+            out.write_enum(vec.vector_type);
+            out.write_reals(vec.x);
+            out.write_reals(vec.y);
+        }
+    }
+}
+
+void write(BinaryWriter& out, const ImportVolume& vol)
+{
+    out.write(std::uint32_t(vol.material_id));
+    out.write(vol.name);
+    out.write(vol.solid_name);
+}
+
+template<class T>
+void write(BinaryWriter& out, const std::vector<T>& items)
+{
+    out.write_size(items.size());
+    for (const T& item : items)
+    {
+        write(out, item);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the output filename.
+ */
+BinaryExporter::BinaryExporter(std::string filename)
+    : filename_(std::move(filename))
+{
+    CELER_EXPECT(!filename_.empty());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the data to the file.
+ */
+void BinaryExporter::operator()(const ImportData& data) const
+{
+    CELER_EXPECT(data);
+
+    BinaryWriter out;
+    write(out, data.particles);
+    write(out, data.elements);
+    write(out, data.materials);
+    write(out, data.processes);
+    write(out, data.volumes);
+
+    detail::BinaryHeader header;
+    std::memcpy(header.magic, detail::binary_magic, sizeof(header.magic));
+    header.version    = detail::binary_version;
+    header.byte_order = detail::binary_byte_order;
+    header.meta_size  = out.meta().size();
+    header.num_reals  = out.reals().size();
+
+    std::ofstream os(filename_, std::ios::out | std::ios::binary);
+    CELER_VALIDATE(os, << "failed to open '" << filename_ << "' for writing");
+
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    os.write(out.meta().data(), out.meta().size());
+
+    // Pad so that the real block is aligned in memory when mapped
+    std::uint64_t padding = detail::binary_reals_offset(header.meta_size)
+                            - sizeof(header) - header.meta_size;
+    const char zeros[alignof(double)] = {};
+    os.write(zeros, padding);
+
+    os.write(reinterpret_cast<const char*>(out.reals().data()),
+             out.reals().size() * sizeof(double));
+    CELER_VALIDATE(os, << "failed to write to '" << filename_ << "'");
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,44 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BinaryExporter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+
+namespace celeritas
+{
+struct ImportData;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write imported physics data to a flat, versioned binary file.
+ *
+ * This is an alternative to the ROOT output of \e geant-exporter that can be
+ * loaded by \c BinaryImporter without ROOT. All physics vector values are
+ * stored contiguously at the end of the file so that they can be mapped
+ * directly into memory.
+ *
+ * \code
+    BinaryExporter export_data("physics.bin");
+    export_data(import_data);
+   \endcode
+ */
+class BinaryExporter
+{
+  public:
+    // Construct with the output filename
+    explicit BinaryExporter(std::string filename);
+
+    // Write the data to the file
+    void operator()(const ImportData& data) const;
+
+  private:
+    std::string filename_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,350 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BinaryImporter.cc
+//---------------------------------------------------------------------------//
+#include "BinaryImporter.hh"
+
+#include <cstring>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "base/Assert.hh"
+#include "base/Range.hh"
+#include "detail/BinaryFormat.hh"
+
+namespace celeritas
+{
+namespace
+{
+static_assert(std::is_same<real_type, double>::value,
+              "Physics vectors are stored in double precision");
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the metadata block of the binary file with bounds checking.
+ */
+class BinaryReader
+{
+  public:
+    //! Construct with metadata and real blocks
+    BinaryReader(const char* begin, const char* end, Span<const real_type> reals)
+        : pos_(begin), end_(end), reals_(reals)
+    {
+    }
+
+    //! Read a trivially copyable value
+    template<class T>
+    T read()
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "Only trivially copyable types can be read");
+        this->check_remaining(sizeof(T));
+        T result;
+        std::memcpy(&result, pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return result;
+    }
+
+    //! Read an enum stored as a 32-bit integer
+    template<class E>
+    E read_enum()
+    {
+        return static_cast<E>(this->read<std::int32_t>());
+    }
+
+    //! Read a size
+    std::size_t read_size() { return this->read<std::uint64_t>(); }
+
+    //! Read a string
+    std::string read_string()
+    {
+        std::size_t size = this->read_size();
+        this->check_remaining(size);
+        std::string result(pos_, size);
+        pos_ += size;
+        return result;
+    }
+
+    //! Read the location of values in the real block
+    Span<const real_type> read_reals()
+    {
+        std::size_t offset = this->read_size();
+        std::size_t size   = this->read_size();
+        CELER_VALIDATE(offset <= reals_.size()
+                           && size <= reals_.size() - offset,
+                       << "corrupt binary import file (physics vector "
+                          "exceeds data size)");
+        return reals_.subspan(offset, size);
+    }
+
+    //! Whether the whole metadata block was read
+    bool done() const { return pos_ == end_; }
+
+  private:
+    const char*           pos_;
+    const char*           end_;
+    Span<const real_type> reals_;
+
+    void check_remaining(std::size_t size) const
+    {
+        CELER_VALIDATE(size <= static_cast<std::size_t>(end_ - pos_),
+                       << "corrupt binary import file (metadata is "
+                          "truncated)");
+    }
+};
+
+//---------------------------------------------------------------------------//
+template<class T, class F>
+std::vector<T> read_vector(BinaryReader& in, F read_one)
+{
+    std::vector<T> result(in.read_size());
+    for (T& item : result)
+    {
+        read_one(in, item);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+void read_item(BinaryReader& in, ImportParticle& p)
+{
+    p.name      = in.read_string();
+    p.pdg       = in.read<std::int32_t>();
+    p.mass      = in.read<double>();
+    p.charge    = in.read<double>();
+    p.spin      = in.read<double>();
+    p.lifetime  = in.read<double>();
+    p.is_stable = in.read<std::uint8_t>();
+}
+
+void read_item(BinaryReader& in, ImportElement& el)
+{
+    el.name                  = in.read_string();
+    el.atomic_number         = in.read<std::uint32_t>();
+    el.atomic_mass           = in.read<double>();
+    el.radiation_length_tsai = in.read<double>();
+    el.coulomb_factor        = in.read<double>();
+}
+
+void read_item(BinaryReader& in, ImportMaterial& mat)
+{
+    mat.name               = in.read_string();
+    mat.state              = in.read_enum<ImportMaterialState>();
+    mat.temperature        = in.read<double>();
+    mat.density            = in.read<double>();
+    mat.electron_density   = in.read<double>();
+    mat.number_density     = in.read<double>();
+    mat.radiation_length   = in.read<double>();
+    mat.nuclear_int_length = in.read<double>();
+
+    for (auto num_cuts = in.read_size(); num_cuts > 0; --num_cuts)
+    {
+        int                 pdg = in.read<std::int32_t>();
+        ImportProductionCut cut;
+        cut.energy           = in.read<double>();
+        cut.range            = in.read<double>();
+        mat.pdg_cutoffs[pdg] = cut;
+    }
+
+    mat.elements = read_vector<ImportMatElemComponent>(
+        in, [](BinaryReader& in, ImportMatElemComponent& comp) {
+            comp.element_id      = in.read<std::uint32_t>();
+            comp.mass_fraction   = in.read<double>();
+            comp.number_fraction = in.read<double>();
+        });
+}
+
+void read_item(BinaryReader& in, ImportVolume& vol)
+{
+    vol.material_id = in.read<std::uint32_t>();
+    vol.name        = in.read_string();
+    vol.solid_name  = in.read_string();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether an imported physics data filename refers to a ROOT file.
+ *
+ * Files with a \c .root extension are read and written with ROOT; all
+ * others use the binary format.
+ */
+bool is_root_filename(const std::string& filename)
+{
+    const std::string ext = ".root";
+    return filename.size() >= ext.size()
+           && filename.compare(filename.size() - ext.size(), ext.size(), ext)
+                  == 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Map the file into memory and read the metadata.
+ */
+BinaryImporter::BinaryImporter(const char* filename)
+{
+    CELER_EXPECT(filename);
+
+    int fd = ::open(filename, O_RDONLY);
+    CELER_VALIDATE(fd >= 0, << "failed to open '" << filename << "'");
+
+    struct stat file_stat;
+    int         stat_result = ::fstat(fd, &file_stat);
+    if (stat_result == 0 && file_stat.st_size > 0)
+    {
+        // Take ownership of the mapping before anything can throw
+        size_     = static_cast<std::size_t>(file_stat.st_size);
+        void* ptr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr != MAP_FAILED)
+        {
+            data_ = MappedUniquePtr(static_cast<const char*>(ptr),
+                                    UnmapDeleter{size_});
+        }
+    }
+    ::close(fd);
+    CELER_VALIDATE(data_,
+                   << "failed to map '" << filename << "' into memory");
+
+    // Check the header
+    const char*          bytes = data_.get();
+    detail::BinaryHeader header;
+    CELER_VALIDATE(size_ >= sizeof(header),
+                   << "'" << filename << "' is not a binary import file");
+    std::memcpy(&header, bytes, sizeof(header));
+    CELER_VALIDATE(std::memcmp(header.magic,
+                               detail::binary_magic,
+                               sizeof(header.magic))
+                       == 0,
+                   << "'" << filename << "' is not a binary import file");
+    CELER_VALIDATE(header.byte_order == detail::binary_byte_order,
+                   << "'" << filename
+                   << "' was written with a different byte order");
+    CELER_VALIDATE(header.version == detail::binary_version,
+                   << "'" << filename << "' has format version "
+                   << header.version << " but version "
+                   << detail::binary_version << " is required");
+
+    // Compare sizes without overflowing for a corrupt header
+    CELER_VALIDATE(header.meta_size <= size_,
+                   << "'" << filename << "' is truncated or corrupt");
+    std::uint64_t reals_offset = detail::binary_reals_offset(header.meta_size);
+    CELER_VALIDATE(reals_offset <= size_
+                       && (size_ - reals_offset) % sizeof(double) == 0
+                       && header.num_reals
+                              == (size_ - reals_offset) / sizeof(double),
+                   << "'" << filename << "' is truncated or corrupt");
+    Span<const real_type> reals(
+        reinterpret_cast<const real_type*>(bytes + reals_offset),
+        header.num_reals);
+
+    // Read the metadata
+    BinaryReader in(bytes + sizeof(header),
+                    bytes + sizeof(header) + header.meta_size,
+                    reals);
+    auto read_any = [](BinaryReader& in, auto& item) { read_item(in, item); };
+    metadata_.particles = read_vector<ImportParticle>(in, read_any);
+    metadata_.elements  = read_vector<ImportElement>(in, read_any);
+    metadata_.materials = read_vector<ImportMaterial>(in, read_any);
+
+    metadata_.processes.resize(in.read_size());
+    vectors_.resize(metadata_.processes.size());
+    for (auto proc_idx : range(metadata_.processes.size()))
+    {
+        ImportProcess& proc = metadata_.processes[proc_idx];
+        proc.particle_pdg   = in.read<std::int32_t>();
+        proc.process_type   = in.read_enum<ImportProcessType>();
+        proc.process_class  = in.read_enum<ImportProcessClass>();
+        proc.models         = read_vector<ImportModelClass>(
+            in, [](BinaryReader& in, ImportModelClass& model) {
+                model = in.read_enum<ImportModelClass>();
+            });
+
+        proc.tables.resize(in.read_size());
+        vectors_[proc_idx].resize(proc.tables.size());
+        for (auto table_idx : range(proc.tables.size()))
+        {
+            ImportPhysicsTable& table = proc.tables[table_idx];
+            table.table_type          = in.read_enum<ImportTableType>();
+            table.x_units             = in.read_enum<ImportUnits>();
+            table.y_units             = in.read_enum<ImportUnits>();
+
+            auto& views = vectors_[proc_idx][table_idx];
+            views.resize(in.read_size());
+            for (ImportPhysicsVectorView& view : views)
+            {
+                view.vector_type = in.read_enum<ImportPhysicsVectorType>();
+                view.x           = in.read_reals();
+                view.y           = in.read_reals();
+            }
+        }
+    }
+
+    metadata_.volumes = read_vector<ImportVolume>(in, read_any);
+    CELER_VALIDATE(in.done(),
+                   << "'" << filename << "' has unexpected trailing metadata");
+}
+
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load all data, copying the physics vectors out of the mapped file.
+ */
+ImportData BinaryImporter::operator()() const
+{
+    ImportData result = metadata_;
+    for (auto proc_idx : range(result.processes.size()))
+    {
+        ImportProcess& proc = result.processes[proc_idx];
+        for (auto table_idx : range(proc.tables.size()))
+        {
+            const auto& views = vectors_[proc_idx][table_idx];
+            auto&       table = proc.tables[table_idx];
+            table.physics_vectors.resize(views.size());
+            for (auto vec_idx : range(views.size()))
+            {
+                const ImportPhysicsVectorView& view = views[vec_idx];
+                ImportPhysicsVector&           vec
+                    = table.physics_vectors[vec_idx];
+                vec.vector_type = view.vector_type;
+                vec.x.assign(view.x.begin(), view.x.end());
+                vec.y.assign(view.y.begin(), view.y.end());
+            }
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access a physics vector directly from the mapped file.
+ *
+ * The indices correspond to \c ImportData::processes, \c
+ * ImportProcess::tables, and \c ImportPhysicsTable::physics_vectors.
+ */
+const ImportPhysicsVectorView&
+BinaryImporter::physics_vector(size_type process,
+                               size_type table,
+                               size_type vec) const
+{
+    CELER_EXPECT(process < vectors_.size());
+    CELER_EXPECT(table < vectors_[process].size());
+    CELER_EXPECT(vec < vectors_[process][table].size());
+    return vectors_[process][table][vec];
+}
+
+//---------------------------------------------------------------------------//
+//! Deleter unmaps the file
+void BinaryImporter::UnmapDeleter::operator()(const char* ptr) const
+{
+    ::munmap(const_cast<char*>(ptr), size);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,106 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BinaryImporter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "ImportData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Zero-copy view of a physics vector stored in a binary import file.
+ */
+struct ImportPhysicsVectorView
+{
+    ImportPhysicsVectorType vector_type{ImportPhysicsVectorType::unknown};
+    Span<const real_type>   x;
+    Span<const real_type>   y;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load imported physics data from a file written by \c BinaryExporter.
+ *
+ * The file is mapped into memory rather than read, so the physics vector
+ * values can be accessed without copies through \c physics_vector, e.g.
+ * to pass to \c ValueGridLogBuilder::from_geant. Calling the importer
+ * constructs a full \c ImportData (as with \c RootImporter) for use with the
+ * \c from_import functions.
+ *
+ * \code
+    BinaryImporter import("/path/to/physics.bin");
+    const auto data            = import();
+    const auto particle_params = ParticleParams::from_import(data);
+
+    auto vec = import.physics_vector(process_idx, table_idx, material_idx);
+    auto builder = ValueGridLogBuilder::from_geant(vec.x, vec.y);
+   \endcode
+ *
+ * The file must have been written on a machine with the same byte order, and
+ * its format version must match the current version.
+ */
+class BinaryImporter
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SpanConstReal = Span<const real_type>;
+    //!@}
+
+  public:
+    // Map the file into memory and read the metadata
+    explicit BinaryImporter(const char* filename);
+
+    //!@{
+    //! Prevent copying and moving: views refer to the mapped memory
+    BinaryImporter(const BinaryImporter&) = delete;
+    BinaryImporter& operator=(const BinaryImporter&) = delete;
+    //!@}
+
+    // Load all data, copying the physics vectors
+    ImportData operator()() const;
+
+    // Access a physics vector directly from the mapped file
+    const ImportPhysicsVectorView&
+    physics_vector(size_type process, size_type table, size_type vec) const;
+
+    //! Imported data without physics vector values
+    const ImportData& metadata() const { return metadata_; }
+
+  private:
+    struct UnmapDeleter
+    {
+        std::size_t size;
+        void        operator()(const char*) const;
+    };
+    using MappedUniquePtr = std::unique_ptr<const char, UnmapDeleter>;
+
+    // Mapped file, unmapped on destruction
+    MappedUniquePtr data_;
+    std::size_t     size_{0};
+
+    // Data with empty physics vectors
+    ImportData metadata_;
+
+    // Physics vectors [process][table][vector]
+    std::vector<std::vector<std::vector<ImportPhysicsVectorView>>> vectors_;
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Whether an imported physics data filename refers to a ROOT file
+bool is_root_filename(const std::string& filename);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,152 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EventQueue.cc
+//---------------------------------------------------------------------------//
+#include "EventQueue.hh"
+
+#include <utility>
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and start reading events.
+ */
+EventQueue::EventQueue(ReadEvent read_event, size_type capacity)
+    : read_event_(std::move(read_event)), capacity_(capacity)
+{
+    CELER_EXPECT(read_event_);
+    CELER_EXPECT(capacity_ > 0);
+
+    thread_ = std::thread([this] { this->read_all(); });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stop reading and wait for the reader thread.
+ *
+ * If the read function is in the middle of reading an event, this will block
+ * until it's done.
+ */
+EventQueue::~EventQueue()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    not_full_.notify_all();
+    thread_.join();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Pop whole events up to a total number of primaries.
+ *
+ * This blocks until at least one event is available or all events have been
+ * read. Events are popped until the next one would exceed the given number of
+ * primaries. It is an error for a single event to have more than
+ * \c max_primaries particles.
+ */
+auto EventQueue::pop(size_type max_primaries) -> VecPrimary
+{
+    CELER_EXPECT(max_primaries > 0);
+
+    VecPrimary result;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        this->wait_for_event(lock);
+        while (!events_.empty())
+        {
+            const VecPrimary& event = events_.front();
+            if (result.size() + event.size() > max_primaries)
+            {
+                CELER_VALIDATE(!result.empty(),
+                               << "event with " << event.size()
+                               << " primaries exceeds the maximum of "
+                               << max_primaries);
+                break;
+            }
+            result.insert(result.end(), event.begin(), event.end());
+            events_.pop_front();
+        }
+    }
+    not_full_.notify_one();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether all events have been read and popped.
+ *
+ * This blocks until the next event is available or the reader is finished.
+ */
+bool EventQueue::done()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    this->wait_for_event(lock);
+    return events_.empty();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read events until the input is exhausted or the queue is destroyed.
+ */
+void EventQueue::read_all()
+{
+    while (true)
+    {
+        VecPrimary event;
+        bool       have_event = false;
+        try
+        {
+            have_event = read_event_(&event);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error_ = std::current_exception();
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (!have_event || error_)
+            {
+                finished_ = true;
+                break;
+            }
+            not_full_.wait(lock, [this] {
+                return events_.size() < capacity_ || stopping_;
+            });
+            if (stopping_)
+            {
+                break;
+            }
+            events_.push_back(std::move(event));
+        }
+        not_empty_.notify_one();
+    }
+    not_empty_.notify_all();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait until an event is available or the reader is finished.
+ *
+ * An error from the reader thread is rethrown once all events read before it
+ * have been popped.
+ */
+void EventQueue::wait_for_event(std::unique_lock<std::mutex>& lock)
+{
+    not_empty_.wait(lock, [this] { return !events_.empty() || finished_; });
+    if (events_.empty() && error_)
+    {
+        std::rethrow_exception(error_);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
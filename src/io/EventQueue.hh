@@ -0,0 +1,106 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EventQueue.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "base/Types.hh"
+#include "physics/base/Primary.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Read events on a background thread into a bounded queue.
+ *
+ * The read function is called repeatedly on a separate thread. It fills the
+ * primaries of the next event and returns \c false when there are no more
+ * events. At most \c capacity events are buffered, so the memory use is
+ * independent of the number of events in the input. Primaries are popped in
+ * whole events, in the order they were read.
+ *
+ * Errors raised by the read function are rethrown on the consuming thread
+ * when the failed event would have been popped.
+ *
+ * \code
+    auto reader = std::make_shared<EventReader>(filename, particles);
+    EventQueue queue(
+        [reader](EventQueue::VecPrimary* event) {
+            if (reader->done())
+                return false;
+            *event = reader->read_events(1);
+            return true;
+        },
+        64);
+    while (!queue.done())
+    {
+        auto primaries = queue.pop(max_primaries);
+        // ...transport...
+    }
+   \endcode
+ */
+class EventQueue
+{
+  public:
+    //!@{
+    //! Type aliases
+    using VecPrimary = std::vector<Primary>;
+    using ReadEvent  = std::function<bool(VecPrimary*)>;
+    //!@}
+
+  public:
+    // Construct and start reading events
+    EventQueue(ReadEvent read_event, size_type capacity);
+
+    // Stop reading and wait for the reader thread
+    ~EventQueue();
+
+    //!@{
+    //! Prevent copying and moving because of the reader thread
+    EventQueue(const EventQueue&) = delete;
+    EventQueue& operator=(const EventQueue&) = delete;
+    //!@}
+
+    // Pop whole events up to a total number of primaries
+    VecPrimary pop(size_type max_primaries);
+
+    // Whether all events have been read and popped
+    bool done();
+
+    //! Maximum number of buffered events
+    size_type capacity() const { return capacity_; }
+
+  private:
+    //// DATA ////
+
+    ReadEvent read_event_;
+    size_type capacity_;
+
+    std::mutex              mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    std::deque<VecPrimary>  events_;
+    std::exception_ptr      error_;
+    bool                    finished_{false};
+    bool                    stopping_{false};
+
+    std::thread thread_;
+
+    //// HELPER FUNCTIONS ////
+
+    void read_all();
+    void wait_for_event(std::unique_lock<std::mutex>& lock);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "EventReader.hh"
 
+#include <limits>
 #include "base/ArrayUtils.hh"
 #include "physics/base/Units.hh"
 #include "HepMC3/GenEvent.h"
@@ -33,67 +34,136 @@ EventReader::~EventReader() = default;
 
 //---------------------------------------------------------------------------//
 /*!
- * Read the primary particles from the event record.
+ * Read the primary particles from all remaining events.
  */
 EventReader::result_type EventReader::operator()()
 {
-    result_type result;
-    int         event_id = -1;
+    return this->read_events(std::numeric_limits<size_type>::max());
+}
 
-    while (!input_file_->failed())
+//---------------------------------------------------------------------------//
+/*!
+ * Read the primary particles from at most the next N events.
+ */
+EventReader::result_type EventReader::read_events(size_type max_events)
+{
+    result_type result;
+    for (size_type i = 0; i < max_events && this->read_pending(); ++i)
     {
-        // Parse the next event from the record
-        HepMC3::GenEvent gen_event;
-        input_file_->read_event(gen_event);
+        result.insert(result.end(), pending_.begin(), pending_.end());
+        pending_.clear();
+    }
+    return result;
+}
 
-        // There are no more events
-        if (input_file_->failed())
+//---------------------------------------------------------------------------//
+/*!
+ * Read the primary particles from whole events up to a total count.
+ *
+ * Events are added until the next one would exceed the given number of
+ * primaries; that event is kept and returned by the next read. It is an error
+ * for a single event to have more than \c max_primaries particles.
+ */
+EventReader::result_type EventReader::read_primaries(size_type max_primaries)
+{
+    CELER_EXPECT(max_primaries > 0);
+
+    result_type result;
+    while (this->read_pending())
+    {
+        if (result.size() + pending_.size() > max_primaries)
         {
+            CELER_VALIDATE(!result.empty(),
+                           << "event " << pending_.front().event_id.get()
+                           << " has " << pending_.size()
+                           << " primaries, which exceeds the maximum of "
+                           << max_primaries);
             break;
         }
-        ++event_id;
+        result.insert(result.end(), pending_.begin(), pending_.end());
+        pending_.clear();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether all events have been read.
+ *
+ * This may read (and buffer) the next event from the file.
+ */
+bool EventReader::done()
+{
+    return !this->read_pending();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the next event into the pending buffer if it's empty.
+ *
+ * \return Whether an event is pending
+ */
+bool EventReader::read_pending()
+{
+    if (!pending_.empty())
+    {
+        return true;
+    }
+    if (input_file_->failed())
+    {
+        return false;
+    }
 
-        int track_id = 0;
+    // Parse the next event from the record
+    HepMC3::GenEvent gen_event;
+    input_file_->read_event(gen_event);
+    if (input_file_->failed())
+    {
+        // There are no more events
+        return false;
+    }
 
-        // Convert the energy units to MeV and the length units to cm
-        gen_event.set_units(HepMC3::Units::MEV, HepMC3::Units::CM);
+    EventId event_id{event_id_++};
+    int     track_id = 0;
 
-        for (auto gen_particle : gen_event.particles())
-        {
-            // Get the PDG code and check if this particle type is defined for
-            // the current physics
-            PDGNumber  pdg{gen_particle->pid()};
-            ParticleId particle_id{params_->find(pdg)};
-            CELER_ASSERT(particle_id);
+    // Convert the energy units to MeV and the length units to cm
+    gen_event.set_units(HepMC3::Units::MEV, HepMC3::Units::CM);
 
-            Primary primary;
+    for (auto gen_particle : gen_event.particles())
+    {
+        // Get the PDG code and check if this particle type is defined for
+        // the current physics
+        PDGNumber  pdg{gen_particle->pid()};
+        ParticleId particle_id{params_->find(pdg)};
+        CELER_ASSERT(particle_id);
 
-            // Set the registered ID of the particle
-            primary.particle_id = particle_id;
+        Primary primary;
 
-            // Set the event and track number
-            primary.event_id = EventId(event_id);
-            primary.track_id = TrackId(track_id++);
+        // Set the registered ID of the particle
+        primary.particle_id = particle_id;
 
-            // Get the position of the primary
-            auto pos         = gen_event.event_pos();
-            primary.position = {pos.x() * units::centimeter,
-                                pos.y() * units::centimeter,
-                                pos.z() * units::centimeter};
+        // Set the event and track number
+        primary.event_id = event_id;
+        primary.track_id = TrackId(track_id++);
 
-            // Get the direction of the primary
-            primary.direction = {gen_particle->momentum().px(),
-                                 gen_particle->momentum().py(),
-                                 gen_particle->momentum().pz()};
-            normalize_direction(&primary.direction);
+        // Get the position of the primary
+        auto pos         = gen_event.event_pos();
+        primary.position = {pos.x() * units::centimeter,
+                            pos.y() * units::centimeter,
+                            pos.z() * units::centimeter};
 
-            // Get the energy of the primary
-            primary.energy = units::MevEnergy{gen_particle->momentum().e()};
+        // Get the direction of the primary
+        primary.direction = {gen_particle->momentum().px(),
+                             gen_particle->momentum().py(),
+                             gen_particle->momentum().pz()};
+        normalize_direction(&primary.direction);
 
-            result.push_back(primary);
-        }
+        // Get the energy of the primary
+        primary.energy = units::MevEnergy{gen_particle->momentum().e()};
+
+        pending_.push_back(primary);
     }
-    return result;
+    return true;
 }
 
 //---------------------------------------------------------------------------//
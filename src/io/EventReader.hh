@@ -8,6 +8,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include "physics/base/ParticleParams.hh"
 #include "physics/base/Primary.hh"
 
@@ -23,6 +24,20 @@ namespace celeritas
  * Read an event record file using the HepMC3 event record library and create
  * primary particles. Supported forrmats are Asciiv3, IO_GenEvent, HEPEVT, and
  * LHEF.
+ *
+ * Events can be read all at once or incrementally, so that large event files
+ * don't have to be held in memory. Primaries are only ever returned in whole
+ * events, and event IDs are numbered consecutively over all calls.
+ *
+ * \code
+    EventReader read_event(filename, particles);
+    // Read the next 10 events
+    auto primaries = read_event.read_events(10);
+    // Read as many events as will fit in 1024 primaries
+    primaries = read_event.read_primaries(1024);
+    // Read all the remaining events
+    primaries = read_event();
+   \endcode
  */
 class EventReader
 {
@@ -40,15 +55,34 @@ class EventReader
     // Default destructor in .cc
     ~EventReader();
 
-    // Generate primary particles from the event record
+    // Generate primary particles from all remaining events
     result_type operator()();
 
+    // Generate primary particles from at most the next N events
+    result_type read_events(size_type max_events);
+
+    // Generate primary particles from whole events up to a total count
+    result_type read_primaries(size_type max_primaries);
+
+    // Whether all events have been read
+    bool done();
+
   private:
     // Shared standard model particle data
     SPConstParticles params_;
 
     // HepMC3 event record reader
     std::shared_ptr<HepMC3::Reader> input_file_;
+
+    // Next event ID
+    EventId::size_type event_id_ = 0;
+
+    // Primaries from an event that was read but not yet returned
+    std::vector<Primary> pending_;
+
+    //// HELPER FUNCTIONS ////
+
+    bool read_pending();
 };
 
 //---------------------------------------------------------------------------//
@@ -22,5 +22,25 @@ EventReader::result_type EventReader::operator()()
     CELER_ASSERT_UNREACHABLE();
 }
 
+EventReader::result_type EventReader::read_events(size_type)
+{
+    CELER_ASSERT_UNREACHABLE();
+}
+
+EventReader::result_type EventReader::read_primaries(size_type)
+{
+    CELER_ASSERT_UNREACHABLE();
+}
+
+bool EventReader::done()
+{
+    CELER_ASSERT_UNREACHABLE();
+}
+
+bool EventReader::read_pending()
+{
+    CELER_ASSERT_UNREACHABLE();
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
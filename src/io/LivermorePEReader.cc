@@ -7,11 +7,11 @@
 //---------------------------------------------------------------------------//
 #include "LivermorePEReader.hh"
 
-#include <fstream>
 #include <sstream>
 #include "base/Assert.hh"
 #include "base/Macros.hh"
 #include "base/Types.hh"
+#include "detail/AsciiNumberReader.hh"
 
 namespace celeritas
 {
@@ -59,8 +59,8 @@ LivermorePEReader::operator()(AtomicNumber atomic_number) const
     // Read photoelectric effect total cross section above K-shell energy but
     // below energy limit for parameterization
     {
-        std::string   filename = path_ + "/pe-cs-" + Z + ".dat";
-        std::ifstream infile(filename);
+        std::string               filename = path_ + "/pe-cs-" + Z + ".dat";
+        detail::AsciiNumberReader infile(filename);
         CELER_VALIDATE(infile,
                        << "failed to open '" << filename
                        << "' (should contain cross section data)");
@@ -84,8 +84,8 @@ LivermorePEReader::operator()(AtomicNumber atomic_number) const
 
     // Read photoelectric effect total cross section below K-shell energy
     {
-        std::string   filename = path_ + "/pe-le-cs-" + Z + ".dat";
-        std::ifstream infile(filename);
+        std::string               filename = path_ + "/pe-le-cs-" + Z + ".dat";
+        detail::AsciiNumberReader infile(filename);
         CELER_VALIDATE(infile,
                        << "failed to open '" << filename
                        << "' (should contain cross section data)");
@@ -94,7 +94,7 @@ LivermorePEReader::operator()(AtomicNumber atomic_number) const
         result.xs_lo.vector_type = ImportPhysicsVectorType::free;
 
         // Check that the file is not empty
-        if (!(infile.peek() == std::ifstream::traits_type::eof()))
+        if (!infile.at_end())
         {
             // Read tabulated energies and cross sections
             real_type energy_min = 0.;
@@ -113,8 +113,8 @@ LivermorePEReader::operator()(AtomicNumber atomic_number) const
 
     // Read subshell cross section fit parameters in low energy interval
     {
-        std::string   filename = path_ + "/pe-low-" + Z + ".dat";
-        std::ifstream infile(filename);
+        std::string               filename = path_ + "/pe-low-" + Z + ".dat";
+        detail::AsciiNumberReader infile(filename);
         CELER_VALIDATE(infile,
                        << "failed to open '" << filename
                        << "' (should contain subshell fit parameters)");
@@ -141,8 +141,8 @@ LivermorePEReader::operator()(AtomicNumber atomic_number) const
 
     // Read subshell cross section fit parameters in high energy interval
     {
-        std::string   filename = path_ + "/pe-high-" + Z + ".dat";
-        std::ifstream infile(filename);
+        std::string               filename = path_ + "/pe-high-" + Z + ".dat";
+        detail::AsciiNumberReader infile(filename);
         CELER_VALIDATE(infile,
                        << "failed to open '" << filename
                        << "' (should contain subshell fit parameters)");
@@ -171,8 +171,8 @@ LivermorePEReader::operator()(AtomicNumber atomic_number) const
 
     // Read tabulated subshell cross sections
     {
-        std::string   filename = path_ + "/pe-ss-cs-" + Z + ".dat";
-        std::ifstream infile(filename);
+        std::string               filename = path_ + "/pe-ss-cs-" + Z + ".dat";
+        detail::AsciiNumberReader infile(filename);
         CELER_VALIDATE(infile,
                        << "failed to open '" << filename
                        << "' (should contain subshell cross sections)");
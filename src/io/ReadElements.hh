@@ -0,0 +1,83 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ReadElements.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <exception>
+#include <type_traits>
+#include <vector>
+#include "celeritas_config.h"
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Read the data for several elements concurrently.
+ *
+ * The reader is any function of the atomic number, such as one of the
+ * per-element data readers (\c SeltzerBergerReader, \c LivermorePEReader,
+ * \c AtomicRelaxationReader) or a model's \c ReadData function, and must be
+ * safe to call from multiple threads. The files
+ * are read on up to \c num_threads host threads (all available threads if
+ * zero), and the results are returned in the same order as the atomic
+ * numbers. If any element fails to load, the error for the first such
+ * element in the list is rethrown.
+ *
+ * \code
+    SeltzerBergerReader read_sb;
+    auto sb_tables = read_elements(read_sb, {1, 6, 8, 29});
+   \endcode
+ */
+template<class Reader,
+         class T = typename std::result_of<const Reader&(int)>::type>
+std::vector<T> read_elements(const Reader&           read,
+                             const std::vector<int>& elements,
+                             CELER_MAYBE_UNUSED int  num_threads = 0)
+{
+    CELER_EXPECT(num_threads >= 0);
+
+    std::vector<T>                  result(elements.size());
+    std::vector<std::exception_ptr> errors(elements.size());
+
+#if CELERITAS_USE_OPENMP
+    if (num_threads == 0)
+    {
+        num_threads = omp_get_max_threads();
+    }
+#    pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+#endif
+    for (std::size_t i = 0; i < elements.size(); ++i)
+    {
+        try
+        {
+            result[i] = read(elements[i]);
+        }
+        catch (...)
+        {
+            // Exceptions can't propagate out of a parallel region
+            errors[i] = std::current_exception();
+        }
+    }
+
+    for (const std::exception_ptr& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -7,10 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "SeltzerBergerReader.hh"
 
-#include <fstream>
 #include <sstream>
 #include "base/Assert.hh"
 #include "base/Range.hh"
+#include "detail/AsciiNumberReader.hh"
 
 namespace celeritas
 {
@@ -58,8 +58,8 @@ SeltzerBergerReader::operator()(AtomicNumber atomic_number) const
     result_type result;
 
     // Open file for given atomic number
-    std::string   file = path_ + "/br" + std::to_string(atomic_number);
-    std::ifstream input_stream(file.c_str());
+    std::string file = path_ + "/br" + std::to_string(atomic_number);
+    detail::AsciiNumberReader input_stream(file);
     CELER_VALIDATE(input_stream,
                    << "failed to open '" << file
                    << "' (should contain SB cross section data)");
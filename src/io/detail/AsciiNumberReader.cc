@@ -0,0 +1,264 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AsciiNumberReader.cc
+//---------------------------------------------------------------------------//
+#include "AsciiNumberReader.hh"
+
+#include <cstdint>
+#include <fstream>
+#include <locale>
+#include <sstream>
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+bool is_space(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+//! Powers of ten that are exactly representable as doubles
+constexpr double exact_pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                  1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                  1e18, 1e19, 1e20, 1e21, 1e22};
+
+//! Maximum number of significant digits stored in the mantissa
+constexpr int max_digits = 19;
+
+//! Largest mantissa that is exactly representable as a double
+constexpr std::uint64_t max_exact_mantissa = std::uint64_t(1) << 53;
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the contents of the given file.
+ *
+ * If the file can't be opened the reader is constructed in a failed state.
+ */
+AsciiNumberReader::AsciiNumberReader(const std::string& filename)
+{
+    std::ifstream infile(filename, std::ios::in | std::ios::binary);
+    if (!infile)
+    {
+        return;
+    }
+
+    infile.seekg(0, std::ios::end);
+    std::streamoff size = infile.tellg();
+    infile.seekg(0, std::ios::beg);
+    if (size < 0)
+    {
+        return;
+    }
+    buffer_.resize(size);
+    infile.read(&buffer_[0], size);
+    good_ = static_cast<bool>(infile);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether only whitespace remains in the file.
+ */
+bool AsciiNumberReader::at_end()
+{
+    this->skip_whitespace();
+    return pos_ == buffer_.size();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Extract a real number.
+ */
+AsciiNumberReader& AsciiNumberReader::operator>>(double& value)
+{
+    this->skip_whitespace();
+    if (!good_ || pos_ == buffer_.size())
+    {
+        good_ = false;
+        return *this;
+    }
+
+    const char* const begin = buffer_.data() + pos_;
+    const char* const end   = buffer_.data() + buffer_.size();
+    const char*       p     = begin;
+
+    bool negative = false;
+    if (*p == '+' || *p == '-')
+    {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    // Accumulate significant digits of the integer and fractional parts
+    std::uint64_t mantissa   = 0;
+    int           num_digits = 0;
+    int           exponent   = 0;
+    bool          any_digits = false;
+    bool          exact      = true;
+    auto          accumulate = [&](char c, bool is_fraction) {
+        any_digits = true;
+        if (mantissa == 0 && c == '0')
+        {
+            // Leading zeros are not significant
+            exponent -= is_fraction;
+            return;
+        }
+        if (num_digits == max_digits)
+        {
+            exact = false;
+            return;
+        }
+        mantissa = 10 * mantissa + (c - '0');
+        ++num_digits;
+        exponent -= is_fraction;
+    };
+    for (; p != end && is_digit(*p); ++p)
+    {
+        accumulate(*p, false);
+    }
+    if (p != end && *p == '.')
+    {
+        for (++p; p != end && is_digit(*p); ++p)
+        {
+            accumulate(*p, true);
+        }
+    }
+    if (!any_digits)
+    {
+        good_ = false;
+        return *this;
+    }
+
+    // Read the exponent if one is present
+    if (p != end && (*p == 'e' || *p == 'E'))
+    {
+        const char* q            = p + 1;
+        bool        negative_exp = false;
+        if (q != end && (*q == '+' || *q == '-'))
+        {
+            negative_exp = (*q == '-');
+            ++q;
+        }
+        if (q != end && is_digit(*q))
+        {
+            int exp_value = 0;
+            for (; q != end && is_digit(*q); ++q)
+            {
+                if (exp_value < 10000)
+                {
+                    exp_value = 10 * exp_value + (*q - '0');
+                }
+            }
+            exponent += negative_exp ? -exp_value : exp_value;
+            p = q;
+        }
+    }
+
+    double result;
+    if (exact && mantissa <= max_exact_mantissa && exponent >= -22
+        && exponent <= 22)
+    {
+        // Both the mantissa and the power of ten are exact, so a single
+        // operation gives the correctly rounded result
+        result = static_cast<double>(mantissa);
+        if (exponent < 0)
+        {
+            result /= exact_pow10[-exponent];
+        }
+        else
+        {
+            result *= exact_pow10[exponent];
+        }
+        if (negative)
+        {
+            result = -result;
+        }
+    }
+    else
+    {
+        // Fall back to stream extraction for unusual values, using the
+        // classic locale so that the result is independent of the global one
+        std::istringstream is(std::string(begin, p));
+        is.imbue(std::locale::classic());
+        is >> result;
+        if (!is)
+        {
+            good_ = false;
+            return *this;
+        }
+    }
+
+    value = result;
+    pos_ += p - begin;
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE MEMBER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Advance past any whitespace.
+ */
+void AsciiNumberReader::skip_whitespace()
+{
+    while (pos_ != buffer_.size() && is_space(buffer_[pos_]))
+    {
+        ++pos_;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Extract a decimal integer, returning whether it succeeded.
+ */
+bool AsciiNumberReader::read_integer(bool is_signed, long long* value)
+{
+    this->skip_whitespace();
+    if (!good_ || pos_ == buffer_.size())
+    {
+        good_ = false;
+        return false;
+    }
+
+    bool negative = false;
+    if (buffer_[pos_] == '+' || (is_signed && buffer_[pos_] == '-'))
+    {
+        negative = (buffer_[pos_] == '-');
+        ++pos_;
+    }
+    if (pos_ == buffer_.size() || !is_digit(buffer_[pos_]))
+    {
+        good_ = false;
+        return false;
+    }
+
+    unsigned long long result = 0;
+    for (; pos_ != buffer_.size() && is_digit(buffer_[pos_]); ++pos_)
+    {
+        result = 10 * result + (buffer_[pos_] - '0');
+    }
+    *value = negative ? -static_cast<long long>(result)
+                      : static_cast<long long>(result);
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,87 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AsciiNumberReader.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <type_traits>
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Extract whitespace-separated numbers from an ASCII data file.
+ *
+ * This is a drop-in replacement for formatted \c std::ifstream extraction
+ * when reading the G4EMLOW tables. The whole file is read into memory at
+ * construction, and numbers are parsed directly from the buffer without
+ * going through the stream locale.
+ *
+ * Decimal values with at most 19 significant digits and a power of ten
+ * within \f$ 10^{\pm 22} \f$ (which includes everything in the G4EMLOW
+ * tables) are converted with a single exact multiplication or division,
+ * which is correctly rounded; other values fall back to stream extraction
+ * in the classic "C" locale. The results are therefore identical to stream
+ * extraction and don't depend on the global locale.
+ *
+ * As with a stream, a failed open or extraction puts the reader in a failed
+ * state that can be checked with \c operator bool, and subsequent
+ * extractions have no effect.
+ */
+class AsciiNumberReader
+{
+  public:
+    // Read the contents of the given file
+    explicit AsciiNumberReader(const std::string& filename);
+
+    //! Whether the file was read and all extractions succeeded
+    explicit operator bool() const { return good_; }
+
+    // Whether only whitespace remains
+    bool at_end();
+
+    // Extract a real number
+    AsciiNumberReader& operator>>(double& value);
+
+    // Extract an integer
+    template<class T>
+    typename std::enable_if<std::is_integral<T>::value,
+                            AsciiNumberReader&>::type
+    operator>>(T& value);
+
+  private:
+    std::string            buffer_;
+    std::string::size_type pos_{0};
+    bool                   good_{false};
+
+    void skip_whitespace();
+    bool read_integer(bool is_signed, long long* value);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Extract an integer.
+ */
+template<class T>
+typename std::enable_if<std::is_integral<T>::value, AsciiNumberReader&>::type
+AsciiNumberReader::operator>>(T& value)
+{
+    long long result;
+    if (this->read_integer(std::is_signed<T>::value, &result))
+    {
+        value = static_cast<T>(result);
+    }
+    return *this;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,63 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BinaryFormat.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Fixed-size header at the start of a binary import data file.
+ *
+ * The header is followed by a block of \c meta_size bytes of metadata
+ * (particles, elements, materials, process and table descriptions, and
+ * volumes), and then (aligned to a multiple of eight bytes) a block of
+ * \c num_reals double-precision values holding the physics vector data. Each
+ * physics vector in the metadata stores the offset and size of its x and y
+ * values in the real block.
+ *
+ * All integers and reals are written with the byte order of the writing
+ * machine, which is checked by the reader with the \c byte_order marker.
+ */
+struct BinaryHeader
+{
+    char          magic[8];   //!< File type identifier
+    std::uint32_t version;    //!< Format version
+    std::uint32_t byte_order; //!< Byte order marker
+    std::uint64_t meta_size;  //!< Size of the metadata block [bytes]
+    std::uint64_t num_reals;  //!< Number of values in the real block
+};
+
+static_assert(sizeof(BinaryHeader) == 32, "Unexpected header padding");
+
+//! File type identifier
+constexpr char binary_magic[8] = {'C', 'E', 'L', 'E', 'R', 'I', 'M', 'P'};
+
+//! Current format version: increment when the layout changes
+constexpr std::uint32_t binary_version = 1;
+
+//! Marker used to detect a file written with the opposite byte order
+constexpr std::uint32_t binary_byte_order = 0x01020304u;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Offset of the real block in the file.
+ */
+inline std::uint64_t binary_reals_offset(std::uint64_t meta_size)
+{
+    constexpr std::uint64_t alignment = alignof(double);
+    std::uint64_t           offset    = sizeof(BinaryHeader) + meta_size;
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
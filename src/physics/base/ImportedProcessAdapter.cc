@@ -69,6 +69,19 @@ ImportedProcesses::ImportedProcesses(std::vector<ImportProcess> io)
     CELER_ENSURE(processes_.size() == ids_.size());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with tables mapped from a binary file.
+ *
+ * The physics vector values are accessed directly from the mapped file
+ * rather than copied into the process data.
+ */
+ImportedProcesses::ImportedProcesses(SPConstBinary binary)
+    : ImportedProcesses(binary->metadata().processes)
+{
+    binary_ = std::move(binary);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Return physics tables for a particle type and process.
@@ -84,6 +97,36 @@ auto ImportedProcesses::find(key_type particle_process) const -> ImportProcessId
     return iter->second;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the values of a physics vector without copying.
+ *
+ * The indices correspond to the process ID, the index in
+ * \c ImportProcess::tables, and the index (material) in
+ * \c ImportPhysicsTable::physics_vectors.
+ */
+ImportPhysicsVectorView ImportedProcesses::physics_vector(ImportProcessId id,
+                                                          size_type table,
+                                                          size_type vec) const
+{
+    CELER_EXPECT(id < this->size());
+    if (binary_)
+    {
+        return binary_->physics_vector(id.get(), table, vec);
+    }
+
+    const auto& tables = processes_[id.get()].tables;
+    CELER_EXPECT(table < tables.size());
+    const auto& vectors = tables[table].physics_vectors;
+    CELER_EXPECT(vec < vectors.size());
+
+    ImportPhysicsVectorView result;
+    result.vector_type = vectors[vec].vector_type;
+    result.x           = make_span(vectors[vec].x);
+    result.y           = make_span(vectors[vec].y);
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from shared process data.
@@ -180,13 +223,10 @@ auto ImportedProcessAdapter::step_limits(Applicability range) const
 
     // Get list of physics tables
     const ParticleProcessIds& ids = ids_.find(range.particle)->second;
-    const ImportProcess&      import_process = imported_->get(ids.process);
 
-    auto get_vector = [&range, &import_process](ImportTableId table_id) {
-        CELER_ASSERT(table_id < import_process.tables.size());
-        const ImportPhysicsTable& tab = import_process.tables[table_id.get()];
-        CELER_ASSERT(range.material < tab.physics_vectors.size());
-        return tab.physics_vectors[range.material.get()];
+    auto get_vector = [this, &range, &ids](ImportTableId table_id) {
+        return imported_->physics_vector(
+            ids.process, table_id.get(), range.material.get());
     };
 
     StepLimitBuilders builders;
@@ -195,46 +235,46 @@ auto ImportedProcessAdapter::step_limits(Applicability range) const
     if (ids.lambda && ids.lambda_prim)
     {
         // Both unscaled and scaled values are present
-        const auto& lo = get_vector(ids.lambda);
+        auto lo = get_vector(ids.lambda);
         CELER_ASSERT(lo.vector_type == ImportPhysicsVectorType::log);
-        const auto& hi = get_vector(ids.lambda_prim);
+        auto hi = get_vector(ids.lambda_prim);
         CELER_ASSERT(hi.vector_type == ImportPhysicsVectorType::log);
-        builders[ValueGridType::macro_xs] = ValueGridXsBuilder::from_geant(
-            make_span(lo.x), make_span(lo.y), make_span(hi.x), make_span(hi.y));
+        builders[ValueGridType::macro_xs]
+            = ValueGridXsBuilder::from_geant(lo.x, lo.y, hi.x, hi.y);
     }
     else if (ids.lambda_prim)
     {
         // Only high-energy (energy-scale) cross sections are presesnt
-        const auto& vec = get_vector(ids.lambda_prim);
+        auto vec = get_vector(ids.lambda_prim);
         CELER_ASSERT(vec.vector_type == ImportPhysicsVectorType::log);
-        builders[ValueGridType::macro_xs] = ValueGridXsBuilder::from_scaled(
-            make_span(vec.x), make_span(vec.y));
+        builders[ValueGridType::macro_xs]
+            = ValueGridXsBuilder::from_scaled(vec.x, vec.y);
     }
     else if (ids.lambda)
     {
         // Only low-energy cross sections are presesnt
-        const auto& vec = get_vector(ids.lambda);
+        auto vec = get_vector(ids.lambda);
         CELER_ASSERT(vec.vector_type == ImportPhysicsVectorType::log);
-        builders[ValueGridType::macro_xs] = ValueGridLogBuilder::from_geant(
-            make_span(vec.x), make_span(vec.y));
+        builders[ValueGridType::macro_xs]
+            = ValueGridLogBuilder::from_geant(vec.x, vec.y);
     }
 
     // Construct slowing-down data
     if (ids.dedx)
     {
-        const auto& vec = get_vector(ids.dedx);
+        auto vec = get_vector(ids.dedx);
         CELER_ASSERT(vec.vector_type == ImportPhysicsVectorType::log);
-        builders[ValueGridType::energy_loss] = ValueGridLogBuilder::from_geant(
-            make_span(vec.x), make_span(vec.y));
+        builders[ValueGridType::energy_loss]
+            = ValueGridLogBuilder::from_geant(vec.x, vec.y);
     }
 
     // Construct range limiters
     if (ids.range)
     {
-        const auto& vec = get_vector(ids.range);
+        auto vec = get_vector(ids.range);
         CELER_ASSERT(vec.vector_type == ImportPhysicsVectorType::log);
-        builders[ValueGridType::range] = ValueGridLogBuilder::from_range(
-            make_span(vec.x), make_span(vec.y));
+        builders[ValueGridType::range]
+            = ValueGridLogBuilder::from_range(vec.x, vec.y);
     }
 
     return builders;
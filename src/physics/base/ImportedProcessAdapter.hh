@@ -13,6 +13,7 @@
 #include <vector>
 #include "base/OpaqueId.hh"
 #include "base/Span.hh"
+#include "io/BinaryImporter.hh"
 #include "io/ImportProcess.hh"
 #include "Process.hh"
 #include "PDGNumber.hh"
@@ -33,6 +34,7 @@ class ImportedProcesses
     using ImportProcessId  = OpaqueId<ImportProcess>;
     using key_type         = std::pair<PDGNumber, ImportProcessClass>;
     using SPConstParticles = std::shared_ptr<const ParticleParams>;
+    using SPConstBinary    = std::shared_ptr<const BinaryImporter>;
     //!@}
 
   public:
@@ -43,6 +45,9 @@ class ImportedProcesses
     // Construct with imported tables
     explicit ImportedProcesses(std::vector<ImportProcess> io);
 
+    // Construct with tables mapped from a binary file
+    explicit ImportedProcesses(SPConstBinary binary);
+
     // Return physics tables for a particle type and process
     ImportProcessId find(key_type) const;
 
@@ -52,9 +57,14 @@ class ImportedProcesses
     // Number of imported processes
     inline ImportProcessId::size_type size() const;
 
+    // Get the values of a physics vector without copying
+    ImportPhysicsVectorView
+    physics_vector(ImportProcessId id, size_type table, size_type vec) const;
+
   private:
     std::vector<ImportProcess>          processes_;
     std::map<key_type, ImportProcessId> ids_;
+    SPConstBinary                       binary_;
 };
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,11 @@
 //---------------------------------------------------------------------------//
 #include "Model.hh"
 
+#include "celeritas_config.h"
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
@@ -15,11 +20,26 @@ Model::~Model() = default;
 
 //---------------------------------------------------------------------------//
 /*!
- * Default to "not implemented" host interaction.
+ * Secondary storage that host interactions can leave unused in one step.
+ *
+ * When a host interaction is split across threads, each thread reserves
+ * secondary slots in chunks of \c host_secondary_chunk_size and abandons the
+ * unused end of its last chunk when the launch completes. Launching every
+ * model once per step can therefore leave up to this many slots of the
+ * secondary stack empty, which should be added to its capacity.
  */
-void Model::interact(const HostInteractRefs&) const
+size_type host_secondary_overhead(size_type num_models)
 {
-    CELER_NOT_IMPLEMENTED("host interactions");
+    size_type num_threads = 1;
+#if CELERITAS_USE_OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+    if (num_threads == 1)
+    {
+        // A single thread allocates directly from the shared stack
+        return 0;
+    }
+    return num_models * num_threads * (host_secondary_chunk_size - 1);
 }
 
 //---------------------------------------------------------------------------//
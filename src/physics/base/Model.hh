@@ -39,7 +39,10 @@ struct ModelInteractRefs;
  *   applicability.
  * - It precalculates energy loss rates and range limiters for each range.
  * - If it has an interaction cross section, it provides an "interact" method
- *   for undergoing an interaction and possibly emitting secondaries.
+ *   for undergoing an interaction and possibly emitting secondaries. The
+ *   method is applied only to the (nonempty) subset of track slots listed in
+ *   the \c thread_ids of the interaction data, all of which selected this
+ *   model.
  *
  * This class is similar to Geant4's G4VContinuousDiscrete process, but more
  * limited.
@@ -61,8 +64,8 @@ class Model
     //! Get the applicable particle type and energy ranges of the model
     virtual SetApplicability applicability() const = 0;
 
-    //! Apply the interaction kernel to host data (TODO)
-    virtual void interact(const HostInteractRefs&) const;
+    //! Apply the interaction kernel to host data
+    virtual void interact(const HostInteractRefs&) const = 0;
 
     //! Apply the interaction kernel to device data
     virtual void interact(const DeviceInteractRefs&) const = 0;
@@ -74,5 +77,14 @@ class Model
     virtual std::string label() const = 0;
 };
 
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+//! Number of secondary slots reserved at a time by each host thread
+constexpr size_type host_secondary_chunk_size = 16;
+
+// Secondary storage that host interactions can leave unused in one step
+size_type host_secondary_overhead(size_type num_models);
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "base/OpaqueId.hh"
 #include "base/Span.hh"
 #include "base/StackAllocator.hh"
 #include "base/Types.hh"
@@ -106,12 +107,17 @@ struct ModelInteractStateRefs
 //---------------------------------------------------------------------------//
 /*!
  * All data needed to interact with a model.
+ *
+ * The thread IDs are the compact, sorted subset of track slots that selected
+ * the model being launched: interaction kernels are launched over this subset
+ * rather than the full state.
  */
 template<MemSpace M>
 struct ModelInteractRefs
 {
     ModelInteractParamsRefs<M> params;
     ModelInteractStateRefs<M>  states;
+    Span<const ThreadId>       thread_ids;
 
     //! True if assigned
     CELER_FUNCTION operator bool() const { return params && states; }
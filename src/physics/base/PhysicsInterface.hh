@@ -248,6 +248,34 @@ struct PhysicsParamsData
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Read or write cached physics data (see \c CollectionWriter).
+ *
+ * The hardwired model data is excluded since it references data owned by the
+ * models themselves: it must be reassigned after loading.
+ */
+template<class A>
+void serialize(A& ar, PhysicsParamsData<Ownership::value, MemSpace::host>& data)
+{
+    ar(data.reals);
+    ar(data.model_ids);
+    ar(data.value_grids);
+    ar(data.value_grid_ids);
+    ar(data.process_ids);
+    ar(data.value_tables);
+    ar(data.energy_loss);
+    ar(data.model_groups);
+    ar(data.process_groups);
+
+    ar(data.max_particle_processes);
+
+    ar(data.scaling_min_range);
+    ar(data.scaling_fraction);
+    ar(data.energy_fraction);
+    ar(data.linear_loss_limit);
+}
+
 //---------------------------------------------------------------------------//
 // STATE
 //---------------------------------------------------------------------------//
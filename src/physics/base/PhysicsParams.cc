@@ -8,9 +8,12 @@
 #include "PhysicsParams.hh"
 
 #include <algorithm>
+#include <exception>
 #include <map>
 #include <tuple>
+#include "celeritas_config.h"
 #include "base/Assert.hh"
+#include "base/CollectionCache.hh"
 #include "base/Range.hh"
 #include "base/VectorUtils.hh"
 #include "comm/Logger.hh"
@@ -21,8 +24,27 @@
 #include "physics/grid/XsCalculator.hh"
 #include "physics/material/MaterialParams.hh"
 
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Step limit grids built for a single particle, process, and material
+struct TempGrids
+{
+    ValueGridInserter::RealCollection   reals;
+    ValueGridInserter::XsGridCollection grids;
+    ValueGridArray<ValueGridId>         ids;
+    std::exception_ptr                  error;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct with processes and helper classes.
@@ -39,11 +61,37 @@ PhysicsParams::PhysicsParams(Input inp) : processes_(std::move(inp.processes))
     // Emit models for associated proceses
     models_ = this->build_models();
 
-    // Construct data
-    HostValue host_data;
-    this->build_options(inp.options, &host_data);
-    this->build_ids(*inp.particles, &host_data);
-    this->build_xs(inp.options, *inp.materials, &host_data);
+    // Construct data, or load it from the cache if the inputs are unchanged
+    HostValue     host_data;
+    std::uint64_t cache_key = 0;
+    if (!inp.cache_filename.empty())
+    {
+        cache_key = this->build_cache_key(inp);
+    }
+    if (!inp.cache_filename.empty()
+        && load_collection_cache(inp.cache_filename, cache_key, &host_data))
+    {
+        CELER_LOG(info) << "Loaded physics data from cache '"
+                        << inp.cache_filename << "'";
+        CELER_VALIDATE(host_data.process_groups.size() == inp.particles->size(),
+                       << "cached physics data in '" << inp.cache_filename
+                       << "' has the wrong number of particles (delete it to "
+                          "rebuild)");
+    }
+    else
+    {
+        this->build_options(inp.options, &host_data);
+        this->build_ids(*inp.particles, &host_data);
+        this->build_xs(
+            inp.options, *inp.materials, inp.num_threads, &host_data);
+        if (!inp.cache_filename.empty())
+        {
+            save_collection_cache(inp.cache_filename, cache_key, host_data);
+            CELER_LOG(info) << "Saved physics data to cache '"
+                            << inp.cache_filename << "'";
+        }
+    }
+    this->build_hardwired(&host_data);
 
     CELER_LOG(debug)
         << "Constructed physics sizes:"
@@ -98,6 +146,73 @@ auto PhysicsParams::build_models() const -> VecModel
     return models;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a hash of all inputs to the physics data.
+ *
+ * The user-provided cache key must identify the data (e.g. imported Geant4
+ * tables) that the processes use to build their models and cross sections.
+ * The particle and material properties are hashed here since the cross
+ * sections also depend on them.
+ */
+std::uint64_t PhysicsParams::build_cache_key(const Input& inp) const
+{
+    HashBuilder hash;
+    hash(inp.cache_key);
+
+    const Options& opts = inp.options;
+    hash(opts.min_range);
+    hash(opts.max_step_over_range);
+    hash(opts.min_eprime_over_e);
+    hash(opts.linear_loss_limit);
+    hash(opts.use_integral_xs);
+
+    // Particle and material properties used to calculate cross sections
+    const ParticleParams& particles = *inp.particles;
+    hash(particles.size());
+    for (auto pid : range(ParticleId{particles.size()}))
+    {
+        ParticleView particle = particles.get(pid);
+        hash(particles.id_to_pdg(pid).get());
+        hash(particle.mass().value());
+        hash(particle.charge().value());
+        hash(particle.decay_constant());
+    }
+
+    const MaterialParams& materials = *inp.materials;
+    hash(materials.num_elements());
+    for (auto eid : range(ElementId{materials.num_elements()}))
+    {
+        ElementView element = materials.get(eid);
+        hash(element.atomic_number());
+        hash(element.atomic_mass().value());
+    }
+    hash(materials.num_materials());
+    for (auto mid : range(MaterialId{materials.num_materials()}))
+    {
+        MaterialView material = materials.get(mid);
+        hash(material.number_density());
+        hash(material.temperature());
+        hash(material.matter_state());
+        hash(material.num_elements());
+        for (const MatElementComponent& comp : material.elements())
+        {
+            hash(comp.element.get());
+            hash(comp.fraction);
+        }
+    }
+    for (const SPConstProcess& process : processes_)
+    {
+        hash(process->label());
+    }
+    for (const auto& model : models_)
+    {
+        hash(model.first->label());
+        hash(model.second);
+    }
+    return hash.value();
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct on-device physics options.
@@ -237,7 +352,17 @@ void PhysicsParams::build_ids(const ParticleParams& particles,
         process_groups.push_back(pgroup);
     }
 
-    // Assign hardwired models that do on-the-fly xs calculation
+    CELER_ENSURE(*data);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Assign hardwired models that do on-the-fly xs calculation.
+ */
+void PhysicsParams::build_hardwired(HostValue* data) const
+{
+    CELER_EXPECT(data);
+
     for (auto model_idx : range(this->num_models()))
     {
         const Model&    model      = *models_[model_idx].first;
@@ -256,43 +381,135 @@ void PhysicsParams::build_ids(const ParticleParams& particles,
             data->hardwired.eplusgg_params = epgg_model->device_pointers();
         }
     }
-
-    CELER_ENSURE(*data);
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * Construct cross section data.
+ *
+ * The grids for every particle, process, and material are first built
+ * independently into temporary storage, distributed over host threads. They
+ * are then copied into the physics data in the same order as a serial build,
+ * so that the result is identical for any number of threads.
  */
 void PhysicsParams::build_xs(const Options&        opts,
                              const MaterialParams& mats,
+                             CELER_MAYBE_UNUSED int num_threads,
                              HostValue*            data) const
 {
     CELER_EXPECT(*data);
+    CELER_EXPECT(num_threads >= 0);
 
     using UPGridBuilder = Process::UPConstGridBuilder;
 
+    // Offset of the first grid of each particle in the flattened list of
+    // (particle, process, material) grids
+    std::vector<size_type> grid_offsets{0};
+    for (const ProcessGroup& process_group :
+         data->process_groups[AllItems<ProcessGroup>{}])
+    {
+        grid_offsets.push_back(grid_offsets.back()
+                               + process_group.processes.size() * mats.size());
+    }
+
+    // Build the step limit grids for each particle, process, and material
+    std::vector<TempGrids> temp_grids(grid_offsets.back());
+#if CELERITAS_USE_OPENMP
+    if (num_threads == 0)
+    {
+        num_threads = omp_get_max_threads();
+    }
+#    pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+#endif
+    for (size_type i = 0; i < temp_grids.size(); ++i)
+    {
+        TempGrids& result = temp_grids[i];
+        try
+        {
+            // Unpack the particle, process, and material indices
+            const size_type particle_idx
+                = std::upper_bound(grid_offsets.begin(), grid_offsets.end(), i)
+                  - grid_offsets.begin() - 1;
+            const size_type pm_idx = i - grid_offsets[particle_idx];
+            const size_type pp_idx = pm_idx / mats.size();
+
+            const ProcessGroup& process_group
+                = data->process_groups[ParticleId(particle_idx)];
+            const ProcessId process_id
+                = data->process_ids[process_group.processes][pp_idx];
+            const ModelGroup& model_group
+                = data->model_groups[process_group.models][pp_idx];
+
+            // Get energy bounds for this process
+            Span<const real_type> energy_grid
+                = data->reals[model_group.energy];
+            Applicability applic;
+            applic.particle = ParticleId(particle_idx);
+            applic.material = MaterialId(pm_idx % mats.size());
+            applic.lower    = Applicability::Energy{energy_grid.front()};
+            applic.upper    = Applicability::Energy{energy_grid.back()};
+            CELER_ASSERT(applic.lower < applic.upper);
+
+            // Construct step limit builders
+            const Process& proc     = this->process(process_id);
+            auto           builders = proc.step_limits(applic);
+            CELER_VALIDATE(
+                std::any_of(builders.begin(),
+                            builders.end(),
+                            [](const UPGridBuilder& p) { return bool(p); }),
+                << "process '" << proc.label()
+                << "' has neither interaction nor energy loss (it must "
+                   "have at least one)");
+
+            // Construct grids
+            ValueGridInserter insert_grid(&result.reals, &result.grids);
+            for (auto vgt : range(ValueGridType::size_))
+            {
+                if (builders[vgt])
+                {
+                    result.ids[vgt] = builders[vgt]->build(insert_grid);
+                }
+            }
+        }
+        catch (...)
+        {
+            // Exceptions can't propagate out of a parallel region
+            result.error = std::current_exception();
+        }
+    }
+
+    // Rethrow the first failure in serial order
+    for (const TempGrids& result : temp_grids)
+    {
+        if (result.error)
+        {
+            std::rethrow_exception(result.error);
+        }
+    }
+
     ValueGridInserter insert_grid(&data->reals, &data->value_grids);
     auto              value_tables   = make_builder(&data->value_tables);
     auto              energy_loss    = make_builder(&data->energy_loss);
     auto              value_grid_ids = make_builder(&data->value_grid_ids);
-    auto              build_grid
-        = [insert_grid](const UPGridBuilder& builder) -> ValueGridId {
-        return builder ? builder->build(insert_grid) : ValueGridId{};
+    auto              copy_grid = [&insert_grid](const TempGrids& temp,
+                                        ValueGridId      id) -> ValueGridId {
+        if (!id)
+        {
+            return {};
+        }
+        const XsGridData& grid = temp.grids[id];
+        return insert_grid(
+            grid.log_energy, grid.prime_index, temp.reals[grid.value]);
     };
 
-    Applicability applic;
     for (auto particle_id : range(ParticleId(data->process_groups.size())))
     {
-        applic.particle = particle_id;
-
         // Processes for this particle
         ProcessGroup& process_group = data->process_groups[particle_id];
         Span<const ProcessId> processes
             = data->process_ids[process_group.processes];
-        Span<const ModelGroup> model_groups
-            = data->model_groups[process_group.models];
-        CELER_ASSERT(processes.size() == model_groups.size());
+        CELER_ASSERT(processes.size()
+                     == data->model_groups[process_group.models].size());
 
         // Material-dependent physics tables, one per particle-process
         ValueGridArray<std::vector<ValueTable>> temp_tables;
@@ -307,13 +524,6 @@ void PhysicsParams::build_xs(const Options&        opts,
         // Loop over per-particle processes
         for (auto pp_idx : range(processes.size()))
         {
-            // Get energy bounds for this process
-            Span<const real_type> energy_grid
-                = data->reals[model_groups[pp_idx].energy];
-            applic.lower = Applicability::Energy{energy_grid.front()};
-            applic.upper = Applicability::Energy{energy_grid.back()};
-            CELER_ASSERT(applic.lower < applic.upper);
-
             const Process& proc = this->process(processes[pp_idx]);
 
             // Grid IDs for each grid type, each material
@@ -329,23 +539,15 @@ void PhysicsParams::build_xs(const Options&        opts,
             // Loop over materials
             for (auto mat_id : range(MaterialId{mats.size()}))
             {
-                applic.material = mat_id;
+                const TempGrids& temp
+                    = temp_grids[grid_offsets[particle_id.get()]
+                                 + pp_idx * mats.size() + mat_id.get()];
 
-                // Construct step limit builders
-                auto builders = proc.step_limits(applic);
-                CELER_VALIDATE(
-                    std::any_of(builders.begin(),
-                                builders.end(),
-                                [](const UPGridBuilder& p) { return bool(p); }),
-                    << "process '" << proc.label()
-                    << "' has neither interaction nor energy loss (it must "
-                       "have at least one)");
-
-                // Construct grids
+                // Copy grids
                 for (auto vgt : range(ValueGridType::size_))
                 {
                     temp_grid_ids[vgt][mat_id.get()]
-                        = build_grid(builders[vgt]);
+                        = copy_grid(temp, temp.ids[vgt]);
                 }
 
                 // If this process has both dE/dx and xs tables, find and store
@@ -7,7 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 #include "base/CollectionMirror.hh"
 #include "base/Types.hh"
@@ -50,6 +52,18 @@ class ParticleParams;
  *   over the step, so the assumption that the cross section is constant is no
  *   longer valid. Use MC integration to sample the discrete interaction length
  *   with the correct probability.
+ *
+ * If a \c cache_filename is given, the constructed data is loaded from that
+ * file when its hash of the inputs matches; otherwise the data is built and
+ * the cache is written. Since the imported data used by the processes isn't
+ * visible here, the \c cache_key must identify it (for example, a hash of
+ * the physics input file).
+ *
+ * The step limit grids for each particle, process, and material are built
+ * concurrently on up to \c num_threads host threads (all available threads if
+ * zero) and then merged in a fixed order, so the constructed data does not
+ * depend on the number of threads. Processes must therefore allow concurrent
+ * calls to \c Process::step_limits .
  */
 class PhysicsParams
 {
@@ -85,6 +99,11 @@ class PhysicsParams
         VecProcess       processes;
 
         Options options;
+
+        std::string cache_filename; //!< Optional cache of built data
+        std::string cache_key;      //!< Identifies the imported physics data
+
+        int num_threads = 0; //!< Host threads for building grids (0 for all)
     };
 
   public:
@@ -133,12 +152,15 @@ class PhysicsParams
     CollectionMirror<PhysicsParamsData> data_;
 
   private:
-    VecModel build_models() const;
-    void     build_options(const Options& opts, HostValue* data) const;
-    void     build_ids(const ParticleParams& particles, HostValue* data) const;
-    void     build_xs(const Options&        opts,
-                      const MaterialParams& mats,
-                      HostValue*            data) const;
+    VecModel      build_models() const;
+    std::uint64_t build_cache_key(const Input& inp) const;
+    void          build_options(const Options& opts, HostValue* data) const;
+    void build_ids(const ParticleParams& particles, HostValue* data) const;
+    void build_xs(const Options&        opts,
+                  const MaterialParams& mats,
+                  int                   num_threads,
+                  HostValue*            data) const;
+    void build_hardwired(HostValue* data) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -13,6 +13,7 @@
 #include "random/distributions/BernoulliDistribution.hh"
 #include "random/distributions/GenerateCanonical.hh"
 #include "random/Selector.hh"
+#include "physics/grid/EnergyLookup.hh"
 #include "physics/grid/EnergyLossCalculator.hh"
 #include "physics/grid/InverseRangeCalculator.hh"
 #include "physics/grid/RangeCalculator.hh"
@@ -38,8 +39,9 @@ calc_tabulated_physics_step(const MaterialTrackView& material,
 
     // Loop over all processes that apply to this track (based on particle
     // type) and calculate cross section and particle range.
-    real_type total_macro_xs = 0;
-    real_type min_range      = inf;
+    real_type    total_macro_xs = 0;
+    real_type    min_range      = inf;
+    EnergyLookup lookup(particle.energy());
     for (auto ppid : range(ParticleProcessId{physics.num_particle_processes()}))
     {
         real_type process_xs = 0;
@@ -57,7 +59,7 @@ calc_tabulated_physics_step(const MaterialTrackView& material,
             // Calculate macroscopic cross section for this process, then
             // accumulate it into the total cross section and save the cross
             // section for later.
-            process_xs = physics.calc_xs(ppid, grid_id, particle.energy());
+            process_xs = physics.calc_xs(ppid, grid_id, lookup);
             total_macro_xs += process_xs;
         }
         physics.per_process_xs(ppid) = process_xs;
@@ -65,7 +67,7 @@ calc_tabulated_physics_step(const MaterialTrackView& material,
         if (auto grid_id = physics.value_grid(VGT::range, ppid))
         {
             auto calc_range = physics.make_calculator<RangeCalculator>(grid_id);
-            real_type process_range = calc_range(particle.energy());
+            real_type process_range = calc_range(lookup);
             min_range               = min(min_range, process_range);
         }
     }
@@ -148,14 +150,15 @@ CELER_FUNCTION ParticleTrackView::Energy
     const auto pre_step_energy = particle.energy();
 
     // Calculate the sum of energy loss rate over all processes.
-    real_type total_eloss_rate = 0;
+    EnergyLookup lookup(pre_step_energy);
+    real_type    total_eloss_rate = 0;
     for (auto ppid : range(ParticleProcessId{physics.num_particle_processes()}))
     {
         if (auto grid_id = physics.value_grid(VGT::energy_loss, ppid))
         {
             auto calc_eloss_rate
                 = physics.make_calculator<EnergyLossCalculator>(grid_id);
-            total_eloss_rate += calc_eloss_rate(pre_step_energy);
+            total_eloss_rate += calc_eloss_rate(lookup);
         }
     }
 
@@ -177,7 +180,7 @@ CELER_FUNCTION ParticleTrackView::Energy
                 // Recalculate beginning-of-step range (instead of storing)
                 auto calc_range
                     = physics.make_calculator<RangeCalculator>(grid_id);
-                real_type remaining_range = calc_range(pre_step_energy) - step;
+                real_type remaining_range = calc_range(lookup) - step;
                 CELER_ASSERT(remaining_range > 0);
 
                 // Calculate energy along the range curve corresponding to the
@@ -11,6 +11,7 @@
 #include "base/Macros.hh"
 #include "base/Types.hh"
 #include "physics/base/Units.hh"
+#include "physics/grid/EnergyLookup.hh"
 #include "physics/grid/GridIdFinder.hh"
 #include "physics/material/MaterialView.hh"
 #include "physics/material/Types.hh"
@@ -103,6 +104,11 @@ class PhysicsTrackView
                                             ValueGridId       grid_id,
                                             MevEnergy         energy) const;
 
+    // Calculate macroscopic cross section using a precalculated lookup
+    inline CELER_FUNCTION real_type calc_xs(ParticleProcessId ppid,
+                                            ValueGridId       grid_id,
+                                            EnergyLookup&     lookup) const;
+
     // Get hardwired model, null if not present
     inline CELER_FUNCTION ModelId hardwired_model(ParticleProcessId ppid,
                                                   MevEnergy energy) const;
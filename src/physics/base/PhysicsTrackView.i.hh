@@ -273,6 +273,21 @@ PhysicsTrackView::energy_max_xs(ParticleProcessId ppid) const
 CELER_FUNCTION real_type PhysicsTrackView::calc_xs(ParticleProcessId ppid,
                                                    ValueGridId       grid_id,
                                                    MevEnergy energy) const
+{
+    EnergyLookup lookup(energy);
+    return this->calc_xs(ppid, grid_id, lookup);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate macroscopic cross section for the process at the lookup energy.
+ *
+ * The lookup's grid location is reused by any other calculators on the same
+ * energy grid.
+ */
+CELER_FUNCTION real_type PhysicsTrackView::calc_xs(ParticleProcessId ppid,
+                                                   ValueGridId       grid_id,
+                                                   EnergyLookup& lookup) const
 {
     auto calc_xs = this->make_calculator<XsCalculator>(grid_id);
 
@@ -282,13 +297,14 @@ CELER_FUNCTION real_type PhysicsTrackView::calc_xs(ParticleProcessId ppid,
     real_type energy_max_xs = this->energy_max_xs(ppid);
     if (energy_max_xs > 0)
     {
-        real_type energy_xi = energy.value() * this->energy_fraction();
+        const MevEnergy energy    = lookup.energy();
+        real_type       energy_xi = energy.value() * this->energy_fraction();
         if (energy_max_xs >= energy_xi && energy_max_xs < energy.value())
             return calc_xs(MevEnergy{energy_max_xs});
-        return max(calc_xs(energy), calc_xs(MevEnergy{energy_xi}));
+        return max(calc_xs(lookup), calc_xs(MevEnergy{energy_xi}));
     }
 
-    return calc_xs(energy);
+    return calc_xs(lookup);
 }
 
 //---------------------------------------------------------------------------//
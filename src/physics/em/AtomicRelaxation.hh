@@ -70,12 +70,6 @@ class AtomicRelaxation
     // Angular distribution of secondaries
     IsotropicDistribution<real_type> sample_direction_;
 
-  private:
-    using TransitionId = OpaqueId<AtomicRelaxTransition>;
-
-    template<class Engine>
-    inline CELER_FUNCTION TransitionId
-    sample_transition(const AtomicRelaxSubshell& shell, Engine& rng);
 };
 
 //---------------------------------------------------------------------------//
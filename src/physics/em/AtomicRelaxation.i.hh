@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 
 #include "base/MiniStack.hh"
+#include "detail/TransitionSampler.hh"
 
 namespace celeritas
 {
@@ -74,11 +75,11 @@ AtomicRelaxation::operator()(Engine& rng)
         if (!vacancy_id)
             continue;
 
-        // Sample a transition (TODO: refactor to use Selector but with
-        // "remainder")
+        // Sample a transition from the subshell's alias table
         const AtomicRelaxSubshell& shell
             = shared_.elements[el_id_.get()].shells[vacancy_id.get()];
-        const TransitionId trans_id = this->sample_transition(shell, rng);
+        detail::TransitionSampler sample_transition(shell);
+        const auto                trans_id = sample_transition(rng);
 
         if (!trans_id)
             continue;
@@ -120,29 +121,5 @@ AtomicRelaxation::operator()(Engine& rng)
     return result;
 }
 
-//---------------------------------------------------------------------------//
-/*!
- * Sample an atomic transition.
- *
- * TODO: refactor to use a Selector-like algorithm that allows a "remainder"
- * that indicates "not sampled".
- */
-template<class Engine>
-inline CELER_FUNCTION auto
-AtomicRelaxation::sample_transition(const AtomicRelaxSubshell& shell,
-                                    Engine& rng) -> TransitionId
-{
-    real_type accum = -generate_canonical(rng);
-    for (size_type i = 0; i < shell.transitions.size(); ++i)
-    {
-        accum += shell.transitions[i].probability;
-        if (accum > 0)
-            return TransitionId{i};
-    }
-
-    // No transition was sampled: skip to the next vacancy
-    return {};
-}
-
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -28,13 +28,31 @@ struct AtomicRelaxTransition
     real_type  energy;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Walker alias table bin for sampling a subshell transition.
+ *
+ * A bin is selected uniformly: its own outcome is chosen with probability \c
+ * threshold, and the \c alias outcome is chosen otherwise.
+ */
+struct AtomicRelaxAliasBin
+{
+    real_type threshold; //!< Probability of selecting this bin's outcome
+    size_type alias;     //!< Index of the alternate outcome
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Electron subshell data.
+ *
+ * The alias table has one bin per transition plus a final bin for the
+ * probability that no transition occurs (nonzero when Auger transitions are
+ * disabled).
  */
 struct AtomicRelaxSubshell
 {
     Span<const AtomicRelaxTransition> transitions;
+    Span<const AtomicRelaxAliasBin>   alias_table;
 };
 
 //---------------------------------------------------------------------------//
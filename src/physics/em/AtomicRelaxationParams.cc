@@ -39,8 +39,8 @@ AtomicRelaxationParams::AtomicRelaxationParams(const Input& inp)
     CELER_EXPECT(electron_id_);
     CELER_EXPECT(gamma_id_);
 
-    // Reserve host space (MUST reserve subshells and transitions to avoid
-    // invalidating spans).
+    // Reserve host space (MUST reserve subshells, transitions, and alias bins
+    // to avoid invalidating spans).
     size_type ss_size = 0;
     size_type tr_size = 0;
     for (const auto& el : inp.elements)
@@ -58,6 +58,7 @@ AtomicRelaxationParams::AtomicRelaxationParams(const Input& inp)
     host_elements_.reserve(inp.elements.size());
     host_shells_.reserve(ss_size);
     host_transitions_.reserve(tr_size);
+    host_alias_bins_.reserve(tr_size + ss_size);
 
     // Find the minimum electron and photon cutoff energy for each element over
     // all materials. This is used to calculate the maximum number of
@@ -96,15 +97,21 @@ AtomicRelaxationParams::AtomicRelaxationParams(const Input& inp)
         device_shells_ = DeviceVector<AtomicRelaxSubshell>(host_shells_.size());
         device_transitions_
             = DeviceVector<AtomicRelaxTransition>(host_transitions_.size());
+        device_alias_bins_
+            = DeviceVector<AtomicRelaxAliasBin>(host_alias_bins_.size());
 
-        // Remap shell->transition spans
+        // Remap shell->transition and shell->alias table spans
         auto remap_transitions
             = make_span_remapper(make_span(host_transitions_),
                                  device_transitions_.device_pointers());
+        auto remap_alias_bins
+            = make_span_remapper(make_span(host_alias_bins_),
+                                 device_alias_bins_.device_pointers());
         std::vector<AtomicRelaxSubshell> temp_device_shells = host_shells_;
         for (AtomicRelaxSubshell& ss : temp_device_shells)
         {
             ss.transitions = remap_transitions(ss.transitions);
+            ss.alias_table = remap_alias_bins(ss.alias_table);
         }
 
         // Remap element->shell spans
@@ -120,6 +127,7 @@ AtomicRelaxationParams::AtomicRelaxationParams(const Input& inp)
         device_elements_.copy_to_device(make_span(temp_device_elements));
         device_shells_.copy_to_device(make_span(temp_device_shells));
         device_transitions_.copy_to_device(make_span(host_transitions_));
+        device_alias_bins_.copy_to_device(make_span(host_alias_bins_));
     }
 
     CELER_ENSURE(host_elements_.size() == inp.elements.size());
@@ -236,6 +244,10 @@ AtomicRelaxationParams::extend_shells(const ImportAtomicRelaxation& inp)
         {
             result[i].transitions = fluor;
         }
+
+        // Precompute the table for sampling a transition in constant time
+        result[i].alias_table
+            = this->extend_alias_table(result[i].transitions);
     }
 
     return result;
@@ -269,5 +281,24 @@ Span<AtomicRelaxTransition> AtomicRelaxationParams::extend_transitions(
     return {host_transitions_.data() + start, transitions.size()};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and store the alias table for sampling the given transitions.
+ */
+Span<AtomicRelaxAliasBin> AtomicRelaxationParams::extend_alias_table(
+    Span<const AtomicRelaxTransition> transitions)
+{
+    CELER_EXPECT(host_alias_bins_.size() + transitions.size() + 1
+                 <= host_alias_bins_.capacity());
+
+    auto start = host_alias_bins_.size();
+    host_alias_bins_.resize(start + transitions.size() + 1);
+
+    Span<AtomicRelaxAliasBin> result{host_alias_bins_.data() + start,
+                                     transitions.size() + 1};
+    detail::fill_alias_table(transitions, result);
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -62,12 +62,14 @@ class AtomicRelaxationParams
     std::vector<AtomicRelaxElement>    host_elements_;
     std::vector<AtomicRelaxSubshell>   host_shells_;
     std::vector<AtomicRelaxTransition> host_transitions_;
+    std::vector<AtomicRelaxAliasBin>   host_alias_bins_;
 
     //// DEVICE DATA ////
 
     DeviceVector<AtomicRelaxElement>    device_elements_;
     DeviceVector<AtomicRelaxSubshell>   device_shells_;
     DeviceVector<AtomicRelaxTransition> device_transitions_;
+    DeviceVector<AtomicRelaxAliasBin>   device_alias_bins_;
 
     // HELPER FUNCTIONS
     void append_element(const ImportAtomicRelaxation& inp,
@@ -77,6 +79,8 @@ class AtomicRelaxationParams
     Span<AtomicRelaxSubshell> extend_shells(const ImportAtomicRelaxation& inp);
     Span<AtomicRelaxTransition>
     extend_transitions(const std::vector<ImportAtomicTransition>& transitions);
+    Span<AtomicRelaxAliasBin>
+    extend_alias_table(Span<const AtomicRelaxTransition> transitions);
 };
 
 //---------------------------------------------------------------------------//
@@ -49,6 +49,15 @@ auto BetheHeitlerModel::applicability() const -> SetApplicability
     return {photon_applic};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the interaction kernel on host.
+ */
+void BetheHeitlerModel::interact(const HostInteractRefs& pointers) const
+{
+    detail::bethe_heitler_interact(interface_, pointers);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Apply the interaction kernel.
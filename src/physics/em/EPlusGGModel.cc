@@ -50,6 +50,15 @@ auto EPlusGGModel::applicability() const -> SetApplicability
     return {Applicability::at_rest(interface_.positron_id), in_flight};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the interaction kernel on host.
+ */
+void EPlusGGModel::interact(const HostInteractRefs& pointers) const
+{
+    detail::eplusgg_interact(interface_, pointers);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Apply the interaction kernel.
@@ -27,6 +27,9 @@ class EPlusGGModel final : public Model
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
 
+    // Apply the interaction kernel on host
+    void interact(const HostInteractRefs&) const final;
+
     // Apply the interaction kernel
     void interact(const DeviceInteractRefs&) const final;
 
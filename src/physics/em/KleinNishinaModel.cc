@@ -47,6 +47,15 @@ auto KleinNishinaModel::applicability() const -> SetApplicability
     return {photon_applic};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the interaction kernel on host.
+ */
+void KleinNishinaModel::interact(const HostInteractRefs& pointers) const
+{
+    detail::klein_nishina_interact(interface_, pointers);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Apply the interaction kernel.
@@ -10,6 +10,7 @@
 #include "base/Assert.hh"
 #include "base/CollectionBuilder.hh"
 #include "comm/Device.hh"
+#include "io/ReadElements.hh"
 #include "physics/base/PDGNumber.hh"
 
 namespace celeritas
@@ -17,6 +18,9 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Construct from model ID and other necessary data.
+ *
+ * The data for all elements is read concurrently with \c read_elements,
+ * so \c load_data must be safe to call from multiple threads.
  */
 LivermorePEModel::LivermorePEModel(ModelId               id,
                                    const ParticleParams& particles,
@@ -43,17 +47,25 @@ LivermorePEModel::LivermorePEModel(ModelId               id,
     host_data.inv_electron_mass
         = 1 / particles.get(host_data.ids.electron).mass().value();
 
+    // Read Livermore cross section data for all elements concurrently
+    std::vector<AtomicNumber> z_numbers;
+    for (auto el_id : range(ElementId{materials.num_elements()}))
+    {
+        z_numbers.push_back(materials.get(el_id).atomic_number());
+    }
+    std::vector<ImportLivermorePE> el_data
+        = read_elements(load_data, z_numbers);
+
     // Load Livermore cross section data
     make_builder(&host_data.xs.elements).reserve(materials.num_elements());
-    for (auto el_id : range(ElementId{materials.num_elements()}))
+    for (const ImportLivermorePE& inp : el_data)
     {
-        AtomicNumber z = materials.get(el_id).atomic_number();
-        this->append_element(load_data(z), &host_data.xs);
+        this->append_element(inp, &host_data.xs);
     }
     CELER_ASSERT(host_data.xs.elements.size() == materials.num_elements());
 
     // Add atomic relaxation data
-    if (atomic_relaxation)
+    if (atomic_relaxation && celeritas::device())
     {
         CELER_ASSERT(num_vacancies > 0);
         resize(&relax_scratch_.vacancies, num_vacancies);
@@ -63,6 +75,15 @@ LivermorePEModel::LivermorePEModel(ModelId               id,
 
     // Move to mirrored data, copying to device
     data_ = CollectionMirror<detail::LivermorePEData>{std::move(host_data)};
+
+    // The relaxation data isn't mirrored, so point the host data to host
+    // storage
+    host_ref_ = data_.host();
+    if (atomic_relaxation)
+    {
+        host_ref_.atomic_relaxation = atomic_relaxation->host_pointers();
+    }
+    atomic_relaxation_ = std::move(atomic_relaxation);
     CELER_ENSURE(this->data_);
 }
 
@@ -80,6 +101,15 @@ auto LivermorePEModel::applicability() const -> SetApplicability
     return {photon_applic};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the interaction kernel on host.
+ */
+void LivermorePEModel::interact(const HostInteractRefs& pointers) const
+{
+    detail::livermore_pe_interact(this->host_pointers(), pointers);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Apply the interaction kernel.
@@ -52,6 +52,9 @@ class LivermorePEModel final : public Model
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
 
+    // Apply the interaction kernel on host
+    void interact(const HostInteractRefs&) const final;
+
     // Apply the interaction kernel
     void interact(const DeviceInteractRefs&) const final;
 
@@ -62,7 +65,7 @@ class LivermorePEModel final : public Model
     std::string label() const final { return "Livermore photoelectric"; }
 
     //! Access data on the host
-    const HostRef& host_pointers() const { return data_.host(); }
+    const HostRef& host_pointers() const { return host_ref_; }
 
     //! Access data on the device
     const DeviceRef& device_pointers() const { return data_.device(); }
@@ -70,6 +73,8 @@ class LivermorePEModel final : public Model
   private:
     // Host/device storage and reference
     CollectionMirror<detail::LivermorePEData> data_;
+    HostRef                                   host_ref_;
+    SPConstAtomicRelax                        atomic_relaxation_;
 
     detail::RelaxationScratchData<Ownership::value, MemSpace::device>
         relax_scratch_;
@@ -58,6 +58,15 @@ auto MollerBhabhaModel::applicability() const -> SetApplicability
     return {electron_applic, positron_applic};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the interaction kernel on host.
+ */
+void MollerBhabhaModel::interact(const HostInteractRefs& pointers) const
+{
+    detail::moller_bhabha_interact(interface_, pointers);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Apply the interaction kernel.
@@ -55,6 +55,15 @@ auto RayleighModel::applicability() const -> SetApplicability
     return {rayleigh_scattering};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the interaction kernel on host.
+ */
+void RayleighModel::interact(const HostInteractRefs& pointers) const
+{
+    detail::rayleigh_interact(this->host_group(), pointers);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Apply the interaction kernel.
@@ -40,6 +40,9 @@ class RayleighModel final : public Model
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
 
+    // Apply the interaction kernel to host data
+    void interact(const HostInteractRefs&) const final;
+
     // Apply the interaction kernel to device data
     void interact(const DeviceInteractRefs&) const final;
 
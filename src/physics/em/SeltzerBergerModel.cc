@@ -8,11 +8,13 @@
 #include "SeltzerBergerModel.hh"
 
 #include <algorithm>
+#include <cmath>
 #include "base/Assert.hh"
 #include "base/CollectionBuilder.hh"
 #include "comm/Logger.hh"
 #include "base/Join.hh"
 #include "base/Range.hh"
+#include "io/ReadElements.hh"
 #include "physics/base/ParticleParams.hh"
 #include "physics/base/PDGNumber.hh"
 #include "physics/material/MaterialParams.hh"
@@ -22,11 +24,15 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Construct from model ID and other necessary data.
+ *
+ * The data for all elements is read concurrently with \c read_elements,
+ * so \c load_sb_table must be safe to call from multiple threads.
  */
 SeltzerBergerModel::SeltzerBergerModel(ModelId               id,
                                        const ParticleParams& particles,
                                        const MaterialParams& materials,
-                                       ReadData              load_sb_table)
+                                       ReadData              load_sb_table,
+                                       EnergySampling        sampling)
 {
     CELER_EXPECT(id);
     CELER_EXPECT(load_sb_table);
@@ -46,13 +52,21 @@ SeltzerBergerModel::SeltzerBergerModel(ModelId               id,
     // Save particle properties
     host_data.electron_mass = particles.get(host_data.ids.electron).mass();
 
+    // Read differential cross sections for all elements concurrently
+    std::vector<AtomicNumber> z_numbers;
+    for (auto el_id : range(ElementId{materials.num_elements()}))
+    {
+        z_numbers.push_back(materials.get(el_id).atomic_number());
+    }
+    std::vector<ImportSBTable> tables
+        = read_elements(load_sb_table, z_numbers);
+
     // Load differential cross sections
     make_builder(&host_data.differential_xs.elements)
         .reserve(materials.num_elements());
-    for (auto el_id : range(ElementId{materials.num_elements()}))
+    for (const ImportSBTable& table : tables)
     {
-        AtomicNumber z_number = materials.get(el_id).atomic_number();
-        this->append_table(load_sb_table(z_number), &host_data.differential_xs);
+        this->append_table(table, sampling, &host_data.differential_xs);
     }
     CELER_ASSERT(host_data.differential_xs.elements.size()
                  == materials.num_elements());
@@ -84,6 +98,15 @@ auto SeltzerBergerModel::applicability() const -> SetApplicability
     return {electron_applic, positron_applic};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the interaction kernel on host.
+ */
+void SeltzerBergerModel::interact(const HostInteractRefs& pointers) const
+{
+    detail::seltzer_berger_interact(this->host_pointers(), pointers);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Apply the interaction kernel.
@@ -116,6 +139,7 @@ ModelId SeltzerBergerModel::model_id() const
  * and values are the cross sections.
  */
 void SeltzerBergerModel::append_table(const ImportSBTable& imported,
+                                      EnergySampling       sampling,
                                       HostXsTables*        tables) const
 {
     auto reals = make_builder(&tables->reals);
@@ -156,6 +180,12 @@ void SeltzerBergerModel::append_table(const ImportSBTable& imported,
     table.argmax
         = make_builder(&tables->sizes).insert_back(argmax.begin(), argmax.end());
 
+    if (sampling == EnergySampling::inverse_cdf)
+    {
+        // Tabulate the cumulative DCS for sampling without rejection
+        this->append_cdf(imported, &table, tables);
+    }
+
     // Add the table
     make_builder(&tables->elements).push_back(table);
 
@@ -165,5 +195,77 @@ void SeltzerBergerModel::append_table(const ImportSBTable& imported,
     CELER_ENSURE(table.grid);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct cumulative DCS tables for a single element.
+ *
+ * Each interval of the reduced exiting energy grid is uniformly subdivided so
+ * that the DCS varies little inside each subinterval, since the sampler
+ * assumes a constant probability density in \f$ \ln \kappa \f$ there. The
+ * cumulative values at the grid points are exact integrals of
+ * \f$ \chi(\kappa) / \kappa \f$ for the linearly interpolated DCS.
+ */
+void SeltzerBergerModel::append_cdf(const ImportSBTable&        imported,
+                                    detail::SBElementTableData* element,
+                                    HostXsTables*               tables) const
+{
+    // Number of subintervals per reduced exiting energy grid interval
+    constexpr size_type num_subdivisions = 4;
+
+    const auto&     y     = imported.y;
+    const size_type num_x = imported.x.size();
+    const size_type num_y = y.size();
+    CELER_ASSERT(y.front() > 0);
+
+    // Construct the refined reduced exiting energy grid
+    std::vector<real_type> kappa;
+    kappa.reserve((num_y - 1) * num_subdivisions + 1);
+    for (size_type j : range(num_y - 1))
+    {
+        real_type delta = (y[j + 1] - y[j]) / num_subdivisions;
+        for (size_type k : range(num_subdivisions))
+        {
+            kappa.push_back(y[j] + k * delta);
+        }
+    }
+    kappa.push_back(y.back());
+
+    std::vector<real_type> log_y(kappa.size());
+    std::transform(kappa.begin(), kappa.end(), log_y.begin(), [](real_type k) {
+        return std::log(k);
+    });
+
+    // Integrate the DCS, which is linear in kappa between the original grid
+    // points, over d(kappa) / kappa
+    std::vector<real_type> cdf;
+    cdf.reserve(num_x * kappa.size());
+    for (size_type i : range(num_x))
+    {
+        const double* xs    = &imported.value[i * num_y];
+        real_type     accum = 0;
+        cdf.push_back(accum);
+        for (size_type j : range(num_y - 1))
+        {
+            real_type slope = (xs[j + 1] - xs[j]) / (y[j + 1] - y[j]);
+            for (size_type k : range(num_subdivisions))
+            {
+                real_type lower    = kappa[j * num_subdivisions + k];
+                real_type upper    = kappa[j * num_subdivisions + k + 1];
+                real_type xs_lower = xs[j] + slope * (lower - y[j]);
+                accum += (xs_lower - slope * lower) * std::log(upper / lower)
+                         + slope * (upper - lower);
+                cdf.push_back(accum);
+            }
+        }
+    }
+
+    auto reals          = make_builder(&tables->reals);
+    element->cdf.log_y  = reals.insert_back(log_y.begin(), log_y.end());
+    element->cdf.values = reals.insert_back(cdf.begin(), cdf.end());
+
+    CELER_ENSURE(element->cdf.values.size() == num_x * kappa.size());
+    CELER_ENSURE(element->cdf);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -40,6 +40,11 @@ class ParticleParams;
  * energy spectra from electrons with kinetic energy 1 keV–10 GeV incident on
  * screened nuclei and orbital electrons of neutral atoms with Z = 1–100", At.
  * Data Nucl. Data Tables 35, 345–418.
+ *
+ * By default the exiting photon energy is sampled by rejection. With
+ * \c EnergySampling::inverse_cdf, cumulative tables of the scaled DCS are
+ * built for each element and incident energy grid point so that the energy
+ * can be sampled with a fixed number of table lookups.
  */
 class SeltzerBergerModel final : public Model
 {
@@ -53,16 +58,27 @@ class SeltzerBergerModel final : public Model
         = detail::SeltzerBergerData<Ownership::const_reference, MemSpace::device>;
     //!@}
 
+    //! Algorithm for sampling the exiting photon energy
+    enum class EnergySampling
+    {
+        rejection,   //!< Rejection against the maximum tabulated DCS
+        inverse_cdf, //!< Inversion of precomputed cumulative tables
+    };
+
   public:
     // Construct from model ID and other necessary data
     SeltzerBergerModel(ModelId               id,
                        const ParticleParams& particles,
                        const MaterialParams& materials,
-                       ReadData              load_sb_table);
+                       ReadData              load_sb_table,
+                       EnergySampling sampling = EnergySampling::rejection);
 
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
 
+    // Apply the interaction kernel on host
+    void interact(const HostInteractRefs&) const final;
+
     // Apply the interaction kernel
     void interact(const DeviceInteractRefs&) const final;
 
@@ -84,7 +100,12 @@ class SeltzerBergerModel final : public Model
 
     using HostXsTables
         = detail::SeltzerBergerTableData<Ownership::value, MemSpace::host>;
-    void append_table(const ImportSBTable& table, HostXsTables* tables) const;
+    void append_table(const ImportSBTable& table,
+                      EnergySampling       sampling,
+                      HostXsTables*        tables) const;
+    void append_cdf(const ImportSBTable&        table,
+                    detail::SBElementTableData* element,
+                    HostXsTables*               tables) const;
 };
 
 //---------------------------------------------------------------------------//
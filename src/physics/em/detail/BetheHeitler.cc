@@ -0,0 +1,33 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BetheHeitler.cc
+//---------------------------------------------------------------------------//
+#include "BetheHeitler.hh"
+
+#include "base/Assert.hh"
+#include "HostInteractLoop.hh"
+#include "BetheHeitlerLauncher.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Bethe-Heitler interaction on the host.
+ */
+void bethe_heitler_interact(const BetheHeitlerPointers&              bh,
+                            const ModelInteractRefs<MemSpace::host>& model)
+{
+    CELER_EXPECT(bh);
+    CELER_EXPECT(model);
+
+    host_interact_loop(model, BetheHeitlerLauncher<MemSpace::host>(bh, model));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
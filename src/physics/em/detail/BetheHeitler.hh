@@ -53,6 +53,11 @@ void bethe_heitler_interact(
     const BetheHeitlerPointers&                device_pointers,
     const ModelInteractRefs<MemSpace::device>& interaction);
 
+// Apply the Bethe-Heitler interaction on the host
+void bethe_heitler_interact(
+    const BetheHeitlerPointers&              pointers,
+    const ModelInteractRefs<MemSpace::host>& interaction);
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BetheHeitlerLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/StackAllocator.hh"
+#include "base/Types.hh"
+#include "random/RngEngine.hh"
+#include "physics/base/ModelInterface.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/PhysicsTrackView.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "BetheHeitler.hh"
+#include "BetheHeitlerInteractor.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Bethe-Heitler model to a single track.
+ *
+ * This is shared by the device kernel and the host loop.
+ */
+template<MemSpace M>
+struct BetheHeitlerLauncher
+{
+    CELER_FUNCTION BetheHeitlerLauncher(const BetheHeitlerPointers& bh,
+                                        const ModelInteractRefs<M>& model)
+        : bh(bh), model(model)
+    {
+    }
+
+    const BetheHeitlerPointers& bh;    //!< Shared model data
+    const ModelInteractRefs<M>& model; //!< State data needed to interact
+
+    //! Create track views and launch interaction
+    inline CELER_FUNCTION void
+    operator()(ThreadId tid, StackAllocator<Secondary>& allocate) const;
+};
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void
+BetheHeitlerLauncher<M>::operator()(ThreadId                   tid,
+                                    StackAllocator<Secondary>& allocate) const
+{
+    ParticleTrackView particle(
+        model.params.particle, model.states.particle, tid);
+
+    // Setup for ElementView access
+    MaterialTrackView material(
+        model.params.material, model.states.material, tid);
+    // Cache the associated MaterialView as function calls to MaterialTrackView
+    // are expensive
+    MaterialView material_view = material.material_view();
+
+    PhysicsTrackView physics(model.params.physics,
+                             model.states.physics,
+                             particle.particle_id(),
+                             material.material_id(),
+                             tid);
+
+    // Only tracks that selected the Bethe-Heitler model are dispatched here
+    CELER_ASSERT(physics.model_id() == bh.model_id);
+
+    // Assume only a single element in the material, for now
+    CELER_ASSERT(material_view.num_elements() == 1);
+    BetheHeitlerInteractor interact(
+        bh,
+        particle,
+        model.states.direction[tid],
+        allocate,
+        material_view.element_view(celeritas::ElementComponentId{0}));
+
+    RngEngine rng(model.states.rng, tid);
+    model.states.interactions[tid] = interact(rng);
+    CELER_ENSURE(model.states.interactions[tid]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,33 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EPlusGG.cc
+//---------------------------------------------------------------------------//
+#include "EPlusGG.hh"
+
+#include "base/Assert.hh"
+#include "HostInteractLoop.hh"
+#include "EPlusGGLauncher.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the EPlusGG interaction on the host.
+ */
+void eplusgg_interact(const EPlusGGPointers&                   epgg,
+                      const ModelInteractRefs<MemSpace::host>& model)
+{
+    CELER_EXPECT(epgg);
+    CELER_EXPECT(model);
+
+    host_interact_loop(model, EPlusGGLauncher<MemSpace::host>(epgg, model));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -9,12 +9,7 @@
 
 #include "base/Assert.hh"
 #include "base/KernelParamCalculator.cuda.hh"
-#include "random/RngEngine.hh"
-#include "physics/base/ModelInterface.hh"
-#include "physics/base/ParticleTrackView.hh"
-#include "physics/base/PhysicsTrackView.hh"
-#include "base/StackAllocator.hh"
-#include "EPlusGGInteractor.hh"
+#include "EPlusGGLauncher.hh"
 
 namespace celeritas
 {
@@ -33,31 +28,13 @@ eplusgg_interact_kernel(const EPlusGGPointers                     epgg,
                         const ModelInteractRefs<MemSpace::device> model)
 {
     // Get the thread id
-    auto tid = celeritas::KernelParamCalculator::thread_id();
-    if (!(tid < model.states.size()))
+    auto idx = celeritas::KernelParamCalculator::thread_id();
+    if (!(idx < model.thread_ids.size()))
         return;
 
-    // Get views to this Secondary, Particle, and Physics
     StackAllocator<Secondary> allocate_secondaries(model.states.secondaries);
-    ParticleTrackView         particle(
-        model.params.particle, model.states.particle, tid);
-    PhysicsTrackView physics(model.params.physics,
-                             model.states.physics,
-                             particle.particle_id(),
-                             MaterialId{},
-                             tid);
-
-    // This interaction only applies if the EPlusGG model was selected
-    if (physics.model_id() != epgg.model_id)
-        return;
-
-    // Do the interaction
-    EPlusGGInteractor interact(
-        epgg, particle, model.states.direction[tid], allocate_secondaries);
-    RngEngine rng(model.states.rng, tid);
-    model.states.interactions[tid] = interact(rng);
-
-    CELER_ENSURE(model.states.interactions[tid]);
+    EPlusGGLauncher<MemSpace::device> launch(epgg, model);
+    launch(model.thread_ids[idx.get()], allocate_secondaries);
 }
 
 } // namespace
@@ -77,7 +54,7 @@ void eplusgg_interact(const EPlusGGPointers&                     eplusgg,
     // Calculate kernel launch params
     static const KernelParamCalculator calc_kernel_params(
         eplusgg_interact_kernel, "eplusgg_interact");
-    auto params = calc_kernel_params(model.states.size());
+    auto params = calc_kernel_params(model.thread_ids.size());
 
     // Launch the kernel
     eplusgg_interact_kernel<<<params.grid_size, params.block_size>>>(eplusgg,
@@ -49,6 +49,10 @@ struct EPlusGGPointers
 void eplusgg_interact(const EPlusGGPointers&                     eplusgg,
                       const ModelInteractRefs<MemSpace::device>& model);
 
+// Apply the EPlusGG interaction on the host
+void eplusgg_interact(const EPlusGGPointers&                   eplusgg,
+                      const ModelInteractRefs<MemSpace::host>& model);
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
@@ -0,0 +1,77 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EPlusGGLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/StackAllocator.hh"
+#include "base/Types.hh"
+#include "random/RngEngine.hh"
+#include "physics/base/ModelInterface.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/PhysicsTrackView.hh"
+#include "EPlusGG.hh"
+#include "EPlusGGInteractor.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the positron annihilation model to a single track.
+ *
+ * This is shared by the device kernel and the host loop.
+ */
+template<MemSpace M>
+struct EPlusGGLauncher
+{
+    CELER_FUNCTION EPlusGGLauncher(const EPlusGGPointers&      epgg,
+                                   const ModelInteractRefs<M>& model)
+        : epgg(epgg), model(model)
+    {
+    }
+
+    const EPlusGGPointers&      epgg;  //!< Shared model data
+    const ModelInteractRefs<M>& model; //!< State data needed to interact
+
+    //! Create track views and launch interaction
+    inline CELER_FUNCTION void
+    operator()(ThreadId tid, StackAllocator<Secondary>& allocate) const;
+};
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void
+EPlusGGLauncher<M>::operator()(ThreadId                   tid,
+                               StackAllocator<Secondary>& allocate) const
+{
+    // Get views to this Particle and Physics
+    ParticleTrackView particle(
+        model.params.particle, model.states.particle, tid);
+    PhysicsTrackView physics(model.params.physics,
+                             model.states.physics,
+                             particle.particle_id(),
+                             MaterialId{},
+                             tid);
+
+    // Only tracks that selected the EPlusGG model are dispatched here
+    CELER_ASSERT(physics.model_id() == epgg.model_id);
+
+    // Do the interaction
+    EPlusGGInteractor interact(
+        epgg, particle, model.states.direction[tid], allocate);
+    RngEngine rng(model.states.rng, tid);
+    model.states.interactions[tid] = interact(rng);
+
+    CELER_ENSURE(model.states.interactions[tid]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,70 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HostInteractLoop.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "celeritas_config.h"
+#include "base/StackAllocator.hh"
+#include "base/Types.hh"
+#include "physics/base/Model.hh"
+#include "physics/base/ModelInterface.hh"
+#include "physics/base/Secondary.hh"
+
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply an interaction launcher to every track that selected a model.
+ *
+ * This is the host analog of launching an interaction kernel over \c
+ * model.thread_ids . The launcher is called as
+ * \code
+   launch(ThreadId tid, StackAllocator<Secondary>& allocate_secondaries)
+   \endcode
+ * When OpenMP is enabled the track slots are distributed across host threads,
+ * and each thread allocates its secondaries through its own chunked
+ * allocator to avoid contending on the shared stack size. The unused end of
+ * each thread's last chunk is left empty (see \c host_secondary_overhead).
+ */
+template<class Launcher>
+inline void host_interact_loop(const ModelInteractRefs<MemSpace::host>& model,
+                               const Launcher&                          launch)
+{
+    CELER_EXPECT(model);
+
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel
+    {
+        StackAllocator<Secondary> allocate_secondaries
+            = omp_get_num_threads() > 1
+                  ? StackAllocator<Secondary>(model.states.secondaries,
+                                              host_secondary_chunk_size)
+                  : StackAllocator<Secondary>(model.states.secondaries);
+#    pragma omp for
+        for (size_type i = 0; i < model.thread_ids.size(); ++i)
+        {
+            launch(model.thread_ids[i], allocate_secondaries);
+        }
+    }
+#else
+    StackAllocator<Secondary> allocate_secondaries(model.states.secondaries);
+    for (ThreadId tid : model.thread_ids)
+    {
+        launch(tid, allocate_secondaries);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
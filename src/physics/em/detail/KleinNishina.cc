@@ -0,0 +1,33 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file KleinNishina.cc
+//---------------------------------------------------------------------------//
+#include "KleinNishina.hh"
+
+#include "base/Assert.hh"
+#include "HostInteractLoop.hh"
+#include "KleinNishinaLauncher.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the KN interaction on the host.
+ */
+void klein_nishina_interact(const KleinNishinaPointers&              kn,
+                            const ModelInteractRefs<MemSpace::host>& model)
+{
+    CELER_EXPECT(kn);
+    CELER_EXPECT(model);
+
+    host_interact_loop(model, KleinNishinaLauncher<MemSpace::host>(kn, model));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
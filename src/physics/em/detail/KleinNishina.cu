@@ -9,12 +9,7 @@
 
 #include "base/Assert.hh"
 #include "base/KernelParamCalculator.cuda.hh"
-#include "random/RngEngine.hh"
-#include "physics/base/ModelInterface.hh"
-#include "physics/base/ParticleTrackView.hh"
-#include "physics/base/PhysicsTrackView.hh"
-#include "base/StackAllocator.hh"
-#include "KleinNishinaInteractor.hh"
+#include "KleinNishinaLauncher.hh"
 
 namespace celeritas
 {
@@ -32,30 +27,13 @@ __global__ void
 klein_nishina_interact_kernel(const KleinNishinaPointers                kn,
                               const ModelInteractRefs<MemSpace::device> model)
 {
-    auto tid = celeritas::KernelParamCalculator::thread_id();
-    if (!(tid < model.states.size()))
+    auto idx = celeritas::KernelParamCalculator::thread_id();
+    if (!(idx < model.thread_ids.size()))
         return;
 
     StackAllocator<Secondary> allocate_secondaries(model.states.secondaries);
-    ParticleTrackView         particle(
-        model.params.particle, model.states.particle, tid);
-
-    PhysicsTrackView physics(model.params.physics,
-                             model.states.physics,
-                             particle.particle_id(),
-                             MaterialId{},
-                             tid);
-
-    // This interaction only applies if the KN model was selected
-    if (physics.model_id() != kn.model_id)
-        return;
-
-    KleinNishinaInteractor interact(
-        kn, particle, model.states.direction[tid], allocate_secondaries);
-
-    RngEngine rng(model.states.rng, tid);
-    model.states.interactions[tid] = interact(rng);
-    CELER_ENSURE(model.states.interactions[tid]);
+    KleinNishinaLauncher<MemSpace::device> launch(kn, model);
+    launch(model.thread_ids[idx.get()], allocate_secondaries);
 }
 
 } // namespace
@@ -74,7 +52,7 @@ void klein_nishina_interact(const KleinNishinaPointers&                kn,
 
     static const KernelParamCalculator calc_kernel_params(
         klein_nishina_interact_kernel, "klein_nishina_interact");
-    auto params = calc_kernel_params(model.states.size());
+    auto params = calc_kernel_params(model.thread_ids.size());
     klein_nishina_interact_kernel<<<params.grid_size, params.block_size>>>(
         kn, model);
     CELER_CUDA_CHECK_ERROR();
@@ -50,6 +50,11 @@ void klein_nishina_interact(
     const KleinNishinaPointers&                device_pointers,
     const ModelInteractRefs<MemSpace::device>& interaction);
 
+// Apply the KN interaction on the host
+void klein_nishina_interact(
+    const KleinNishinaPointers&              pointers,
+    const ModelInteractRefs<MemSpace::host>& interaction);
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
@@ -0,0 +1,76 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file KleinNishinaLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/StackAllocator.hh"
+#include "base/Types.hh"
+#include "random/RngEngine.hh"
+#include "physics/base/ModelInterface.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/PhysicsTrackView.hh"
+#include "KleinNishina.hh"
+#include "KleinNishinaInteractor.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Klein-Nishina model to a single track.
+ *
+ * This is shared by the device kernel and the host loop.
+ */
+template<MemSpace M>
+struct KleinNishinaLauncher
+{
+    CELER_FUNCTION KleinNishinaLauncher(const KleinNishinaPointers& kn,
+                                        const ModelInteractRefs<M>& model)
+        : kn(kn), model(model)
+    {
+    }
+
+    const KleinNishinaPointers& kn;    //!< Shared model data
+    const ModelInteractRefs<M>& model; //!< State data needed to interact
+
+    //! Create track views and launch interaction
+    inline CELER_FUNCTION void
+    operator()(ThreadId tid, StackAllocator<Secondary>& allocate) const;
+};
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void
+KleinNishinaLauncher<M>::operator()(ThreadId                   tid,
+                                    StackAllocator<Secondary>& allocate) const
+{
+    ParticleTrackView particle(
+        model.params.particle, model.states.particle, tid);
+
+    PhysicsTrackView physics(model.params.physics,
+                             model.states.physics,
+                             particle.particle_id(),
+                             MaterialId{},
+                             tid);
+
+    // Only tracks that selected the KN model are dispatched here
+    CELER_ASSERT(physics.model_id() == kn.model_id);
+
+    KleinNishinaInteractor interact(
+        kn, particle, model.states.direction[tid], allocate);
+
+    RngEngine rng(model.states.rng, tid);
+    model.states.interactions[tid] = interact(rng);
+    CELER_ENSURE(model.states.interactions[tid]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,55 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LivermorePE.cc
+//---------------------------------------------------------------------------//
+#include "LivermorePE.hh"
+
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+#include "HostInteractLoop.hh"
+#include "LivermorePELauncher.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Livermore photoelectric interaction on the host.
+ *
+ * When atomic relaxation is enabled, a vacancy stack with room for the
+ * deepest relaxation cascade of every track in this launch is allocated up
+ * front and shared by all threads.
+ */
+void livermore_pe_interact(const LivermorePEHostRef&                pe,
+                           const ModelInteractRefs<MemSpace::host>& model)
+{
+    CELER_EXPECT(pe);
+    CELER_EXPECT(model);
+
+    RelaxationScratchData<Ownership::value, MemSpace::host>     scratch;
+    RelaxationScratchData<Ownership::reference, MemSpace::host> scratch_ref;
+    if (pe.atomic_relaxation)
+    {
+        size_type max_stack_size = 1;
+        for (const AtomicRelaxElement& el : pe.atomic_relaxation.elements)
+        {
+            max_stack_size = celeritas::max(max_stack_size, el.max_stack_size);
+        }
+        resize(&scratch.vacancies, max_stack_size * model.thread_ids.size());
+        scratch_ref = scratch;
+    }
+
+    LivermorePELauncher<MemSpace::host> launch(pe, model);
+    host_interact_loop(
+        model, [&](ThreadId tid, StackAllocator<Secondary>& allocate) {
+            launch(tid, allocate, scratch_ref);
+        });
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -8,15 +8,7 @@
 #include "LivermorePE.hh"
 
 #include "base/KernelParamCalculator.cuda.hh"
-#include "random/RngEngine.hh"
-#include "physics/base/ModelInterface.hh"
-#include "physics/base/ParticleTrackView.hh"
-#include "physics/base/PhysicsTrackView.hh"
-#include "base/StackAllocator.hh"
-#include "physics/material/ElementSelector.hh"
-#include "physics/material/MaterialTrackView.hh"
-#include "LivermorePEInteractor.hh"
-#include "LivermorePEMicroXsCalculator.hh"
+#include "LivermorePELauncher.hh"
 
 namespace celeritas
 {
@@ -35,46 +27,13 @@ livermore_pe_interact_kernel(const LivermorePEDeviceRef                pe,
                              const RelaxationScratchDeviceRef&         scratch,
                              const ModelInteractRefs<MemSpace::device> model)
 {
-    auto tid = celeritas::KernelParamCalculator::thread_id();
-    if (!(tid < model.states.size()))
+    auto idx = celeritas::KernelParamCalculator::thread_id();
+    if (!(idx < model.thread_ids.size()))
         return;
 
     StackAllocator<Secondary> allocate_secondaries(model.states.secondaries);
-    ParticleTrackView         particle(
-        model.params.particle, model.states.particle, tid);
-    MaterialTrackView material(
-        model.params.material, model.states.material, tid);
-    PhysicsTrackView physics(model.params.physics,
-                             model.states.physics,
-                             particle.particle_id(),
-                             material.material_id(),
-                             tid);
-    CutoffView       cutoffs(model.params.cutoffs, material.material_id());
-
-    // This interaction only applies if the Livermore PE model was selected
-    if (physics.model_id() != pe.ids.model)
-        return;
-
-    RngEngine rng(model.states.rng, tid);
-
-    // Sample an element
-    ElementSelector select_el(
-        material.material_view(),
-        LivermorePEMicroXsCalculator{pe, particle.energy()},
-        material.element_scratch());
-    ElementComponentId comp_id = select_el(rng);
-    ElementId          el_id   = material.material_view().element_id(comp_id);
-
-    LivermorePEInteractor interact(pe,
-                                   scratch,
-                                   el_id,
-                                   particle,
-                                   cutoffs,
-                                   model.states.direction[tid],
-                                   allocate_secondaries);
-
-    model.states.interactions[tid] = interact(rng);
-    CELER_ENSURE(model.states.interactions[tid]);
+    LivermorePELauncher<MemSpace::device> launch(pe, model);
+    launch(model.thread_ids[idx.get()], allocate_secondaries, scratch);
 }
 
 } // namespace
@@ -94,7 +53,7 @@ void livermore_pe_interact(const LivermorePEDeviceRef&                pe,
 
     static const KernelParamCalculator calc_kernel_params(
         livermore_pe_interact_kernel, "livermore_pe_interact");
-    auto params = calc_kernel_params(model.states.size());
+    auto params = calc_kernel_params(model.thread_ids.size());
     livermore_pe_interact_kernel<<<params.grid_size, params.block_size>>>(
         pe, scratch, model);
     CELER_CUDA_CHECK_ERROR();
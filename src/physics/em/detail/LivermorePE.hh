@@ -234,6 +234,10 @@ void livermore_pe_interact(const LivermorePEDeviceRef&                pe,
                            const RelaxationScratchDeviceRef&          scratch,
                            const ModelInteractRefs<MemSpace::device>& model);
 
+// Apply the Livermore photoelectric interaction on the host
+void livermore_pe_interact(const LivermorePEHostRef&                pe,
+                           const ModelInteractRefs<MemSpace::host>& model);
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
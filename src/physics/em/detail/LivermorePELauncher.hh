@@ -0,0 +1,105 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LivermorePELauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/StackAllocator.hh"
+#include "base/Types.hh"
+#include "random/RngEngine.hh"
+#include "physics/base/CutoffView.hh"
+#include "physics/base/ModelInterface.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/PhysicsTrackView.hh"
+#include "physics/material/ElementSelector.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "LivermorePE.hh"
+#include "LivermorePEInteractor.hh"
+#include "LivermorePEMicroXsCalculator.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Livermore photoelectric model to a single track.
+ *
+ * This is shared by the device kernel and the host loop. The scratch space
+ * for atomic relaxation is shared by all threads in a launch.
+ */
+template<MemSpace M>
+struct LivermorePELauncher
+{
+    //!@{
+    //! Type aliases
+    using LivermorePERef = LivermorePEData<Ownership::const_reference, M>;
+    using ScratchRef     = RelaxationScratchData<Ownership::reference, M>;
+    //!@}
+
+    CELER_FUNCTION LivermorePELauncher(const LivermorePERef&       pe,
+                                       const ModelInteractRefs<M>& model)
+        : pe(pe), model(model)
+    {
+    }
+
+    const LivermorePERef&       pe;    //!< Shared model data
+    const ModelInteractRefs<M>& model; //!< State data needed to interact
+
+    //! Create track views and launch interaction
+    inline CELER_FUNCTION void operator()(ThreadId                   tid,
+                                          StackAllocator<Secondary>& allocate,
+                                          const ScratchRef& scratch) const;
+};
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void
+LivermorePELauncher<M>::operator()(ThreadId                   tid,
+                                   StackAllocator<Secondary>& allocate,
+                                   const ScratchRef&          scratch) const
+{
+    ParticleTrackView particle(
+        model.params.particle, model.states.particle, tid);
+    MaterialTrackView material(
+        model.params.material, model.states.material, tid);
+    PhysicsTrackView physics(model.params.physics,
+                             model.states.physics,
+                             particle.particle_id(),
+                             material.material_id(),
+                             tid);
+    CutoffView       cutoffs(model.params.cutoffs, material.material_id());
+
+    // Only tracks that selected the Livermore PE model are dispatched here
+    CELER_ASSERT(physics.model_id() == pe.ids.model);
+
+    RngEngine rng(model.states.rng, tid);
+
+    // Sample an element
+    ElementSelector select_el(
+        material.material_view(),
+        LivermorePEMicroXsCalculator{pe, particle.energy()},
+        material.element_scratch());
+    ElementComponentId comp_id = select_el(rng);
+    ElementId          el_id   = material.material_view().element_id(comp_id);
+
+    LivermorePEInteractor interact(pe,
+                                   scratch,
+                                   el_id,
+                                   particle,
+                                   cutoffs,
+                                   model.states.direction[tid],
+                                   allocate);
+
+    model.states.interactions[tid] = interact(rng);
+    CELER_ENSURE(model.states.interactions[tid]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,33 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file MollerBhabha.cc
+//---------------------------------------------------------------------------//
+#include "MollerBhabha.hh"
+
+#include "base/Assert.hh"
+#include "HostInteractLoop.hh"
+#include "MollerBhabhaLauncher.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Moller-Bhabha interaction on the host.
+ */
+void moller_bhabha_interact(const MollerBhabhaPointers&              mb,
+                            const ModelInteractRefs<MemSpace::host>& model)
+{
+    CELER_EXPECT(mb);
+    CELER_EXPECT(model);
+
+    host_interact_loop(model, MollerBhabhaLauncher<MemSpace::host>(mb, model));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
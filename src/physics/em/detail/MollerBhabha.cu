@@ -9,14 +9,7 @@
 
 #include "base/Assert.hh"
 #include "base/KernelParamCalculator.cuda.hh"
-#include "random/RngEngine.hh"
-#include "physics/base/ModelInterface.hh"
-#include "physics/base/ParticleTrackView.hh"
-#include "physics/base/PhysicsTrackView.hh"
-#include "physics/material/MaterialTrackView.hh"
-#include "physics/base/CutoffView.hh"
-#include "base/StackAllocator.hh"
-#include "MollerBhabhaInteractor.hh"
+#include "MollerBhabhaLauncher.hh"
 
 namespace celeritas
 {
@@ -34,37 +27,13 @@ __global__ void
 moller_bhabha_interact_kernel(const MollerBhabhaPointers                mb,
                               const ModelInteractRefs<MemSpace::device> model)
 {
-    auto tid = celeritas::KernelParamCalculator::thread_id();
-    if (!(tid < model.states.size()))
+    auto idx = celeritas::KernelParamCalculator::thread_id();
+    if (!(idx < model.thread_ids.size()))
         return;
 
     StackAllocator<Secondary> allocate_secondaries(model.states.secondaries);
-    ParticleTrackView         particle(
-        model.params.particle, model.states.particle, tid);
-
-    MaterialTrackView material(
-        model.params.material, model.states.material, tid);
-
-    PhysicsTrackView physics(model.params.physics,
-                             model.states.physics,
-                             particle.particle_id(),
-                             material.material_id(),
-                             tid);
-
-    CutoffView cutoff(model.params.cutoffs, material.material_id());
-
-    // This interaction only applies if the MB model was selected
-    if (physics.model_id() != mb.model_id)
-    {
-        return;
-    }
-
-    MollerBhabhaInteractor interact(
-        mb, particle, cutoff, model.states.direction[tid], allocate_secondaries);
-
-    RngEngine rng(model.states.rng, tid);
-    model.states.interactions[tid] = interact(rng);
-    CELER_ENSURE(model.states.interactions[tid]);
+    MollerBhabhaLauncher<MemSpace::device> launch(mb, model);
+    launch(model.thread_ids[idx.get()], allocate_secondaries);
 }
 
 } // namespace
@@ -83,7 +52,7 @@ void moller_bhabha_interact(const MollerBhabhaPointers&                mb,
 
     static const KernelParamCalculator calc_kernel_params(
         moller_bhabha_interact_kernel, "moller_bhabha_interact");
-    auto params = calc_kernel_params(model.states.size());
+    auto params = calc_kernel_params(model.thread_ids.size());
     moller_bhabha_interact_kernel<<<params.grid_size, params.block_size>>>(
         mb, model);
     CELER_CUDA_CHECK_ERROR();
@@ -61,6 +61,11 @@ void moller_bhabha_interact(
     const MollerBhabhaPointers&                device_pointers,
     const ModelInteractRefs<MemSpace::device>& interaction);
 
+// Apply the Moller-Bhabha interaction on the host
+void moller_bhabha_interact(
+    const MollerBhabhaPointers&              pointers,
+    const ModelInteractRefs<MemSpace::host>& interaction);
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
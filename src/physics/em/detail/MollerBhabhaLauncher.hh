@@ -0,0 +1,83 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file MollerBhabhaLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/StackAllocator.hh"
+#include "base/Types.hh"
+#include "random/RngEngine.hh"
+#include "physics/base/CutoffView.hh"
+#include "physics/base/ModelInterface.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/PhysicsTrackView.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "MollerBhabha.hh"
+#include "MollerBhabhaInteractor.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Moller-Bhabha model to a single track.
+ *
+ * This is shared by the device kernel and the host loop.
+ */
+template<MemSpace M>
+struct MollerBhabhaLauncher
+{
+    CELER_FUNCTION MollerBhabhaLauncher(const MollerBhabhaPointers& mb,
+                                        const ModelInteractRefs<M>& model)
+        : mb(mb), model(model)
+    {
+    }
+
+    const MollerBhabhaPointers& mb;    //!< Shared model data
+    const ModelInteractRefs<M>& model; //!< State data needed to interact
+
+    //! Create track views and launch interaction
+    inline CELER_FUNCTION void
+    operator()(ThreadId tid, StackAllocator<Secondary>& allocate) const;
+};
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void
+MollerBhabhaLauncher<M>::operator()(ThreadId                   tid,
+                                    StackAllocator<Secondary>& allocate) const
+{
+    ParticleTrackView particle(
+        model.params.particle, model.states.particle, tid);
+
+    MaterialTrackView material(
+        model.params.material, model.states.material, tid);
+
+    PhysicsTrackView physics(model.params.physics,
+                             model.states.physics,
+                             particle.particle_id(),
+                             material.material_id(),
+                             tid);
+
+    CutoffView cutoff(model.params.cutoffs, material.material_id());
+
+    // Only tracks that selected the MB model are dispatched here
+    CELER_ASSERT(physics.model_id() == mb.model_id);
+
+    MollerBhabhaInteractor interact(
+        mb, particle, cutoff, model.states.direction[tid], allocate);
+
+    RngEngine rng(model.states.rng, tid);
+    model.states.interactions[tid] = interact(rng);
+    CELER_ENSURE(model.states.interactions[tid]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
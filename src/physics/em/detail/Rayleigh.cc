@@ -5,9 +5,13 @@
 //---------------------------------------------------------------------------//
 //! \file Rayleigh.cc
 //---------------------------------------------------------------------------//
-#include "base/Types.hh"
 #include "Rayleigh.hh"
 
+#include "base/Assert.hh"
+#include "base/Types.hh"
+#include "HostInteractLoop.hh"
+#include "RayleighLauncher.hh"
+
 namespace celeritas
 {
 namespace detail
@@ -241,6 +245,20 @@ const real_type RayleighData::angular_parameters[num_parameters][num_elements]
         // clang-format on
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Rayleigh interaction on the host.
+ */
+void rayleigh_interact(const RayleighHostRef&                   rayleigh,
+                       const ModelInteractRefs<MemSpace::host>& model)
+{
+    CELER_EXPECT(rayleigh);
+    CELER_EXPECT(model);
+
+    host_interact_loop(model,
+                       RayleighLauncher<MemSpace::host>(rayleigh, model));
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
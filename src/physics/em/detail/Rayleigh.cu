@@ -9,15 +9,7 @@
 
 #include "base/Assert.hh"
 #include "base/KernelParamCalculator.cuda.hh"
-#include "random/RngEngine.hh"
-#include "physics/base/ModelInterface.hh"
-#include "physics/base/ParticleTrackView.hh"
-#include "physics/material/Types.hh"
-#include "physics/material/MaterialTrackView.hh"
-#include "physics/material/ElementView.hh"
-#include "physics/material/ElementSelector.hh"
-#include "physics/base/PhysicsTrackView.hh"
-#include "RayleighInteractor.hh"
+#include "RayleighLauncher.hh"
 
 namespace celeritas
 {
@@ -36,39 +28,13 @@ rayleigh_interact_kernel(const RayleighDeviceRef                   rayleigh,
                          const ModelInteractRefs<MemSpace::device> model)
 {
     // Get the thread id
-    auto tid = celeritas::KernelParamCalculator::thread_id();
-    if (!(tid < model.states.size()))
+    auto idx = celeritas::KernelParamCalculator::thread_id();
+    if (!(idx < model.thread_ids.size()))
         return;
 
-    // Get views to Particle, and Physics
-    ParticleTrackView particle(
-        model.params.particle, model.states.particle, tid);
-
-    MaterialTrackView material(
-        model.params.material, model.states.material, tid);
-
-    PhysicsTrackView physics(model.params.physics,
-                             model.states.physics,
-                             particle.particle_id(),
-                             material.material_id(),
-                             tid);
-
-    // This interaction only applies if the Rayleigh model was selected
-    if (physics.model_id() != rayleigh.model_id)
-        return;
-
-    RngEngine rng(model.states.rng, tid);
-
-    // Assume only a single element in the material, for now
-    CELER_ASSERT(material.material_view().num_elements() == 1);
-    ElementId el_id{0};
-
-    // Do the interaction
-    RayleighInteractor interact(
-        rayleigh, particle, model.states.direction[tid], el_id);
-
-    model.states.interactions[tid] = interact(rng);
-    CELER_ENSURE(model.states.interactions[tid]);
+    StackAllocator<Secondary> allocate_secondaries(model.states.secondaries);
+    RayleighLauncher<MemSpace::device> launch(rayleigh, model);
+    launch(model.thread_ids[idx.get()], allocate_secondaries);
 }
 
 } // namespace
@@ -88,7 +54,7 @@ void rayleigh_interact(const RayleighDeviceRef&                   rayleigh,
     // Calculate kernel launch params
     static const KernelParamCalculator calc_kernel_params(
         rayleigh_interact_kernel, "rayleigh_interact");
-    auto params = calc_kernel_params(model.states.size());
+    auto params = calc_kernel_params(model.thread_ids.size());
 
     // Launch the kernel
     rayleigh_interact_kernel<<<params.grid_size, params.block_size>>>(rayleigh,
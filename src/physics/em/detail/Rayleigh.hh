@@ -96,10 +96,14 @@ using RayleighNativeRef
 // KERNEL LAUNCHERS
 //---------------------------------------------------------------------------//
 
-// Launch the Livermore photoelectric interaction
+// Launch the Rayleigh interaction
 void rayleigh_interact(const RayleighDeviceRef&                   pointers,
                        const ModelInteractRefs<MemSpace::device>& model);
 
+// Apply the Rayleigh interaction on the host
+void rayleigh_interact(const RayleighHostRef&                   pointers,
+                       const ModelInteractRefs<MemSpace::host>& model);
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
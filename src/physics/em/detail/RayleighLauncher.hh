@@ -0,0 +1,92 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RayleighLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/StackAllocator.hh"
+#include "base/Types.hh"
+#include "random/RngEngine.hh"
+#include "physics/base/ModelInterface.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/PhysicsTrackView.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "Rayleigh.hh"
+#include "RayleighInteractor.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Rayleigh model to a single track.
+ *
+ * This is shared by the device kernel and the host loop. Rayleigh scattering
+ * emits no secondaries, so the allocator is unused.
+ */
+template<MemSpace M>
+struct RayleighLauncher
+{
+    //!@{
+    //! Type aliases
+    using RayleighRef = RayleighGroup<Ownership::const_reference, M>;
+    //!@}
+
+    CELER_FUNCTION RayleighLauncher(const RayleighRef&          rayleigh,
+                                    const ModelInteractRefs<M>& model)
+        : rayleigh(rayleigh), model(model)
+    {
+    }
+
+    const RayleighRef&          rayleigh; //!< Shared model data
+    const ModelInteractRefs<M>& model;    //!< State data needed to interact
+
+    //! Create track views and launch interaction
+    inline CELER_FUNCTION void
+    operator()(ThreadId tid, StackAllocator<Secondary>&) const;
+};
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void
+RayleighLauncher<M>::operator()(ThreadId tid, StackAllocator<Secondary>&) const
+{
+    // Get views to Particle, and Physics
+    ParticleTrackView particle(
+        model.params.particle, model.states.particle, tid);
+
+    MaterialTrackView material(
+        model.params.material, model.states.material, tid);
+
+    PhysicsTrackView physics(model.params.physics,
+                             model.states.physics,
+                             particle.particle_id(),
+                             material.material_id(),
+                             tid);
+
+    // Only tracks that selected the Rayleigh model are dispatched here
+    CELER_ASSERT(physics.model_id() == rayleigh.model_id);
+
+    RngEngine rng(model.states.rng, tid);
+
+    // Assume only a single element in the material, for now
+    CELER_ASSERT(material.material_view().num_elements() == 1);
+    ElementId el_id{0};
+
+    // Do the interaction
+    RayleighInteractor interact(
+        rayleigh, particle, model.states.direction[tid], el_id);
+
+    model.states.interactions[tid] = interact(rng);
+    CELER_ENSURE(model.states.interactions[tid]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
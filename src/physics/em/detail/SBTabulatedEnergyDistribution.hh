@@ -0,0 +1,107 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SBTabulatedEnergyDistribution.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Span.hh"
+#include "physics/base/Units.hh"
+#include "SeltzerBerger.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample exiting photon energy from Bremsstrahlung without rejection.
+ *
+ * This samples the same distribution as SBEnergyDistribution,
+ * \f[
+ *   p(\kappa) \propto \frac{1}{\kappa} \chi_Z(E, \kappa) \,,
+ * \f]
+ * by inverting precomputed cumulative tables (see SBElementCdfData) rather
+ * than rejecting against the maximum cross section. The bilinearly
+ * interpolated DCS at incident energy \em E is a linear combination of the DCS
+ * at the two bracketing incident energy grid points, so the distribution is a
+ * mixture of the two tabulated distributions: one of them is selected with a
+ * probability given by the interpolation fraction and its integral above the
+ * cutoff \f$ \kappa_c \f$. The fraction \f$ \kappa \f$ is then sampled from
+ * the selected table with a binary search and a single linear interpolation
+ * of \f$ \ln \kappa \f$ in the cumulative value.
+ *
+ * The density correction changes the measure from \f$ \dif \ln k^2 \f$ to
+ * \f$ \dif \ln (k^2 + d_\rho E^2) \f$. It is applied exactly (for a DCS
+ * that is constant within a table interval) to the lowest interval above the
+ * cutoff, which is sampled uniformly in \f$ \ln (k^2 + d_\rho E^2) \f$ with
+ * its probability rescaled accordingly. Above that interval the correction
+ * factor \f$ k^2 / (k^2 + d_\rho E^2) \f$ is neglected, which for the
+ * refined SB grid and typical production cuts is a relative error under a
+ * percent.
+ */
+class SBTabulatedEnergyDistribution
+{
+  public:
+    //!@{
+    //! Type aliases
+    using SBData
+        = SeltzerBergerData<Ownership::const_reference, MemSpace::native>;
+    using Energy   = units::MevEnergy;
+    using EnergySq = Quantity<UnitProduct<units::Mev, units::Mev>>;
+    //!@}
+
+  public:
+    // Construct from data
+    inline CELER_FUNCTION
+    SBTabulatedEnergyDistribution(const SBData& data,
+                                  Energy        inc_energy,
+                                  ElementId     element,
+                                  EnergySq      density_correction,
+                                  Energy        min_gamma_energy);
+
+    template<class Engine>
+    inline CELER_FUNCTION Energy operator()(Engine& rng) const;
+
+  private:
+    //// IMPLEMENTATION DATA ////
+
+    // Reduced exiting energy grid and the cumulative tables at the
+    // bracketing incident energy grid points
+    Span<const real_type> log_y_;
+    Span<const real_type> lower_cdf_;
+    Span<const real_type> upper_cdf_;
+
+    // Probability of sampling from the upper table
+    real_type upper_prob_;
+
+    // Incident energy [MeV] and density correction [MeV^2]
+    real_type inc_energy_;
+    real_type dens_corr_;
+
+    // Grid interval containing the cutoff and its density-corrected bounds
+    size_type min_index_;
+    real_type log_esq_min_;
+    real_type log_esq_max_;
+
+    // Mean scaled DCS in the cutoff interval and table values at the cutoff
+    real_type lower_xs_;
+    real_type upper_xs_;
+    real_type lower_cdf_min_;
+    real_type upper_cdf_min_;
+
+    //// HELPER FUNCTIONS ////
+
+    inline CELER_FUNCTION real_type sample(Span<const real_type> cdf,
+                                           real_type             xs,
+                                           real_type             cdf_min,
+                                           real_type             xi) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
+
+#include "SBTabulatedEnergyDistribution.i.hh"
@@ -0,0 +1,156 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SBTabulatedEnergyDistribution.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+#include "physics/grid/NonuniformGrid.hh"
+#include "physics/grid/detail/FindInterp.hh"
+#include "random/distributions/BernoulliDistribution.hh"
+#include "random/distributions/GenerateCanonical.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from incident particle and energy.
+ *
+ * The element *must* have cumulative tables, and as with SBEnergyDistribution
+ * the incident energy must be within the bounds of the SB table data.
+ */
+CELER_FUNCTION
+SBTabulatedEnergyDistribution::SBTabulatedEnergyDistribution(
+    const SBData& data,
+    Energy        inc_energy,
+    ElementId     element,
+    EnergySq      density_correction,
+    Energy        min_gamma_energy)
+    : inc_energy_(inc_energy.value()), dens_corr_(density_correction.value())
+{
+    CELER_EXPECT(element < data.differential_xs.elements.size());
+    CELER_EXPECT(min_gamma_energy > zero_quantity());
+    CELER_EXPECT(inc_energy > min_gamma_energy);
+
+    const auto&               tables = data.differential_xs;
+    const SBElementTableData& el     = tables.elements[element];
+    CELER_EXPECT(el.cdf);
+
+    // Find the incident energy grid points bracketing the incident energy
+    const auto x_loc = find_interp(
+        NonuniformGrid<real_type>(el.grid.x, tables.reals),
+        std::log(inc_energy_));
+
+    // Get the cumulative tables at the bracketing grid points
+    log_y_                    = tables.reals[el.cdf.log_y];
+    Span<const real_type> cdf = tables.reals[el.cdf.values];
+    lower_cdf_ = cdf.subspan(x_loc.index * log_y_.size(), log_y_.size());
+    upper_cdf_ = cdf.subspan((x_loc.index + 1) * log_y_.size(), log_y_.size());
+
+    // Find the grid interval containing the cutoff
+    const real_type min_energy = celeritas::max(
+        min_gamma_energy.value(), inc_energy_ * std::exp(log_y_.front()));
+    min_index_ = NonuniformGrid<real_type>(el.cdf.log_y, tables.reals)
+                     .find(std::log(min_energy / inc_energy_));
+    CELER_ASSERT(min_index_ + 1 < log_y_.size());
+
+    // Calculate the density-corrected bounds of the truncated interval
+    const real_type max_energy = inc_energy_
+                                 * std::exp(log_y_[min_index_ + 1]);
+    log_esq_min_ = std::log(ipow<2>(min_energy) + dens_corr_);
+    log_esq_max_ = std::log(ipow<2>(max_energy) + dens_corr_);
+
+    // Calculate the mean scaled DCS in the truncated interval and the
+    // corresponding table value at the cutoff
+    const real_type delta_log_y = log_y_[min_index_ + 1] - log_y_[min_index_];
+    const real_type half_delta_log_esq = (log_esq_max_ - log_esq_min_) / 2;
+    auto calc_xs = [this, delta_log_y](Span<const real_type> values) {
+        return (values[min_index_ + 1] - values[min_index_]) / delta_log_y;
+    };
+    lower_xs_      = calc_xs(lower_cdf_);
+    upper_xs_      = calc_xs(upper_cdf_);
+    lower_cdf_min_ = lower_cdf_[min_index_ + 1]
+                     - lower_xs_ * half_delta_log_esq;
+    upper_cdf_min_ = upper_cdf_[min_index_ + 1]
+                     - upper_xs_ * half_delta_log_esq;
+
+    // Weight each table by its interpolation fraction and its integral above
+    // the cutoff
+    real_type lower_weight = (1 - x_loc.fraction)
+                             * (lower_cdf_.back() - lower_cdf_min_);
+    real_type upper_weight = x_loc.fraction
+                             * (upper_cdf_.back() - upper_cdf_min_);
+    CELER_ASSERT(lower_weight + upper_weight > 0);
+    upper_prob_ = upper_weight / (lower_weight + upper_weight);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the exiting energy by table lookup and interpolation.
+ */
+template<class Engine>
+CELER_FUNCTION auto
+SBTabulatedEnergyDistribution::operator()(Engine& rng) const -> Energy
+{
+    // Select the table at the lower or upper incident energy grid point
+    if (BernoulliDistribution(upper_prob_)(rng))
+    {
+        return Energy{this->sample(
+            upper_cdf_, upper_xs_, upper_cdf_min_, generate_canonical(rng))};
+    }
+    return Energy{this->sample(
+        lower_cdf_, lower_xs_, lower_cdf_min_, generate_canonical(rng))};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Invert a cumulative table above the cutoff.
+ *
+ * The probability density is taken to be constant in the log of the
+ * density-corrected squared energy inside the truncated cutoff interval, and
+ * constant in \f$ \ln \kappa \f$ inside each interval above it.
+ */
+CELER_FUNCTION real_type
+SBTabulatedEnergyDistribution::sample(Span<const real_type> cdf,
+                                      real_type             xs,
+                                      real_type             cdf_min,
+                                      real_type             xi) const
+{
+    const real_type target = cdf_min + xi * (cdf.back() - cdf_min);
+
+    if (target < cdf[min_index_ + 1])
+    {
+        // Sample inside the truncated interval containing the cutoff
+        CELER_ASSERT(xs > 0);
+        real_type esq = std::exp(log_esq_min_ + 2 * (target - cdf_min) / xs)
+                        - dens_corr_;
+        CELER_ASSERT(esq > 0);
+        return std::sqrt(esq);
+    }
+
+    // Find the upper point of the grid interval containing the target
+    size_type upper = celeritas::lower_bound(
+                          cdf.begin() + min_index_ + 2, cdf.end(), target)
+                      - cdf.begin();
+    upper = celeritas::min(upper, static_cast<size_type>(cdf.size() - 1));
+
+    // Interpolate the log of the reduced exiting energy
+    const real_type delta_cdf = cdf[upper] - cdf[upper - 1];
+    real_type       log_kappa = log_y_[upper - 1];
+    if (delta_cdf > 0)
+    {
+        log_kappa += (target - cdf[upper - 1]) / delta_cdf
+                     * (log_y_[upper] - log_y_[upper - 1]);
+    }
+    return inc_energy_ * std::exp(log_kappa);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
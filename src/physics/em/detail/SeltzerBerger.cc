@@ -0,0 +1,34 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SeltzerBerger.cc
+//---------------------------------------------------------------------------//
+#include "SeltzerBerger.hh"
+
+#include "base/Assert.hh"
+#include "HostInteractLoop.hh"
+#include "SeltzerBergerLauncher.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Seltzer-Berger interaction on the host.
+ */
+void seltzer_berger_interact(const SeltzerBergerHostRef&              sb,
+                             const ModelInteractRefs<MemSpace::host>& model)
+{
+    CELER_EXPECT(sb);
+    CELER_EXPECT(model);
+
+    host_interact_loop(model,
+                       SeltzerBergerLauncher<MemSpace::host>(sb, model));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
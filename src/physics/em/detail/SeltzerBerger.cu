@@ -9,13 +9,7 @@
 
 #include "base/Assert.hh"
 #include "base/KernelParamCalculator.cuda.hh"
-#include "random/RngEngine.hh"
-#include "physics/base/ModelInterface.hh"
-#include "physics/base/ParticleTrackView.hh"
-#include "physics/base/PhysicsTrackView.hh"
-#include "base/StackAllocator.hh"
-#include "physics/material/MaterialTrackView.hh"
-#include "SeltzerBergerInteractor.hh"
+#include "SeltzerBergerLauncher.hh"
 
 namespace celeritas
 {
@@ -33,49 +27,15 @@ __global__ void seltzer_berger_interact_kernel(
     const SeltzerBergerDeviceRef&              device_pointers,
     const ModelInteractRefs<MemSpace::device>& interaction)
 {
-    auto tid = celeritas::KernelParamCalculator::thread_id();
-    if (!(tid < interaction.states.size()))
+    auto idx = celeritas::KernelParamCalculator::thread_id();
+    if (!(idx < interaction.thread_ids.size()))
         return;
 
     StackAllocator<Secondary> allocate_secondaries(
         interaction.states.secondaries);
-    ParticleTrackView particle(
-        interaction.params.particle, interaction.states.particle, tid);
-
-    // Setup for ElementView access
-    MaterialTrackView material(
-        interaction.params.material, interaction.states.material, tid);
-
-    PhysicsTrackView physics(interaction.params.physics,
-                             interaction.states.physics,
-                             particle.particle_id(),
-                             material.material_id(),
-                             tid);
-
-    // This interaction only applies if the Seltzer-Berger model was selected
-    if (physics.model_id() != device_pointers.ids.model)
-        return;
-
-    CutoffView cutoffs(interaction.params.cutoffs, material.material_id());
-
-    // Cache the associated MaterialView as function calls to MaterialTrackView
-    // are expensive
-    MaterialView    material_view = material.material_view();
-    const ElementId element_id{0};
-
-    // Assume only a single element in the material, for now
-    CELER_ASSERT(material_view.num_elements() == 1);
-    SeltzerBergerInteractor interact(device_pointers,
-                                     particle,
-                                     interaction.states.direction[tid],
-                                     cutoffs,
-                                     allocate_secondaries,
-                                     material_view,
-                                     element_id);
-
-    RngEngine rng(interaction.states.rng, tid);
-    interaction.states.interactions[tid] = interact(rng);
-    CELER_ENSURE(interaction.states.interactions[tid]);
+    SeltzerBergerLauncher<MemSpace::device> launch(device_pointers,
+                                                   interaction);
+    launch(interaction.thread_ids[idx.get()], allocate_secondaries);
 }
 
 } // namespace
@@ -95,7 +55,7 @@ void seltzer_berger_interact(
 
     static const KernelParamCalculator calc_kernel_params(
         seltzer_berger_interact_kernel, "seltzer_berger_interact");
-    auto params = calc_kernel_params(interaction.states.size());
+    auto params = calc_kernel_params(interaction.thread_ids.size());
     seltzer_berger_interact_kernel<<<params.grid_size, params.block_size>>>(
         device_pointers, interaction);
     CELER_CUDA_CHECK_ERROR();
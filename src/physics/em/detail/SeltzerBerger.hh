@@ -21,6 +21,29 @@ struct ModelInteractRefs;
 
 namespace detail
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Cumulative scaled DCS for sampling the exiting energy without rejection.
+ *
+ * The \c log_y grid is the logarithm of the element's reduced exiting energy
+ * grid, with each interval uniformly subdivided in \f$ \kappa \f$. For each
+ * incident energy grid point, \c values is the integral of
+ * \f$ \chi(\kappa) / \kappa \f$ from the lowest grid point, which is exact
+ * for the linearly interpolated DCS.
+ */
+struct SBElementCdfData
+{
+    ItemRange<real_type> log_y;  //!< Log of reduced exiting energy grid
+    ItemRange<real_type> values; //!< [x][log_y] cumulative scaled DCS
+
+    //! Whether the tables are assigned
+    explicit inline CELER_FUNCTION operator bool() const
+    {
+        return log_y.size() >= 2 && !values.empty()
+               && values.size() % log_y.size() == 0;
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Seltzer-Berger differential cross section tables for a single element.
@@ -30,7 +53,8 @@ namespace detail
  * magnitude isn't important since we always take ratios.
  *
  * \c argmax is the y index of the largest cross section at a given incident
- * energy point.
+ * energy point. The optional \c cdf tables are used to sample the exiting
+ * energy by inversion rather than rejection.
  *
  * \todo We could use way smaller integers for argmax, even i/j here, because
  * these tables are so small.
@@ -42,6 +66,7 @@ struct SBElementTableData
 
     TwodGridData         grid;   //!< Cross section grid and data
     ItemRange<size_type> argmax; //!< Y index of the largest XS for each energy
+    SBElementCdfData     cdf;    //!< Optional cumulative tables for sampling
 
     explicit inline CELER_FUNCTION operator bool() const
     {
@@ -166,9 +191,14 @@ using SeltzerBergerNativeRef
 
 // Launch the Seltzer-Berger interaction
 void seltzer_berger_interact(
-    const SeltzerBergerNativeRef&              shared,
+    const SeltzerBergerDeviceRef&              shared,
     const ModelInteractRefs<MemSpace::device>& interaction);
 
+// Apply the Seltzer-Berger interaction on the host
+void seltzer_berger_interact(
+    const SeltzerBergerHostRef&              shared,
+    const ModelInteractRefs<MemSpace::host>& interaction);
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
@@ -19,6 +19,7 @@
 #include "physics/material/MaterialView.hh"
 #include "SeltzerBerger.hh"
 #include "SBEnergyDistribution.hh"
+#include "SBTabulatedEnergyDistribution.hh"
 #include "SBPositronXsCorrector.hh"
 
 namespace celeritas
@@ -35,8 +36,10 @@ namespace detail
  * using cross sections based on interpolation of published tables from Seltzer
  * and Berger given in Nucl. Instr. and Meth. in Phys. Research B, 12(1):95–134
  * (1985) and Atomic Data and Nuclear Data Tables, 35():345 (1986). The cross
- * sections are obtained from SBEnergyDistribution and are appropriately scaled
- * in the case of positrons via SBPositronXsCorrector (to be done).
+ * sections are obtained from SBEnergyDistribution (or
+ * SBTabulatedEnergyDistribution if the model was built with cumulative
+ * tables) and are appropriately scaled in the case of positrons via
+ * SBPositronXsCorrector (to be done).
  *
  * \note This interactor performs an analogous sampling as in Geant4's
  * G4SeltzerBergerModel, documented in 10.2.1 of the Geant Physics Reference
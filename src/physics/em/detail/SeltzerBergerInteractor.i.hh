@@ -77,14 +77,29 @@ CELER_FUNCTION Interaction SeltzerBergerInteractor::operator()(Engine& rng)
                                  + shared_.electron_mass.value();
     real_type density_correction = density_factor * ipow<2>(total_energy_val);
 
-    // Outgoing photon secondary energy sampler
-    SBEnergyDistribution sample_gamma_energy(
-        shared_,
-        inc_energy_,
-        element_id_,
-        EnergySq{density_correction},
-        cutoffs_.energy(shared_.ids.gamma));
-    Energy gamma_exit_energy = sample_gamma_energy(rng);
+    // Sample the outgoing photon energy, without rejection if the element
+    // has cumulative tables
+    Energy gamma_exit_energy;
+    if (shared_.differential_xs.elements[element_id_].cdf)
+    {
+        SBTabulatedEnergyDistribution sample_gamma_energy(
+            shared_,
+            inc_energy_,
+            element_id_,
+            EnergySq{density_correction},
+            cutoffs_.energy(shared_.ids.gamma));
+        gamma_exit_energy = sample_gamma_energy(rng);
+    }
+    else
+    {
+        SBEnergyDistribution sample_gamma_energy(
+            shared_,
+            inc_energy_,
+            element_id_,
+            EnergySq{density_correction},
+            cutoffs_.energy(shared_.ids.gamma));
+        gamma_exit_energy = sample_gamma_energy(rng);
+    }
 
     // Cross-section scaling for positrons
     if (particle_id_ == shared_.ids.positron)
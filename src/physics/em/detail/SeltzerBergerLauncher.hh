@@ -0,0 +1,101 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SeltzerBergerLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/StackAllocator.hh"
+#include "base/Types.hh"
+#include "random/RngEngine.hh"
+#include "physics/base/CutoffView.hh"
+#include "physics/base/ModelInterface.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/PhysicsTrackView.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "SeltzerBerger.hh"
+#include "SeltzerBergerInteractor.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Apply the Seltzer-Berger model to a single track.
+ *
+ * This is shared by the device kernel and the host loop.
+ */
+template<MemSpace M>
+struct SeltzerBergerLauncher
+{
+    //!@{
+    //! Type aliases
+    using SeltzerBergerRef = SeltzerBergerData<Ownership::const_reference, M>;
+    //!@}
+
+    CELER_FUNCTION SeltzerBergerLauncher(const SeltzerBergerRef&     sb,
+                                         const ModelInteractRefs<M>& model)
+        : sb(sb), model(model)
+    {
+    }
+
+    const SeltzerBergerRef&     sb;    //!< Shared model data
+    const ModelInteractRefs<M>& model; //!< State data needed to interact
+
+    //! Create track views and launch interaction
+    inline CELER_FUNCTION void
+    operator()(ThreadId tid, StackAllocator<Secondary>& allocate) const;
+};
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void
+SeltzerBergerLauncher<M>::operator()(ThreadId                   tid,
+                                     StackAllocator<Secondary>& allocate) const
+{
+    ParticleTrackView particle(
+        model.params.particle, model.states.particle, tid);
+
+    // Setup for ElementView access
+    MaterialTrackView material(
+        model.params.material, model.states.material, tid);
+
+    PhysicsTrackView physics(model.params.physics,
+                             model.states.physics,
+                             particle.particle_id(),
+                             material.material_id(),
+                             tid);
+
+    // Only tracks that selected the Seltzer-Berger model are dispatched here
+    CELER_ASSERT(physics.model_id() == sb.ids.model);
+
+    CutoffView cutoffs(model.params.cutoffs, material.material_id());
+
+    // Cache the associated MaterialView as function calls to MaterialTrackView
+    // are expensive
+    MaterialView    material_view = material.material_view();
+    const ElementId element_id{0};
+
+    // Assume only a single element in the material, for now
+    CELER_ASSERT(material_view.num_elements() == 1);
+    SeltzerBergerInteractor interact(sb,
+                                     particle,
+                                     model.states.direction[tid],
+                                     cutoffs,
+                                     allocate,
+                                     material_view,
+                                     element_id);
+
+    RngEngine rng(model.states.rng, tid);
+    model.states.interactions[tid] = interact(rng);
+    CELER_ENSURE(model.states.interactions[tid]);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
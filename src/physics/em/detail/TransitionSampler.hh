@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TransitionSampler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/OpaqueId.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "physics/em/AtomicRelaxationInterface.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample an atomic transition for a subshell vacancy in constant time.
+ *
+ * This uses the subshell's precomputed Walker alias table. A single uniform
+ * sample selects both the bin and the point within it. If the "remainder"
+ * outcome is selected, no transition occurs and a null ID is returned.
+ *
+ * \code
+    TransitionSampler sample_transition(shell);
+    TransitionId trans_id = sample_transition(rng);
+   \endcode
+ */
+class TransitionSampler
+{
+  public:
+    //!@{
+    //! Type aliases
+    using TransitionId = OpaqueId<AtomicRelaxTransition>;
+    using result_type  = TransitionId;
+    //!@}
+
+  public:
+    // Construct with subshell transition data
+    explicit inline CELER_FUNCTION
+    TransitionSampler(const AtomicRelaxSubshell& shell);
+
+    // Sample a transition, or none
+    template<class Engine>
+    inline CELER_FUNCTION result_type operator()(Engine& rng) const;
+
+  private:
+    Span<const AtomicRelaxAliasBin> table_;
+    size_type                       num_transitions_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
+
+#include "TransitionSampler.i.hh"
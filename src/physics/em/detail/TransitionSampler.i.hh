@@ -0,0 +1,55 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TransitionSampler.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+#include "random/distributions/GenerateCanonical.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with subshell transition data.
+ */
+CELER_FUNCTION
+TransitionSampler::TransitionSampler(const AtomicRelaxSubshell& shell)
+    : table_(shell.alias_table), num_transitions_(shell.transitions.size())
+{
+    CELER_EXPECT(table_.size() == num_transitions_ + 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a transition, or none.
+ */
+template<class Engine>
+CELER_FUNCTION auto TransitionSampler::operator()(Engine& rng) const
+    -> result_type
+{
+    // Scale a uniform sample so that its integer part selects the bin and its
+    // fractional part is compared against the bin's threshold
+    real_type u   = generate_canonical(rng) * table_.size();
+    size_type bin = celeritas::min(static_cast<size_type>(u),
+                                   static_cast<size_type>(table_.size() - 1));
+    u -= bin;
+
+    const AtomicRelaxAliasBin& entry  = table_[bin];
+    size_type                  result = (u < entry.threshold ? bin
+                                                             : entry.alias);
+    if (result < num_transitions_)
+        return TransitionId{result};
+
+    // The remainder was sampled: skip to the next vacancy
+    return {};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
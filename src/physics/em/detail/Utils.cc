@@ -8,6 +8,7 @@
 #include "Utils.hh"
 
 #include <cmath>
+#include <vector>
 #include "base/Algorithms.hh"
 #include "base/Range.hh"
 
@@ -27,6 +28,69 @@ size_type calc_max_secondaries(const AtomicRelaxElement& el,
     return MaxSecondariesCalculator(el, electron_cut, gamma_cut)();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a Walker alias table for sampling a subshell transition.
+ *
+ * The table has one bin per transition plus a final bin for the remaining
+ * probability that no transition is sampled. This uses Vose's algorithm: bins
+ * whose scaled probability is below the mean are filled from the excess of a
+ * bin above the mean, so that the resulting table reproduces the transition
+ * probabilities exactly (up to round-off).
+ */
+void fill_alias_table(Span<const AtomicRelaxTransition> transitions,
+                      Span<AtomicRelaxAliasBin>         table)
+{
+    CELER_EXPECT(table.size() == transitions.size() + 1);
+
+    // Probability of each outcome, where the last is "no transition"
+    std::vector<real_type> scaled(table.size());
+    real_type              total = 0;
+    for (auto i : range(transitions.size()))
+    {
+        CELER_ASSERT(transitions[i].probability >= 0);
+        scaled[i] = transitions[i].probability;
+        total += scaled[i];
+    }
+    scaled.back() = max<real_type>(1 - total, 0);
+    total         = max<real_type>(total, 1);
+
+    // Scale so that the mean bin probability is unity and partition the bins
+    std::vector<size_type> small;
+    std::vector<size_type> large;
+    for (auto i : range(table.size()))
+    {
+        scaled[i] *= table.size() / total;
+        (scaled[i] < 1 ? small : large).push_back(i);
+    }
+
+    // Fill each underfull bin with the excess of an overfull one
+    while (!small.empty() && !large.empty())
+    {
+        size_type lo = small.back();
+        size_type hi = large.back();
+        small.pop_back();
+
+        table[lo].threshold = scaled[lo];
+        table[lo].alias     = hi;
+
+        scaled[hi] = (scaled[hi] + scaled[lo]) - 1;
+        if (scaled[hi] < 1)
+        {
+            large.pop_back();
+            small.push_back(hi);
+        }
+    }
+
+    // Remaining bins are full up to round-off
+    small.insert(small.end(), large.begin(), large.end());
+    for (size_type i : small)
+    {
+        table[i].threshold = 1;
+        table[i].alias     = i;
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct with EADL transition data and production thresholds.
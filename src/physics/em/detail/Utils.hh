@@ -22,6 +22,10 @@ size_type calc_max_secondaries(const AtomicRelaxElement& el,
                                units::MevEnergy          electron_cut,
                                units::MevEnergy          gamma_cut);
 
+// Construct a Walker alias table for sampling a subshell transition
+void fill_alias_table(Span<const AtomicRelaxTransition> transitions,
+                      Span<AtomicRelaxAliasBin>         table);
+
 //---------------------------------------------------------------------------//
 /*!
  * Helper class for calculating the maximum possible number of secondaries
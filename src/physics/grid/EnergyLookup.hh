@@ -0,0 +1,87 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EnergyLookup.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Quantity.hh"
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "UniformGridInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Location of an energy on a grid that is uniform in log(E).
+ *
+ * If the energy is outside the grid, the index is that of the nearest grid
+ * point and the fraction is zero.
+ */
+struct EnergyGridLocation
+{
+    size_type index{};        //!< Lower grid point (or nearest if outside)
+    real_type fraction{};     //!< Fraction of the energy interval [0, 1)
+    real_type upper_energy{}; //!< Energy of the upper grid point
+    bool      in_bounds{};    //!< Whether the energy is inside the grid
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reusable energy lookup for a track's cross section and range calculations.
+ *
+ * This calculates log(E) once at construction, and it memoizes the location
+ * of the energy on the most recently used log-energy grid. Since the tables
+ * for a particle almost always share the same energy grid, this avoids
+ * recalculating the logarithm, the bin, and the exponentials of the bin edges
+ * for every process.
+ *
+ * \code
+    EnergyLookup lookup(particle.energy());
+    for (auto ppid : range(ParticleProcessId{physics.num_particle_processes()}))
+    {
+        auto calc_xs = physics.make_calculator<XsCalculator>(grid_id);
+        total_xs += calc_xs(lookup);
+    }
+   \endcode
+ */
+class EnergyLookup
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Energy = Quantity<units::Mev>;
+    //!@}
+
+  public:
+    // Construct from the energy to look up
+    explicit inline CELER_FUNCTION EnergyLookup(Energy energy);
+
+    //! Energy being looked up
+    CELER_FORCEINLINE_FUNCTION Energy energy() const { return energy_; }
+
+    //! Natural log of the energy value
+    CELER_FORCEINLINE_FUNCTION real_type log_energy() const
+    {
+        return log_energy_;
+    }
+
+    // Locate the energy on a uniform log-energy grid
+    inline CELER_FUNCTION const EnergyGridLocation&
+    locate(const UniformGridData& grid);
+
+  private:
+    Energy             energy_;
+    real_type          log_energy_;
+    UniformGridData    grid_;
+    EnergyGridLocation location_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "EnergyLookup.i.hh"
@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EnergyLookup.i.hh
+//---------------------------------------------------------------------------//
+#include <cmath>
+#include "base/Assert.hh"
+#include "UniformGrid.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the energy to look up.
+ */
+CELER_FUNCTION EnergyLookup::EnergyLookup(Energy energy)
+    : energy_(energy), log_energy_(std::log(energy.value()))
+{
+    CELER_EXPECT(energy_ >= zero_quantity());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Locate the energy on a uniform log-energy grid.
+ *
+ * The result is reused if the grid has the same layout as the previous call.
+ */
+CELER_FUNCTION auto EnergyLookup::locate(const UniformGridData& grid)
+    -> const EnergyGridLocation&
+{
+    CELER_EXPECT(grid);
+    if (grid.size == grid_.size && grid.front == grid_.front
+        && grid.back == grid_.back)
+    {
+        return location_;
+    }
+
+    const UniformGrid loge_grid(grid);
+    grid_     = grid;
+    location_ = {};
+    if (log_energy_ <= loge_grid.front())
+    {
+        location_.index = 0;
+    }
+    else if (log_energy_ >= loge_grid.back())
+    {
+        location_.index = loge_grid.size() - 1;
+    }
+    else
+    {
+        // Locate the energy bin and the fraction of the way across it
+        location_.index = loge_grid.find(log_energy_);
+        CELER_ASSERT(location_.index + 1 < loge_grid.size());
+
+        real_type lower_energy = std::exp(loge_grid[location_.index]);
+        location_.upper_energy = std::exp(loge_grid[location_.index + 1]);
+        location_.fraction     = (energy_.value() - lower_energy)
+                             / (location_.upper_energy - lower_energy);
+        location_.in_bounds = true;
+    }
+    return location_;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -9,6 +9,7 @@
 
 #include "base/Collection.hh"
 #include "base/Quantity.hh"
+#include "EnergyLookup.hh"
 #include "XsGridInterface.hh"
 
 namespace celeritas
@@ -45,6 +46,9 @@ class RangeCalculator
     // Find and interpolate from the energy
     inline CELER_FUNCTION real_type operator()(Energy energy) const;
 
+    // Find and interpolate using a precalculated energy lookup
+    inline CELER_FUNCTION real_type operator()(EnergyLookup& lookup) const;
+
   private:
     const XsGridData& data_;
     const Values&     reals_;
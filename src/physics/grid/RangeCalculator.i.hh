@@ -6,8 +6,6 @@
 //! \file RangeCalculator.i.hh
 //---------------------------------------------------------------------------//
 #include <cmath>
-#include "Interpolator.hh"
-#include "physics/grid/UniformGrid.hh"
 
 namespace celeritas
 {
@@ -31,31 +29,32 @@ RangeCalculator::RangeCalculator(const XsGridData& grid, const Values& values)
  */
 CELER_FUNCTION real_type RangeCalculator::operator()(Energy energy) const
 {
-    UniformGrid     loge_grid(data_.log_energy);
-    const real_type loge = std::log(energy.value());
+    EnergyLookup lookup(energy);
+    return (*this)(lookup);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the range using a precalculated energy lookup.
+ */
+CELER_FUNCTION real_type RangeCalculator::operator()(EnergyLookup& lookup) const
+{
+    const EnergyGridLocation& loc = lookup.locate(data_.log_energy);
 
-    if (loge <= loge_grid.front())
+    real_type result = this->get(loc.index);
+    if (loc.in_bounds)
     {
-        real_type result = this->get(0);
-        // Scale by sqrt(E/Emin) = exp(.5 (log E - log Emin))
-        result *= std::exp(real_type(.5) * (loge - loge_grid.front()));
-        return result;
+        // Interpolate *linearly* on energy
+        result += loc.fraction * (this->get(loc.index + 1) - result);
     }
-    else if (loge >= loge_grid.back())
+    else if (loc.index == 0)
     {
-        // Clip to highest range value
-        return this->get(loge_grid.size() - 1);
+        // Scale by sqrt(E/Emin) = exp(.5 (log E - log Emin))
+        result *= std::exp(real_type(.5)
+                           * (lookup.log_energy() - data_.log_energy.front));
     }
-
-    // Locate the energy bin
-    auto idx = loge_grid.find(loge);
-    CELER_ASSERT(idx + 1 < loge_grid.size());
-
-    // Interpolate *linearly* on energy
-    LinearInterpolator<real_type> interpolate_xs(
-        {std::exp(loge_grid[idx]), this->get(idx)},
-        {std::exp(loge_grid[idx + 1]), this->get(idx + 1)});
-    return interpolate_xs(energy.value());
+    // Otherwise, clip to highest range value
+    return result;
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,173 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file XsBatchCalculator.cc
+//---------------------------------------------------------------------------//
+#include "XsBatchCalculator.hh"
+
+#include <cmath>
+#include "celeritas_config.h"
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Number of energies processed together
+constexpr size_type chunk_size = 64;
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from grids and their values.
+ */
+XsBatchCalculator::XsBatchCalculator(const Grids& grids, const Values& values)
+    : grids_(grids), reals_(values)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate cross sections, all on the same grid.
+ */
+void XsBatchCalculator::operator()(GridId        grid,
+                                   SpanConstReal energies,
+                                   SpanReal      xs) const
+{
+    CELER_EXPECT(grid < grids_.size());
+    const XsGridData& data = grids_[grid];
+    CELER_EXPECT(data);
+
+    this->calc([&data](size_type) -> const XsGridData& { return data; },
+               energies,
+               xs);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate cross sections, each on its own grid.
+ */
+void XsBatchCalculator::operator()(SpanConstGridId grids,
+                                   SpanConstReal   energies,
+                                   SpanReal        xs) const
+{
+    CELER_EXPECT(grids.size() == energies.size());
+
+    this->calc(
+        [this, grids](size_type i) -> const XsGridData& {
+            CELER_EXPECT(grids[i] < grids_.size());
+            return grids_[grids[i]];
+        },
+        energies,
+        xs);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate cross sections in chunks.
+ *
+ * The arithmetic is the same as \c XsCalculator with \c EnergyLookup:
+ * out-of-bounds energies snap to the nearest grid point, interpolation is
+ * linear in energy, and values at or above the prime index are divided by the
+ * energy.
+ */
+template<class F>
+void XsBatchCalculator::calc(F             get_grid,
+                             SpanConstReal energies,
+                             SpanReal      xs) const
+{
+    CELER_EXPECT(energies.size() == xs.size());
+
+    const real_type* reals = reals_[AllItems<real_type>{}].data();
+
+    for (size_type start = 0; start < energies.size(); start += chunk_size)
+    {
+        const size_type  count  = min(chunk_size, energies.size() - start);
+        const real_type* energy = energies.data() + start;
+        real_type*       result = xs.data() + start;
+
+        // Gather grid parameters into lanes
+        real_type front[chunk_size];
+        real_type delta[chunk_size];
+        real_type back[chunk_size];
+        size_type last[chunk_size];
+        size_type prime[chunk_size];
+        size_type offset[chunk_size];
+        for (size_type i = 0; i < count; ++i)
+        {
+            const XsGridData& grid = get_grid(start + i);
+            CELER_ASSERT(grid);
+            front[i]  = grid.log_energy.front;
+            delta[i]  = grid.log_energy.delta;
+            back[i]   = grid.log_energy.back;
+            last[i]   = grid.log_energy.size - 1;
+            prime[i]  = grid.prime_index;
+            offset[i] = grid.value.begin()->get();
+        }
+
+        // Locate the energies on their grids
+        real_type loge[chunk_size];
+        for (size_type i = 0; i < count; ++i)
+        {
+            loge[i] = std::log(energy[i]);
+        }
+
+        size_type index[chunk_size];
+        bool      in_bounds[chunk_size];
+        real_type lower_energy[chunk_size];
+        real_type upper_energy[chunk_size];
+#if CELERITAS_USE_OPENMP
+#    pragma omp simd
+#endif
+        for (size_type i = 0; i < count; ++i)
+        {
+            bool      below = loge[i] <= front[i];
+            bool      above = loge[i] >= back[i];
+            real_type bin   = (loge[i] - front[i]) / delta[i];
+            bin = below ? real_type(0) : above ? real_type(last[i]) : bin;
+
+            index[i]        = static_cast<size_type>(bin);
+            in_bounds[i]    = !(below || above);
+            lower_energy[i] = front[i] + delta[i] * index[i];
+            upper_energy[i] = front[i] + delta[i] * (index[i] + 1);
+        }
+
+        for (size_type i = 0; i < count; ++i)
+        {
+            lower_energy[i] = std::exp(lower_energy[i]);
+            upper_energy[i] = std::exp(upper_energy[i]);
+        }
+
+        // Interpolate and apply the 1/E scaling
+#if CELERITAS_USE_OPENMP
+#    pragma omp simd
+#endif
+        for (size_type i = 0; i < count; ++i)
+        {
+            size_type upper = in_bounds[i] ? index[i] + 1 : index[i];
+            real_type lo_xs = reals[offset[i] + index[i]];
+            real_type hi_xs = reals[offset[i] + upper];
+
+            // Upper point was already scaled by E: undo the scaling
+            real_type hi_scale = (in_bounds[i] && upper == prime[i])
+                                     ? upper_energy[i]
+                                     : real_type(1);
+            real_type frac
+                = in_bounds[i] ? (energy[i] - lower_energy[i])
+                                     / (upper_energy[i] - lower_energy[i])
+                               : real_type(0);
+
+            real_type r = lo_xs + frac * (hi_xs / hi_scale - lo_xs);
+            result[i]   = index[i] >= prime[i] ? r / energy[i] : r;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,75 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file XsBatchCalculator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Collection.hh"
+#include "base/Span.hh"
+#include "XsGridInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Evaluate cross sections for many energies at once on host.
+ *
+ * This gives the same result as calling \c XsCalculator for each energy but
+ * restructures the work into short fixed-size chunks: the grid parameters
+ * are gathered into contiguous lanes, then the logarithm, the bin search,
+ * the exponentials of the bin edges, and the interpolation (with the
+ * \c prime_index scaling applied as a blend rather than a branch) are each
+ * performed as a separate loop. The search and interpolation loops are pure
+ * arithmetic and are marked \c simd when OpenMP is enabled; the \c log and
+ * \c exp loops are scalar library calls, since vector math routines are
+ * only substituted by the compiler under fast-math options that would change
+ * the result relative to \c XsCalculator .
+ *
+ * Each energy can be evaluated on a different grid (e.g. for tracks in
+ * different materials) or all on the same grid.
+ *
+ * \code
+    XsBatchCalculator calc_xs(physics.value_grids, physics.reals);
+    calc_xs(grid_ids, energies, xs);
+   \endcode
+ */
+class XsBatchCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using GridId = ItemId<XsGridData>;
+    using Grids
+        = Collection<XsGridData, Ownership::const_reference, MemSpace::host>;
+    using Values
+        = Collection<real_type, Ownership::const_reference, MemSpace::host>;
+    using SpanConstGridId = Span<const GridId>;
+    using SpanConstReal   = Span<const real_type>;
+    using SpanReal        = Span<real_type>;
+    //!@}
+
+  public:
+    // Construct from grids and their values
+    XsBatchCalculator(const Grids& grids, const Values& values);
+
+    // Calculate cross sections, all on the same grid
+    void operator()(GridId grid, SpanConstReal energies, SpanReal xs) const;
+
+    // Calculate cross sections, each on its own grid
+    void operator()(SpanConstGridId grids,
+                    SpanConstReal   energies,
+                    SpanReal        xs) const;
+
+  private:
+    const Grids&  grids_;
+    const Values& reals_;
+
+    template<class F>
+    void calc(F get_grid, SpanConstReal energies, SpanReal xs) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "base/Quantity.hh"
+#include "EnergyLookup.hh"
 #include "XsGridInterface.hh"
 
 namespace celeritas
@@ -29,6 +30,9 @@ namespace celeritas
     XsCalculator calc_xs(xs_grid, xs_params.reals);
     real_type xs = calc_xs(particle);
    \endcode
+ *
+ * When evaluating several grids at the same energy, pass an \c EnergyLookup
+ * instead of the energy to reuse the log-energy bin between calculators.
  */
 class XsCalculator
 {
@@ -48,6 +52,9 @@ class XsCalculator
     // Find and interpolate from the energy
     inline CELER_FUNCTION real_type operator()(Energy energy) const;
 
+    // Find and interpolate using a precalculated energy lookup
+    inline CELER_FUNCTION real_type operator()(EnergyLookup& lookup) const;
+
     // Get the cross section at the given index
     inline CELER_FUNCTION real_type operator[](size_type index) const;
 
@@ -6,7 +6,6 @@
 //! \file XsCalculator.i.hh
 //---------------------------------------------------------------------------//
 #include <cmath>
-#include "Interpolator.hh"
 #include "UniformGrid.hh"
 
 namespace celeritas
@@ -26,53 +25,41 @@ XsCalculator::XsCalculator(const XsGridData& grid, const Values& values)
 //---------------------------------------------------------------------------//
 /*!
  * Calculate the cross section.
- *
- * If needed, we can add a "log(energy/MeV)" accessor if we constantly reuse
- * that value and don't want to repeat the `std::log` operation.
  */
 CELER_FUNCTION real_type XsCalculator::operator()(Energy energy) const
 {
-    const UniformGrid loge_grid(data_.log_energy);
-    const real_type   loge = std::log(energy.value());
+    EnergyLookup lookup(energy);
+    return (*this)(lookup);
+}
 
-    // Snap out-of-bounds values to closest grid points
-    size_type lower_idx;
-    real_type result;
-    if (loge <= loge_grid.front())
-    {
-        lower_idx = 0;
-        result    = this->get(lower_idx);
-    }
-    else if (loge >= loge_grid.back())
-    {
-        lower_idx = loge_grid.size() - 1;
-        result    = this->get(lower_idx);
-    }
-    else
-    {
-        // Locate the energy bin
-        lower_idx = loge_grid.find(loge);
-        CELER_ASSERT(lower_idx + 1 < loge_grid.size());
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the cross section using a precalculated energy lookup.
+ *
+ * Out-of-bounds values are snapped to the closest grid points.
+ */
+CELER_FUNCTION real_type XsCalculator::operator()(EnergyLookup& lookup) const
+{
+    const EnergyGridLocation& loc = lookup.locate(data_.log_energy);
 
-        const real_type upper_energy = std::exp(loge_grid[lower_idx + 1]);
-        real_type       upper_xs     = this->get(lower_idx + 1);
-        if (lower_idx + 1 == data_.prime_index)
+    real_type result = this->get(loc.index);
+    if (loc.in_bounds)
+    {
+        real_type upper_xs = this->get(loc.index + 1);
+        if (loc.index + 1 == data_.prime_index)
         {
             // Cross section data for the upper point has *already* been scaled
             // by E -- undo the scaling.
-            upper_xs /= upper_energy;
+            upper_xs /= loc.upper_energy;
         }
 
-        // Interpolate *linearly* on energy using the lower_idx data.
-        LinearInterpolator<real_type> interpolate_xs(
-            {std::exp(loge_grid[lower_idx]), this->get(lower_idx)},
-            {upper_energy, upper_xs});
-        result = interpolate_xs(energy.value());
+        // Interpolate *linearly* on energy
+        result += loc.fraction * (upper_xs - result);
     }
 
-    if (lower_idx >= data_.prime_index)
+    if (loc.index >= data_.prime_index)
     {
-        result /= energy.value();
+        result /= lookup.energy().value();
     }
     return result;
 }
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "base/Array.hh"
 #include "base/OpaqueId.hh"
 #include "random/distributions/GenerateCanonical.hh"
 #include "RngInterface.hh"
@@ -20,6 +21,12 @@ namespace celeritas
  * The RngEngine uses a C++11-like interface to generate random data. The
  * sampling of uniform floating point data is done with specializations to the
  * GenerateCanonical class.
+ *
+ * On device this wraps the CURAND XORWOW generator; on host it is a
+ * Philox4x32-10 counter-based generator whose stream is keyed on the seed,
+ * event, track, and step (see \c RngInitializer). The \c sample_block method
+ * returns the next four values at once (for filling SIMD lanes); the result
+ * is identical to four successive calls to the engine.
  */
 class RngEngine
 {
@@ -27,6 +34,7 @@ class RngEngine
     //!@{
     //! Type aliases
     using result_type   = unsigned int;
+    using Block_t       = Array<result_type, 4>;
     using Initializer_t = RngInitializer<MemSpace::native>;
     using StateRef      = RngStateData<Ownership::reference, MemSpace::native>;
     //!@}
@@ -38,11 +46,17 @@ class RngEngine
     // Initialize state from seed
     inline CELER_FUNCTION RngEngine& operator=(const Initializer_t& s);
 
+    // Start the stream for the track's next step
+    inline CELER_FUNCTION void next_step();
+
     // Sample a random number
     inline CELER_FUNCTION result_type operator()();
 
+    // Sample four random numbers
+    inline CELER_FUNCTION Block_t sample_block();
+
   private:
-    curandState_t* state_;
+    RngThreadState<MemSpace::native>* state_;
 
     template<class Generator, class RealType>
     friend class GenerateCanonical;
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 
 #include "celeritas_config.h"
+#include "detail/RngEngineImpl.hh"
 
 namespace celeritas
 {
@@ -18,7 +19,7 @@ CELER_FUNCTION
 RngEngine::RngEngine(const StateRef& state, const ThreadId& id)
 {
     CELER_EXPECT(id < state.rng.size());
-    state_ = &state.rng[id].state;
+    state_ = &state.rng[id];
 }
 
 //---------------------------------------------------------------------------//
@@ -27,17 +28,39 @@ RngEngine::RngEngine(const StateRef& state, const ThreadId& id)
  */
 CELER_FUNCTION RngEngine& RngEngine::operator=(const Initializer_t& s)
 {
-    curand_init(s.seed, 0, 0, state_);
+    detail::rng_init(s, state_);
     return *this;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Start the stream for the track's next step.
+ *
+ * On host this advances the step coordinate of the counter, so the values
+ * sampled in a step don't depend on how many were used in earlier steps. The
+ * device stream isn't keyed on the step, so this does nothing there.
+ */
+CELER_FUNCTION void RngEngine::next_step()
+{
+    detail::rng_next_step(state_);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Sample a random number.
  */
 CELER_FUNCTION auto RngEngine::operator()() -> result_type
 {
-    return curand(state_);
+    return detail::rng_next(state_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample four random numbers.
+ */
+CELER_FUNCTION auto RngEngine::sample_block() -> Block_t
+{
+    return detail::rng_next_block(state_);
 }
 
 //---------------------------------------------------------------------------//
@@ -49,7 +72,7 @@ CELER_FUNCTION auto RngEngine::operator()() -> result_type
 CELER_FUNCTION float
 GenerateCanonical<RngEngine, float>::operator()(RngEngine& rng)
 {
-    return curand_uniform(rng.state_);
+    return detail::rng_uniform_float(rng.state_);
 }
 
 //---------------------------------------------------------------------------//
@@ -59,7 +82,7 @@ GenerateCanonical<RngEngine, float>::operator()(RngEngine& rng)
 CELER_FUNCTION double
 GenerateCanonical<RngEngine, double>::operator()(RngEngine& rng)
 {
-    return curand_uniform_double(rng.state_);
+    return detail::rng_uniform_double(rng.state_);
 }
 
 //---------------------------------------------------------------------------//
@@ -10,8 +10,10 @@
 #include <random>
 #include "base/Assert.hh"
 #include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
 #include "comm/Device.hh"
 #include "detail/RngStateInit.hh"
+#include "RngEngine.hh"
 
 namespace celeritas
 {
@@ -48,5 +50,36 @@ void resize(
     detail::rng_state_init(make_ref(*state), make_const_ref(inits_device));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Resize and initialize host states with the seed stored in params.
+ *
+ * Each track slot is given its own counter-based stream keyed on the slot
+ * index. Track initialization rekeys the stream of a slot on the event and
+ * track ID of each new track, so the stream follows the track rather than the
+ * slot.
+ */
+void resize(
+    RngStateData<Ownership::value, MemSpace::host>*                  state,
+    const RngParamsData<Ownership::const_reference, MemSpace::host>& params,
+    size_type                                                        size)
+{
+    CELER_EXPECT(size > 0);
+
+    using RngInit = RngInitializer<MemSpace::host>;
+
+    make_builder(&state->rng).resize(size);
+    auto state_ref = make_ref(*state);
+    for (auto tid : range(ThreadId{size}))
+    {
+        RngInit init;
+        init.seed  = params.seed;
+        init.track = tid.get();
+
+        RngEngine rng(state_ref, tid);
+        rng = init;
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
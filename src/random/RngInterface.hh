@@ -20,6 +20,7 @@
 #    include "detail/curand.nocuda.hh"
 #endif
 
+#include "base/Array.hh"
 #include "base/Collection.hh"
 #include "base/Types.hh"
 
@@ -74,6 +75,13 @@ struct RngParamsData<W, MemSpace::host>
 //---------------------------------------------------------------------------//
 /*!
  * The underlying RNG state is *different* on host and device.
+ *
+ * The device uses the CURAND XORWOW generator. The host uses the Philox4x32-10
+ * counter-based generator: the stream is fully determined by the key (derived
+ * from the seed) and the counter (the event, track, and step numbers plus a
+ * running block index), so no state needs to be shared between threads and a
+ * track's random sequence is independent of which thread transports it. Each
+ * block yields four 32-bit values, which are buffered until consumed.
  */
 template<MemSpace M>
 struct RngThreadState;
@@ -87,12 +95,19 @@ struct RngThreadState<MemSpace::device>
 template<>
 struct RngThreadState<MemSpace::host>
 {
-    // TODO: std::shared_ptr<std::mt19937> rng; ?
+    Array<unsigned int, 2> key;     //!< Seed
+    Array<unsigned int, 4> counter; //!< Block, step, track, event
+    Array<unsigned int, 4> block;   //!< Output of the last encrypted counter
+    unsigned int           index;   //!< Next unused element of the block
 };
 
 //---------------------------------------------------------------------------//
 /*!
  * Initialize an RNG.
+ *
+ * The host generator is keyed on the full (seed, event, track, step) tuple so
+ * that each track can be assigned a reproducible stream; the device generator
+ * uses only the seed.
  */
 template<MemSpace M>
 struct RngInitializer;
@@ -103,6 +118,15 @@ struct RngInitializer<MemSpace::device>
     ull_int seed;
 };
 
+template<>
+struct RngInitializer<MemSpace::host>
+{
+    ull_int      seed;
+    unsigned int event{0};
+    unsigned int track{0};
+    unsigned int step{0};
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * RNG state data.
@@ -147,14 +171,11 @@ void resize(
     const RngParamsData<Ownership::const_reference, MemSpace::host>& params,
     size_type                                                        size);
 
-// Not-implemented resize of host data
-inline void
-resize(RngStateData<Ownership::value, MemSpace::host>*,
-       const RngParamsData<Ownership::const_reference, MemSpace::host>&,
-       size_type)
-{
-    CELER_NOT_IMPLEMENTED("Host RNG state");
-}
+// Resize and initialize host data with one stream per track slot
+void resize(
+    RngStateData<Ownership::value, MemSpace::host>*                  state,
+    const RngParamsData<Ownership::const_reference, MemSpace::host>& params,
+    size_type                                                        size);
 
 //---------------------------------------------------------------------------//
 } // namespace celeritas
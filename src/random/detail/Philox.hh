@@ -0,0 +1,108 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Philox.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Array.hh"
+#include "base/Macros.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//!@{
+//! Philox4x32 counter and key types
+using PhiloxCounter = Array<unsigned int, 4>;
+using PhiloxKey     = Array<unsigned int, 2>;
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Philox4x32-10 counter-based block cipher.
+ *
+ * This is the bijection from Salmon et al., "Parallel random numbers: as easy
+ * as 1, 2, 3" (SC11): each (counter, key) pair maps to four statistically
+ * independent 32-bit outputs. No state is carried between calls, so any
+ * element of any stream can be generated directly from its coordinates.
+ */
+class Philox4x32
+{
+  public:
+    // Encrypt a counter with the given key
+    static inline CELER_FUNCTION PhiloxCounter apply(PhiloxCounter   ctr,
+                                                     PhiloxKey key);
+
+  private:
+    //// CONSTANTS ////
+
+    static CELER_CONSTEXPR_FUNCTION unsigned int multiplier_0()
+    {
+        return 0xD2511F53u;
+    }
+    static CELER_CONSTEXPR_FUNCTION unsigned int multiplier_1()
+    {
+        return 0xCD9E8D57u;
+    }
+    static CELER_CONSTEXPR_FUNCTION unsigned int weyl_0()
+    {
+        return 0x9E3779B9u;
+    }
+    static CELER_CONSTEXPR_FUNCTION unsigned int weyl_1()
+    {
+        return 0xBB67AE85u;
+    }
+    static CELER_CONSTEXPR_FUNCTION int num_rounds() { return 10; }
+
+    //// HELPER FUNCTIONS ////
+
+    static inline CELER_FUNCTION PhiloxCounter round(const PhiloxCounter& ctr,
+                                                     const PhiloxKey&     key);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Encrypt a counter with the given key.
+ */
+CELER_FUNCTION PhiloxCounter Philox4x32::apply(PhiloxCounter ctr,
+                                               PhiloxKey     key)
+{
+    static_assert(sizeof(unsigned int) == 4,
+                  "Philox4x32 requires 32-bit unsigned integers");
+
+    ctr = round(ctr, key);
+    for (int i = 1; i < num_rounds(); ++i)
+    {
+        key[0] += weyl_0();
+        key[1] += weyl_1();
+        ctr = round(ctr, key);
+    }
+    return ctr;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a single S-box round.
+ */
+CELER_FUNCTION PhiloxCounter Philox4x32::round(const PhiloxCounter& ctr,
+                                               const PhiloxKey&     key)
+{
+    ull_int prod_0 = static_cast<ull_int>(multiplier_0()) * ctr[0];
+    ull_int prod_1 = static_cast<ull_int>(multiplier_1()) * ctr[2];
+
+    return {static_cast<unsigned int>(prod_1 >> 32) ^ ctr[1] ^ key[0],
+            static_cast<unsigned int>(prod_1),
+            static_cast<unsigned int>(prod_0 >> 32) ^ ctr[3] ^ key[1],
+            static_cast<unsigned int>(prod_0)};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
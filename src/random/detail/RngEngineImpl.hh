@@ -0,0 +1,175 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngEngineImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "random/RngInterface.hh"
+#include "Philox.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// DEVICE (CURAND) GENERATOR
+//---------------------------------------------------------------------------//
+//! Initialize the CURAND state from a seed
+inline CELER_FUNCTION void
+rng_init(const RngInitializer<MemSpace::device>& init,
+         RngThreadState<MemSpace::device>*       state)
+{
+    curand_init(init.seed, 0, 0, &state->state);
+}
+
+//! Start the next step (the CURAND stream isn't keyed on the step)
+inline CELER_FUNCTION void rng_next_step(RngThreadState<MemSpace::device>*) {}
+
+//! Sample a 32-bit random integer
+inline CELER_FUNCTION unsigned int
+rng_next(RngThreadState<MemSpace::device>* state)
+{
+    return curand(&state->state);
+}
+
+//! Sample four 32-bit random integers
+inline CELER_FUNCTION Array<unsigned int, 4>
+rng_next_block(RngThreadState<MemSpace::device>* state)
+{
+    Array<unsigned int, 4> result;
+    for (unsigned int& v : result)
+    {
+        v = curand(&state->state);
+    }
+    return result;
+}
+
+//! Sample a uniform float
+inline CELER_FUNCTION float
+rng_uniform_float(RngThreadState<MemSpace::device>* state)
+{
+    return curand_uniform(&state->state);
+}
+
+//! Sample a uniform double
+inline CELER_FUNCTION double
+rng_uniform_double(RngThreadState<MemSpace::device>* state)
+{
+    return curand_uniform_double(&state->state);
+}
+
+//---------------------------------------------------------------------------//
+// HOST (PHILOX) GENERATOR
+//---------------------------------------------------------------------------//
+/*!
+ * Key the Philox stream on the seed and the track coordinates.
+ *
+ * The first counter element is the block index within the stream; the others
+ * identify the step, track, and event.
+ */
+inline CELER_FUNCTION void
+rng_init(const RngInitializer<MemSpace::host>& init,
+         RngThreadState<MemSpace::host>*       state)
+{
+    state->key     = {static_cast<unsigned int>(init.seed),
+                  static_cast<unsigned int>(init.seed >> 32)};
+    state->counter = {0u, init.step, init.track, init.event};
+    state->block   = {0u, 0u, 0u, 0u};
+    state->index   = 4;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Advance the step coordinate and restart at the first block.
+ *
+ * Any values left over from the previous step are discarded, so the stream of
+ * each step depends only on the seed and the track coordinates.
+ */
+inline CELER_FUNCTION void rng_next_step(RngThreadState<MemSpace::host>* state)
+{
+    ++state->counter[1];
+    state->counter[0] = 0;
+    state->index      = 4;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Encrypt the current counter and advance to the next block.
+ */
+inline CELER_FUNCTION Array<unsigned int, 4>
+rng_encrypt(RngThreadState<MemSpace::host>* state)
+{
+    Array<unsigned int, 4> result
+        = Philox4x32::apply(state->counter, state->key);
+    ++state->counter[0];
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a 32-bit random integer.
+ */
+inline CELER_FUNCTION unsigned int
+rng_next(RngThreadState<MemSpace::host>* state)
+{
+    if (state->index == 4)
+    {
+        state->block = rng_encrypt(state);
+        state->index = 0;
+    }
+    return state->block[state->index++];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample four 32-bit random integers.
+ *
+ * If the buffered block is exhausted (the common case when only blocks are
+ * sampled) the new block is returned directly.
+ */
+inline CELER_FUNCTION Array<unsigned int, 4>
+rng_next_block(RngThreadState<MemSpace::host>* state)
+{
+    if (state->index == 4)
+    {
+        return rng_encrypt(state);
+    }
+
+    Array<unsigned int, 4> result;
+    for (unsigned int& v : result)
+    {
+        v = rng_next(state);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a float in [0, 1) from the upper 24 bits of a random integer.
+ */
+inline CELER_FUNCTION float
+rng_uniform_float(RngThreadState<MemSpace::host>* state)
+{
+    return static_cast<float>(rng_next(state) >> 8) * (1.0f / 16777216.0f);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a double in [0, 1) from 53 bits of two random integers.
+ */
+inline CELER_FUNCTION double
+rng_uniform_double(RngThreadState<MemSpace::host>* state)
+{
+    ull_int upper = rng_next(state);
+    ull_int lower = rng_next(state);
+    return static_cast<double>(((upper << 32) | lower) >> 11)
+           * (1.0 / 9007199254740992.0);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,71 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Scorer.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "geometry/Types.hh"
+#include "physics/base/Units.hh"
+#include "physics/material/Types.hh"
+#include "ScoringInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate energy deposition into one partition of the scoring state.
+ *
+ * Each deposit is added to one bin of every scorer (unless the point is
+ * outside the scorer's volumes, materials, or mesh). The partition is
+ * updated without atomics, so it must only be written by one thread at a
+ * time: for example, a host thread that owns a contiguous block of track
+ * slots, or a single track slot on the device.
+ *
+ * The per-partition sums are bitwise reproducible as long as each partition
+ * sees the same deposits in the same order, which is the case when the
+ * tracks assigned to a partition do not depend on the number of threads.
+ */
+class Scorer
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef
+        = ScoringParamsData<Ownership::const_reference, MemSpace::native>;
+    using StateRef = ScoringStateData<Ownership::reference, MemSpace::native>;
+    using Energy   = units::MevEnergy;
+    //!@}
+
+  public:
+    // Construct with shared and state data for a partition
+    inline CELER_FUNCTION Scorer(const ParamsRef& params,
+                                 const StateRef&  state,
+                                 size_type        partition);
+
+    // Deposit energy at a point
+    inline CELER_FUNCTION void operator()(VolumeId     volume,
+                                          MaterialId   material,
+                                          const Real3& pos,
+                                          Energy       energy) const;
+
+  private:
+    const ParamsRef& params_;
+    const StateRef&  state_;
+    size_type        offset_;
+
+    //// HELPER FUNCTIONS ////
+
+    // Find the mesh bin of a point, or the mesh size if outside
+    static inline CELER_FUNCTION size_type mesh_bin(const ScorerRecord&,
+                                                    const Real3& pos);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "Scorer.i.hh"
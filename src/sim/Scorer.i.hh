@@ -0,0 +1,88 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Scorer.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+#include "base/Range.hh"
+#include "physics/grid/UniformGrid.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with shared and state data for a partition.
+ */
+CELER_FUNCTION Scorer::Scorer(const ParamsRef& params,
+                              const StateRef&  state,
+                              size_type        partition)
+    : params_(params), state_(state), offset_(partition * params.num_bins)
+{
+    CELER_EXPECT(params_);
+    CELER_EXPECT(state_.num_bins() == params_.num_bins);
+    CELER_EXPECT(partition < state_.num_partitions);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Deposit energy at a point.
+ */
+CELER_FUNCTION void Scorer::operator()(VolumeId     volume,
+                                       MaterialId   material,
+                                       const Real3& pos,
+                                       Energy       energy) const
+{
+    using BinId = ItemId<real_type>;
+
+    for (auto id : range(ScorerId{params_.scorers.size()}))
+    {
+        const ScorerRecord& scorer = params_.scorers[id];
+
+        size_type bin = scorer.size;
+        switch (scorer.type)
+        {
+            case ScorerType::volume:
+                if (volume)
+                    bin = volume.get();
+                break;
+            case ScorerType::material:
+                if (material)
+                    bin = material.get();
+                break;
+            case ScorerType::mesh:
+                bin = Scorer::mesh_bin(scorer, pos);
+                break;
+        }
+        if (bin < scorer.size)
+        {
+            state_.tally[BinId{offset_ + scorer.offset + bin}]
+                += energy.value();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the mesh bin of a point, or the mesh size if outside.
+ */
+CELER_FUNCTION size_type Scorer::mesh_bin(const ScorerRecord& scorer,
+                                          const Real3&        pos)
+{
+    size_type bin = 0;
+    for (int ax = 0; ax != 3; ++ax)
+    {
+        UniformGrid grid(scorer.mesh[ax]);
+        if (!(pos[ax] >= grid.front() && pos[ax] < grid.back()))
+        {
+            return scorer.size;
+        }
+        bin = bin * (grid.size() - 1) + grid.find(pos[ax]);
+    }
+    return bin;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,159 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ScoringInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Array.hh"
+#include "base/Collection.hh"
+#include "base/Macros.hh"
+#include "base/OpaqueId.hh"
+#include "base/Types.hh"
+#include "physics/grid/UniformGridInterface.hh"
+
+#ifndef __CUDA_ARCH__
+#    include "base/CollectionAlgorithms.hh"
+#    include "base/CollectionBuilder.hh"
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Quantity that the energy deposition of a scorer is binned by.
+ */
+enum class ScorerType
+{
+    volume,   //!< Bin by geometry volume ID
+    material, //!< Bin by material ID
+    mesh      //!< Bin by position on a uniform cartesian mesh
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Definition of a single scorer.
+ *
+ * The bins of all scorers are stored contiguously: this scorer's bins are
+ * [offset, offset + size). Mesh bins are ordered with the z index varying
+ * fastest.
+ */
+struct ScorerRecord
+{
+    ScorerType                type{ScorerType::volume};
+    size_type                 offset{0}; //!< Index of the first bin
+    size_type                 size{0};   //!< Number of bins
+    Array<UniformGridData, 3> mesh;      //!< Mesh edges (mesh only)
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return size > 0
+               && (type != ScorerType::mesh
+                   || (mesh[0] && mesh[1] && mesh[2]
+                       && size
+                              == (mesh[0].size - 1) * (mesh[1].size - 1)
+                                     * (mesh[2].size - 1)));
+    }
+};
+
+//! Index of a scorer
+using ScorerId = OpaqueId<ScorerRecord>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Persistent shared data for energy deposition scorers.
+ *
+ * \sa ScoringParams
+ */
+template<Ownership W, MemSpace M>
+struct ScoringParamsData
+{
+    //// DATA ////
+
+    Collection<ScorerRecord, W, M, ScorerId> scorers;
+    size_type                                num_bins{0};
+
+    //// MEMBER FUNCTIONS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !scorers.empty() && num_bins > 0;
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    ScoringParamsData& operator=(const ScoringParamsData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        scorers  = other.scorers;
+        num_bins = other.num_bins;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Private energy deposition accumulators.
+ *
+ * The tally is stored as [partition][bin]. Each partition is written by a
+ * single worker at a time without atomics, and the partitions are combined
+ * with \c reduce_scores .
+ */
+template<Ownership W, MemSpace M>
+struct ScoringStateData
+{
+    //// DATA ////
+
+    Collection<real_type, W, M> tally; //!< [partition][bin]
+    size_type                   num_partitions{0};
+
+    //// MEMBER FUNCTIONS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_partitions > 0 && !tally.empty();
+    }
+
+    //! Number of bins per partition
+    CELER_FUNCTION size_type num_bins() const
+    {
+        return tally.size() / num_partitions;
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    ScoringStateData& operator=(ScoringStateData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        tally          = other.tally;
+        num_partitions = other.num_partitions;
+        return *this;
+    }
+};
+
+#ifndef __CUDA_ARCH__
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate zeroed accumulators for the given number of partitions.
+ */
+template<MemSpace M>
+inline void resize(
+    ScoringStateData<Ownership::value, M>*                               data,
+    const ScoringParamsData<Ownership::const_reference, MemSpace::host>& params,
+    size_type num_partitions)
+{
+    CELER_EXPECT(params);
+    CELER_EXPECT(num_partitions > 0);
+    make_builder(&data->tally).resize(num_partitions * params.num_bins);
+    celeritas::fill(real_type(0), &data->tally);
+    data->num_partitions = num_partitions;
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,62 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ScoringParams.cc
+//---------------------------------------------------------------------------//
+#include "ScoringParams.hh"
+
+#include "base/Assert.hh"
+#include "base/CollectionBuilder.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct on both host and device.
+ */
+ScoringParams::ScoringParams(const Input& input)
+{
+    CELER_VALIDATE(!input.scorers.empty(), << "no scorers were specified");
+
+    ScoringParamsData<Ownership::value, MemSpace::host> host_data;
+    auto scorers = make_builder(&host_data.scorers);
+    scorers.reserve(input.scorers.size());
+
+    for (const ScorerInput& inp : input.scorers)
+    {
+        ScorerRecord record;
+        record.type   = inp.type;
+        record.offset = host_data.num_bins;
+        if (inp.type == ScorerType::mesh)
+        {
+            CELER_VALIDATE(inp.mesh[0] && inp.mesh[1] && inp.mesh[2],
+                           << "invalid mesh for scorer "
+                           << scorers.size()
+                           << ": each axis must have at least two "
+                              "increasing edges");
+            record.mesh = inp.mesh;
+            record.size = (inp.mesh[0].size - 1) * (inp.mesh[1].size - 1)
+                          * (inp.mesh[2].size - 1);
+        }
+        else
+        {
+            CELER_VALIDATE(inp.num_bins > 0,
+                           << "invalid number of bins for scorer "
+                           << scorers.size());
+            record.size = inp.num_bins;
+        }
+        CELER_ASSERT(record);
+
+        host_data.num_bins += record.size;
+        scorers.push_back(record);
+    }
+
+    // Move to mirrored data, copying to device
+    data_ = CollectionMirror<ScoringParamsData>{std::move(host_data)};
+    CELER_ENSURE(this->data_);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
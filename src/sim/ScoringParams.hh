@@ -0,0 +1,89 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ScoringParams.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/CollectionMirror.hh"
+#include "ScoringInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Definitions of the energy deposition scorers for a problem.
+ *
+ * Each scorer bins the energy deposited at a point by the volume, the
+ * material, or the cell of a uniform cartesian mesh. For volume and
+ * material scorers, \c num_bins is the number of volumes or materials; for
+ * mesh scorers, each axis of \c mesh gives the cell edges in native length
+ * units.
+ *
+ * \code
+   ScoringParams::Input inp;
+   inp.scorers.push_back({ScorerType::volume, geo->num_volumes(), {}});
+   inp.scorers.push_back({ScorerType::mesh, 0, {x_edges, y_edges, z_edges}});
+   auto scoring = std::make_shared<ScoringParams>(std::move(inp));
+   \endcode
+ */
+class ScoringParams
+{
+  public:
+    //!@{
+    //! References to constructed data
+    using HostRef
+        = ScoringParamsData<Ownership::const_reference, MemSpace::host>;
+    using DeviceRef
+        = ScoringParamsData<Ownership::const_reference, MemSpace::device>;
+    //!@}
+
+    //! Definition of a single scorer
+    struct ScorerInput
+    {
+        ScorerType                type{ScorerType::volume};
+        size_type                 num_bins{0}; //!< Volume or material only
+        Array<UniformGridData, 3> mesh;        //!< Mesh only
+    };
+
+    //! Input data to construct this class
+    struct Input
+    {
+        std::vector<ScorerInput> scorers;
+    };
+
+  public:
+    // Construct with scorer definitions
+    explicit ScoringParams(const Input& input);
+
+    //! Number of scorers
+    ScorerId::size_type num_scorers() const
+    {
+        return this->host_pointers().scorers.size();
+    }
+
+    //! Total number of bins over all scorers
+    size_type num_bins() const { return this->host_pointers().num_bins; }
+
+    //! Bins of a single scorer in the reduced tally
+    const ScorerRecord& scorer(ScorerId id) const
+    {
+        return this->host_pointers().scorers[id];
+    }
+
+    //! Access scoring data on the host
+    const HostRef& host_pointers() const { return data_.host(); }
+
+    //! Access scoring data on the device
+    const DeviceRef& device_pointers() const { return data_.device(); }
+
+  private:
+    // Host/device storage and reference
+    CollectionMirror<ScoringParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,105 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ScoringUtils.cc
+//---------------------------------------------------------------------------//
+#include "ScoringUtils.hh"
+
+#include "celeritas_config.h"
+#include "base/Assert.hh"
+#include "base/CollectionAlgorithms.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sum the partitions of each bin with a fixed pairwise tree.
+ *
+ * In the pass with stride \em s, partition \em p (a multiple of 2s) adds
+ * partition p + s, so after the last pass partition zero holds the total.
+ * The order of the floating point additions depends only on the number of
+ * partitions, and each bin is summed independently, so the result does not
+ * depend on how the bins are divided among threads.
+ */
+void tree_reduce(Span<real_type> tally, size_type num_partitions)
+{
+    CELER_EXPECT(num_partitions > 0);
+    CELER_EXPECT(tally.size() % num_partitions == 0);
+
+    const size_type num_bins = tally.size() / num_partitions;
+    real_type*      data     = tally.data();
+
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (size_type bin = 0; bin < num_bins; ++bin)
+    {
+        for (size_type stride = 1; stride < num_partitions; stride *= 2)
+        {
+            for (size_type p = 0; p + stride < num_partitions;
+                 p += 2 * stride)
+            {
+                data[p * num_bins + bin]
+                    += data[(p + stride) * num_bins + bin];
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add the sum over all partitions to the result and reset the accumulators.
+ *
+ * This should be called at the end of each event, after all tracks have
+ * deposited their energy. The partitions are combined in a fixed order, so
+ * the result is bitwise reproducible for a given number of partitions
+ * regardless of the number of threads.
+ */
+template<>
+void reduce_scores(ScoringStateData<Ownership::value, MemSpace::host>* state,
+                   Span<real_type>                                     result)
+{
+    CELER_EXPECT(state && *state);
+    CELER_EXPECT(result.size() == state->num_bins());
+
+    Span<real_type> tally = state->tally[AllItems<real_type>{}];
+    tree_reduce(tally, state->num_partitions);
+    for (size_type bin = 0; bin < result.size(); ++bin)
+    {
+        result[bin] += tally[bin];
+    }
+
+    fill(real_type(0), &state->tally);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add the sum over all partitions to the result and reset the accumulators.
+ *
+ * The device accumulators are copied to the host for the reduction.
+ */
+template<>
+void reduce_scores(ScoringStateData<Ownership::value, MemSpace::device>* state,
+                   Span<real_type> result)
+{
+    CELER_EXPECT(state && *state);
+    CELER_EXPECT(result.size() == state->num_bins());
+
+    ScoringStateData<Ownership::value, MemSpace::host> host_state;
+    make_builder(&host_state.tally).resize(state->tally.size());
+    host_state.num_partitions = state->num_partitions;
+    copy_to_host(state->tally, host_state.tally[AllItems<real_type>{}]);
+    reduce_scores(&host_state, result);
+
+    fill(real_type(0), &state->tally);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
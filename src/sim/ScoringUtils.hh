@@ -0,0 +1,24 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ScoringUtils.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Span.hh"
+#include "ScoringInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+// Add the sum over all partitions to the result and reset the accumulators
+template<MemSpace M>
+void reduce_scores(ScoringStateData<Ownership::value, M>* state,
+                   Span<real_type>                        result);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
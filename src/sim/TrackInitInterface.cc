@@ -13,20 +13,22 @@
 
 namespace celeritas
 {
+namespace
+{
 //---------------------------------------------------------------------------//
 /*!
- * Resize and initialize track initializer data on device.
+ * Resize and initialize track initializer data.
  */
-void resize(
-    TrackInitStateData<Ownership::value, MemSpace::device>* data,
+template<MemSpace M>
+void resize_impl(
+    TrackInitStateData<Ownership::value, M>*                               data,
     const TrackInitParamsData<Ownership::const_reference, MemSpace::host>& params,
-    size_type size)
+    size_type                                                              size)
 {
     CELER_EXPECT(params);
     CELER_EXPECT(size > 0);
-    CELER_EXPECT(celeritas::device());
 
-    // Allocate device data
+    // Allocate data
     auto capacity = params.storage_factor * size;
     make_builder(&data->initializers.storage).resize(capacity);
     make_builder(&data->parents.storage).resize(capacity);
@@ -61,16 +63,32 @@ void resize(
     data->num_primaries  = params.primaries.size();
 }
 
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Resize and initialize track initializer data on device.
+ */
+void resize(
+    TrackInitStateData<Ownership::value, MemSpace::device>* data,
+    const TrackInitParamsData<Ownership::const_reference, MemSpace::host>& params,
+    size_type size)
+{
+    CELER_EXPECT(celeritas::device());
+    resize_impl(data, params, size);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Resize and initialize track initializer data on host.
  */
 void resize(
-    TrackInitStateData<Ownership::value, MemSpace::host>*,
-    const TrackInitParamsData<Ownership::const_reference, MemSpace::host>&,
-    size_type)
+    TrackInitStateData<Ownership::value, MemSpace::host>* data,
+    const TrackInitParamsData<Ownership::const_reference, MemSpace::host>& params,
+    size_type size)
 {
-    CELER_NOT_IMPLEMENTED("Host track initializer state");
+    resize_impl(data, params, size);
 }
 
 //---------------------------------------------------------------------------//
@@ -224,6 +224,10 @@ using TrackInitStateDeviceRef
     = TrackInitStateData<Ownership::reference, MemSpace::device>;
 using TrackInitStateDeviceVal
     = TrackInitStateData<Ownership::value, MemSpace::device>;
+using TrackInitStateHostRef
+    = TrackInitStateData<Ownership::reference, MemSpace::host>;
+using TrackInitStateHostVal
+    = TrackInitStateData<Ownership::value, MemSpace::host>;
 
 //---------------------------------------------------------------------------//
 // Resize and initialize track initializer data on device.
@@ -8,47 +8,86 @@
 #include "TrackInitUtils.hh"
 
 #include "base/Algorithms.hh"
+#include "base/DeviceVector.hh"
 #include "detail/InitializeTracks.hh"
 
 namespace celeritas
 {
+namespace
+{
 //---------------------------------------------------------------------------//
 /*!
- * Create track initializers on device from primary particles.
+ * Create track initializers from host primaries on host.
+ */
+void process_primaries(Span<const Primary>          primaries,
+                       const TrackInitStateHostRef& inits)
+{
+    detail::process_primaries(primaries, inits);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy host primaries to device and create track initializers there.
+ */
+void process_primaries(Span<const Primary>            primaries,
+                       const TrackInitStateDeviceRef& inits)
+{
+    DeviceVector<Primary> device_primaries(primaries.size());
+    device_primaries.copy_to_device(primaries);
+    detail::process_primaries(device_primaries.device_pointers(), inits);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create track initializers from primary particles.
+ *
+ * This creates the maximum possible number of track initializers from host
+ * primaries (the number of host primaries that have not yet been
+ * initialized, the size of the available storage in the track initializer
+ * vector, or \c max_count, whichever is smaller). For device states, the
+ * primaries are first copied to device.
  *
- * This creates the maximum possible number of track initializers on device
- * from host primaries (either the number of host primaries that have not yet
- * been initialized on device or the size of the available storage in the track
- * initializer vector, whichever is smaller).
+ * Passing the number of empty track slots as \c max_count keeps primaries
+ * that are still waiting for a slot from using up the initializer storage
+ * needed for secondaries.
+ *
+ * The new initializers are added to the back of the vector, where \c
+ * initialize_tracks expects the initializers of secondaries with a parent in
+ * \c parents. Any parents from secondaries that are still queued are
+ * therefore cleared, so those secondaries will be initialized from their
+ * position rather than from the wrong track's geometry state.
  */
-void extend_from_primaries(const TrackInitParamsHostRef& params,
-                           TrackInitStateDeviceVal*      data)
+template<MemSpace M>
+void extend_from_primaries(const TrackInitParamsHostRef&            params,
+                           TrackInitStateData<Ownership::value, M>* data,
+                           size_type                                max_count)
 {
     CELER_EXPECT(params);
     CELER_EXPECT(data && *data);
 
-    // Number of primaries to copy to device
+    // Number of primaries to initialize
     auto count = min(data->initializers.capacity() - data->initializers.size(),
-                     data->num_primaries);
+                     min(data->num_primaries, max_count));
     if (count)
     {
+        data->parents.resize(0);
         data->initializers.resize(data->initializers.size() + count);
 
-        // Allocate memory on device and copy primaries
-        DeviceVector<Primary> primaries(count);
-        primaries.copy_to_device(params.primaries[ItemRange<Primary>(
+        // Create track initializers from the last 'count' primaries
+        Span<const Primary> primaries = params.primaries[ItemRange<Primary>(
             ItemId<Primary>(data->num_primaries - count),
-            ItemId<Primary>(data->num_primaries))]);
+            ItemId<Primary>(data->num_primaries))];
         data->num_primaries -= count;
-
-        // Launch a kernel to create track initializers from primaries
-        detail::process_primaries(primaries.device_pointers(), make_ref(*data));
+        process_primaries(primaries, make_ref(*data));
     }
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Create track initializers on device from secondary particles.
+ * Create track initializers from secondary particles.
  *
  * Secondaries produced by each track are ordered arbitrarily in memory, and
  * the memory may be fragmented if not all secondaries survived cutoffs. For
@@ -103,9 +142,11 @@ void extend_from_primaries(const TrackInitParamsHostRef& params,
 
    \endverbatim
  */
-void extend_from_secondaries(const ParamsDeviceRef&   params,
-                             const StateDeviceRef&    states,
-                             TrackInitStateDeviceVal* data)
+template<MemSpace M>
+void extend_from_secondaries(
+    const ParamsData<Ownership::const_reference, M>& params,
+    const StateData<Ownership::reference, M>&        states,
+    TrackInitStateData<Ownership::value, M>*         data)
 {
     CELER_EXPECT(params);
     CELER_EXPECT(states);
@@ -114,20 +155,20 @@ void extend_from_secondaries(const ParamsDeviceRef&   params,
     // Resize the vector of vacancies to be equal to the number of tracks
     data->vacancies.resize(states.size());
 
-    // Launch a kernel to identify which track slots are still alive and count
-    // the number of surviving secondaries per track
+    // Identify which track slots are still alive and count the number of
+    // surviving secondaries per track
     detail::locate_alive(params, states, make_ref(*data));
 
     // Remove all elements in the vacancy vector that were flagged as active
     // tracks, leaving the (sorted) indices of the empty slots
-    size_type num_vac = detail::remove_if_alive(data->vacancies.pointers());
+    size_type num_vac = detail::remove_if_alive<M>(data->vacancies.pointers());
     data->vacancies.resize(num_vac);
 
     // Sum the total number secondaries produced in all interactions
     // TODO: if we don't have space for all the secondaries, we will need to
     // buffer the current track initializers to create room
-    size_type num_secondaries = detail::reduce_counts(
-        data->secondary_counts[AllItems<size_type, MemSpace::device>{}]);
+    size_type num_secondaries = detail::reduce_counts<M>(
+        data->secondary_counts[AllItems<size_type, M>{}]);
     CELER_VALIDATE(num_secondaries + data->initializers.size()
                        <= data->initializers.capacity(),
                    << "insufficient capacity (" << data->initializers.capacity()
@@ -140,10 +181,10 @@ void extend_from_secondaries(const ParamsDeviceRef&   params,
     // for each thread. Starting at that index, each thread creates track
     // initializers from all surviving secondaries produced in its
     // interaction.
-    detail::exclusive_scan_counts(
-        data->secondary_counts[AllItems<size_type, MemSpace::device>{}]);
+    detail::exclusive_scan_counts<M>(
+        data->secondary_counts[AllItems<size_type, M>{}]);
 
-    // Launch a kernel to create track initializers from secondaries
+    // Create track initializers from secondaries
     data->parents.resize(num_secondaries);
     data->initializers.resize(data->initializers.size() + num_secondaries);
     detail::process_secondaries(params, states, make_ref(*data));
@@ -151,16 +192,17 @@ void extend_from_secondaries(const ParamsDeviceRef&   params,
 
 //---------------------------------------------------------------------------//
 /*!
- * Initialize track states on device.
+ * Initialize track states.
  *
  * Tracks created from secondaries produced in this step will have the geometry
  * state copied over from the parent instead of initialized from the position.
  * If there are more empty slots than new secondaries, they will be filled by
  * any track initializers remaining from previous steps using the position.
  */
-void initialize_tracks(const ParamsDeviceRef&   params,
-                       const StateDeviceRef&    states,
-                       TrackInitStateDeviceVal* data)
+template<MemSpace M>
+void initialize_tracks(const ParamsData<Ownership::const_reference, M>& params,
+                       const StateData<Ownership::reference, M>&        states,
+                       TrackInitStateData<Ownership::value, M>*         data)
 {
     CELER_EXPECT(params);
     CELER_EXPECT(states);
@@ -172,12 +214,36 @@ void initialize_tracks(const ParamsDeviceRef&   params,
         = std::min(data->vacancies.size(), data->initializers.size());
     if (num_tracks > 0)
     {
-        // Launch a kernel to initialize tracks on device
+        // Initialize the tracks in the vacant slots
         detail::init_tracks(params, states, make_ref(*data));
         data->initializers.resize(data->initializers.size() - num_tracks);
         data->vacancies.resize(data->vacancies.size() - num_tracks);
     }
 }
 
+//---------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATION
+//---------------------------------------------------------------------------//
+template void extend_from_primaries(const TrackInitParamsHostRef&,
+                                    TrackInitStateHostVal*,
+                                    size_type);
+template void extend_from_primaries(const TrackInitParamsHostRef&,
+                                    TrackInitStateDeviceVal*,
+                                    size_type);
+
+template void extend_from_secondaries(const ParamsHostRef&,
+                                      const StateHostRef&,
+                                      TrackInitStateHostVal*);
+template void extend_from_secondaries(const ParamsDeviceRef&,
+                                      const StateDeviceRef&,
+                                      TrackInitStateDeviceVal*);
+
+template void initialize_tracks(const ParamsHostRef&,
+                                const StateHostRef&,
+                                TrackInitStateHostVal*);
+template void initialize_tracks(const ParamsDeviceRef&,
+                                const StateDeviceRef&,
+                                TrackInitStateDeviceVal*);
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
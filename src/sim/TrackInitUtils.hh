@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "base/NumericLimits.hh"
 #include "sim/TrackInitInterface.hh"
 #include "sim/TrackInterface.hh"
 
@@ -15,19 +16,25 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 // HELPER FUNCTIONS
 //---------------------------------------------------------------------------//
-// Create track initializers on device from primary particles
-void extend_from_primaries(const TrackInitParamsHostRef& params,
-                           TrackInitStateDeviceVal*      data);
+// Create track initializers from primary particles
+template<MemSpace M>
+void extend_from_primaries(
+    const TrackInitParamsHostRef&            params,
+    TrackInitStateData<Ownership::value, M>* data,
+    size_type max_count = numeric_limits<size_type>::max());
 
-// Create track initializers on device from secondary particles.
-void extend_from_secondaries(const ParamsDeviceRef&   params,
-                             const StateDeviceRef&    states,
-                             TrackInitStateDeviceVal* data);
+// Create track initializers from secondary particles.
+template<MemSpace M>
+void extend_from_secondaries(
+    const ParamsData<Ownership::const_reference, M>& params,
+    const StateData<Ownership::reference, M>&        states,
+    TrackInitStateData<Ownership::value, M>*         data);
 
-// Initialize track states on device.
-void initialize_tracks(const ParamsDeviceRef&   params,
-                       const StateDeviceRef&    states,
-                       TrackInitStateDeviceVal* data);
+// Initialize track states.
+template<MemSpace M>
+void initialize_tracks(const ParamsData<Ownership::const_reference, M>& params,
+                       const StateData<Ownership::reference, M>&        states,
+                       TrackInitStateData<Ownership::value, M>*         data);
 
 //---------------------------------------------------------------------------//
 } // namespace celeritas
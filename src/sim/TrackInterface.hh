@@ -98,6 +98,8 @@ struct StateData
 using ParamsDeviceRef
     = ParamsData<Ownership::const_reference, MemSpace::device>;
 using StateDeviceRef = StateData<Ownership::reference, MemSpace::device>;
+using ParamsHostRef  = ParamsData<Ownership::const_reference, MemSpace::host>;
+using StateHostRef   = StateData<Ownership::reference, MemSpace::host>;
 
 //---------------------------------------------------------------------------//
 /*!
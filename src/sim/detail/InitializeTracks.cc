@@ -0,0 +1,275 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file InitializeTracks.cc
+//---------------------------------------------------------------------------//
+#include "InitializeTracks.hh"
+
+#include <algorithm>
+#include <vector>
+#include "celeritas_config.h"
+#include "base/Algorithms.hh"
+#include "TrackInitLauncher.hh"
+
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Number of contiguous blocks to divide a host array into.
+ *
+ * Each block is processed by a single thread, so the results of the blocked
+ * algorithms below are independent of the thread count as long as they
+ * operate on integers.
+ */
+size_type num_blocks(size_type size)
+{
+#if CELERITAS_USE_OPENMP
+    size_type num_threads = omp_get_max_threads();
+#else
+    size_type num_threads = 1;
+#endif
+    return celeritas::max<size_type>(1, celeritas::min(num_threads, size));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Index of the first element of the given block.
+ */
+size_type block_begin(size_type size, size_type num_blocks, size_type block)
+{
+    return static_cast<size_type>(static_cast<ull_int>(size) * block
+                                  / num_blocks);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch a host loop over track slots.
+ */
+template<class F>
+void launch_host(size_type size, const F& launch)
+{
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (size_type i = 0; i < size; ++i)
+    {
+        launch(ThreadId{i});
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+// HOST INTERFACE
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize the track states on host.
+ */
+void init_tracks(const ParamsHostRef&         params,
+                 const StateHostRef&          states,
+                 const TrackInitStateHostRef& inits)
+{
+    // Number of vacancies, limited by the initializer size
+    auto num_vacancies
+        = std::min(inits.vacancies.size(), inits.initializers.size());
+
+    launch_host(num_vacancies,
+                InitTracksLauncher<MemSpace::host>(params, states, inits));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find empty slots in the vector of tracks and count the number of secondaries
+ * that survived cutoffs for each interaction.
+ */
+void locate_alive(const ParamsHostRef&         params,
+                  const StateHostRef&          states,
+                  const TrackInitStateHostRef& inits)
+{
+    launch_host(states.size(),
+                LocateAliveLauncher<MemSpace::host>(params, states, inits));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create track initializers from primary particles.
+ */
+void process_primaries(Span<const Primary>          primaries,
+                       const TrackInitStateHostRef& inits)
+{
+    CELER_EXPECT(primaries.size() <= inits.initializers.size());
+
+    launch_host(primaries.size(),
+                ProcessPrimariesLauncher<MemSpace::host>(primaries, inits));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create track initializers from secondary particles.
+ */
+void process_secondaries(const ParamsHostRef&         params,
+                         const StateHostRef&          states,
+                         const TrackInitStateHostRef& inits)
+{
+    CELER_EXPECT(states.size() <= inits.secondary_counts.size());
+    CELER_EXPECT(states.size() <= states.interactions.size());
+
+    launch_host(
+        states.size(),
+        ProcessSecondariesLauncher<MemSpace::host>(params, states, inits));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Remove all elements in the vacancy vector that were flagged as active
+ * tracks.
+ *
+ * This is a stable compaction (like \c thrust::remove_if) so that the
+ * remaining vacancies stay sorted. Each block counts its surviving elements,
+ * the block counts are scanned to get output offsets, and each block then
+ * copies its survivors from a snapshot of the input.
+ */
+template<>
+size_type remove_if_alive<MemSpace::host>(Span<size_type> vacancies)
+{
+    const size_type size = vacancies.size();
+    const size_type nb   = num_blocks(size);
+
+    std::vector<size_type> input(vacancies.begin(), vacancies.end());
+    std::vector<size_type> offsets(nb + 1, 0);
+
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (size_type b = 0; b < nb; ++b)
+    {
+        size_type count = 0;
+        for (size_type i = block_begin(size, nb, b),
+                       end = block_begin(size, nb, b + 1);
+             i != end;
+             ++i)
+        {
+            if (input[i] != flag_id())
+            {
+                ++count;
+            }
+        }
+        offsets[b + 1] = count;
+    }
+
+    for (size_type b = 0; b < nb; ++b)
+    {
+        offsets[b + 1] += offsets[b];
+    }
+
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (size_type b = 0; b < nb; ++b)
+    {
+        size_type dst = offsets[b];
+        for (size_type i = block_begin(size, nb, b),
+                       end = block_begin(size, nb, b + 1);
+             i != end;
+             ++i)
+        {
+            if (input[i] != flag_id())
+            {
+                vacancies[dst++] = input[i];
+            }
+        }
+    }
+
+    // New size of the vacancy vector
+    return offsets.back();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sum the total number of surviving secondaries.
+ */
+template<>
+size_type reduce_counts<MemSpace::host>(Span<size_type> counts)
+{
+    size_type result = 0;
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for reduction(+ : result)
+#endif
+    for (size_type i = 0; i < counts.size(); ++i)
+    {
+        result += counts[i];
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Do an exclusive scan of the number of surviving secondaries from each track.
+ *
+ * This is a blocked two-pass scan: each block is summed in parallel, the
+ * block sums are scanned serially, and each block is then scanned in parallel
+ * starting from its offset. The result is identical to a serial scan.
+ */
+template<>
+void exclusive_scan_counts<MemSpace::host>(Span<size_type> counts)
+{
+    const size_type size = counts.size();
+    const size_type nb   = num_blocks(size);
+
+    std::vector<size_type> offsets(nb + 1, 0);
+
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (size_type b = 0; b < nb; ++b)
+    {
+        size_type sum = 0;
+        for (size_type i = block_begin(size, nb, b),
+                       end = block_begin(size, nb, b + 1);
+             i != end;
+             ++i)
+        {
+            sum += counts[i];
+        }
+        offsets[b + 1] = sum;
+    }
+
+    for (size_type b = 0; b < nb; ++b)
+    {
+        offsets[b + 1] += offsets[b];
+    }
+
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (size_type b = 0; b < nb; ++b)
+    {
+        size_type running = offsets[b];
+        for (size_type i = block_begin(size, nb, b),
+                       end = block_begin(size, nb, b + 1);
+             i != end;
+             ++i)
+        {
+            size_type count = counts[i];
+            counts[i]       = running;
+            running += count;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -11,13 +11,8 @@
 #include <thrust/reduce.h>
 #include <thrust/remove.h>
 #include <thrust/scan.h>
-#include <vector>
-#include "base/Atomics.hh"
-#include "base/DeviceVector.hh"
 #include "base/KernelParamCalculator.cuda.hh"
-#include "geometry/GeoTrackView.hh"
-#include "physics/base/ParticleTrackView.hh"
-#include "sim/SimTrackView.hh"
+#include "TrackInitLauncher.hh"
 
 namespace celeritas
 {
@@ -39,9 +34,7 @@ struct IsEqual
 // KERNELS
 //---------------------------------------------------------------------------//
 /*!
- * Initialize the track states on device. The track initializers are created
- * from either primary particles or secondaries. The new tracks are inserted
- * into empty slots (vacancies) in the track vector.
+ * Initialize the track states on device.
  */
 __global__ void init_tracks_kernel(const ParamsDeviceRef         params,
                                    const StateDeviceRef          states,
@@ -52,53 +45,14 @@ __global__ void init_tracks_kernel(const ParamsDeviceRef         params,
     if (!(tid < num_vacancies))
         return;
 
-    // Get the track initializer from the back of the vector. Since new
-    // initializers are pushed to the back of the vector, these will be the
-    // most recently added and therefore the ones that still might have a
-    // parent they can copy the geometry state from.
-    const TrackInitializer& init
-        = inits.initializers[from_back(inits.initializers.size(), tid)];
-
-    // Thread ID of vacant track where the new track will be initialized
-    ThreadId vac_id(inits.vacancies[from_back(inits.vacancies.size(), tid)]);
-
-    // Initialize the simulation state
-    {
-        SimTrackView sim(states.sim, vac_id);
-        sim = init.sim;
-    }
-
-    // Initialize the particle physics data
-    {
-        ParticleTrackView particle(params.particles, states.particles, vac_id);
-        particle = init.particle;
-    }
-
-    // Initialize the geometry
-    {
-        GeoTrackView geo(params.geometry, states.geometry, vac_id);
-        if (tid < inits.parents.size())
-        {
-            // Copy the geometry state from the parent for improved
-            // performance
-            ThreadId parent_id
-                = inits.parents[from_back(inits.parents.size(), tid)];
-            GeoTrackView parent(params.geometry, states.geometry, parent_id);
-            geo = {parent, init.geo.dir};
-        }
-        else
-        {
-            // Initialize it from the position (more expensive)
-            geo = init.geo;
-        }
-    }
+    InitTracksLauncher<MemSpace::device> launch(params, states, inits);
+    launch(tid);
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * Find empty slots in the track vector and count the number of secondaries
- * that survived cutoffs for each interaction. If the track is dead and
- * produced secondaries, fill the empty track slot with one of the secondaries.
+ * that survived cutoffs for each interaction.
  */
 __global__ void locate_alive_kernel(const ParamsDeviceRef         params,
                                     const StateDeviceRef          states,
@@ -108,65 +62,8 @@ __global__ void locate_alive_kernel(const ParamsDeviceRef         params,
     if (!(tid < states.size()))
         return;
 
-    // Index of the secondary to copy to the parent track if vacant
-    size_type secondary_idx = flag_id();
-
-    // Count how many secondaries survived cutoffs for each track
-    inits.secondary_counts[tid] = 0;
-    Interaction& result         = states.interactions[tid];
-    for (auto i : range(result.secondaries.size()))
-    {
-        if (result.secondaries[i])
-        {
-            if (secondary_idx == flag_id())
-            {
-                secondary_idx = i;
-            }
-            ++inits.secondary_counts[tid];
-        }
-    }
-
-    SimTrackView sim(states.sim, tid);
-    if (sim.alive())
-    {
-        // The track is alive: mark this track slot as occupied
-        inits.vacancies[tid] = flag_id();
-    }
-    else if (secondary_idx != flag_id())
-    {
-        // The track was killed and it produced secondaries: fill the empty
-        // track slot with the first secondary and mark as occupied
-
-        // Calculate the track ID of the secondary
-        // TODO: This is nondeterministic; we need to calculate the track
-        // ID in a reproducible way.
-        CELER_ASSERT(sim.event_id() < inits.track_counters.size());
-        TrackId::size_type track_id
-            = atomic_add(&inits.track_counters[sim.event_id()], 1u);
-
-        // Initialize the simulation state
-        sim = {TrackId{track_id}, sim.track_id(), sim.event_id(), true};
-
-        // Initialize the particle state from the secondary
-        Secondary&        secondary = result.secondaries[secondary_idx];
-        ParticleTrackView particle(params.particles, states.particles, tid);
-        particle = {secondary.particle_id, secondary.energy};
-
-        // Keep the parent's geometry state
-        GeoTrackView geo(params.geometry, states.geometry, tid);
-        geo = {geo, secondary.direction};
-
-        // Mark the secondary as processed and the track as active
-        --inits.secondary_counts[tid];
-        secondary            = Secondary{};
-        inits.vacancies[tid] = flag_id();
-    }
-    else
-    {
-        // The track was killed and did not produce secondaries: store the
-        // index so it can be used later to initialize a new track
-        inits.vacancies[tid] = tid.get();
-    }
+    LocateAliveLauncher<MemSpace::device> launch(params, states, inits);
+    launch(tid);
 }
 
 //---------------------------------------------------------------------------//
@@ -180,19 +77,8 @@ __global__ void process_primaries_kernel(const Span<const Primary> primaries,
     if (!(tid < primaries.size()))
         return;
 
-    TrackInitializer& init    = inits.initializers[ThreadId(
-        inits.initializers.size() - primaries.size() + tid.get())];
-    const Primary&    primary = primaries[tid.get()];
-
-    // Construct a track initializer from a primary particle
-    init.sim.track_id         = primary.track_id;
-    init.sim.parent_id        = TrackId{};
-    init.sim.event_id         = primary.event_id;
-    init.sim.alive            = true;
-    init.geo.pos              = primary.position;
-    init.geo.dir              = primary.direction;
-    init.particle.particle_id = primary.particle_id;
-    init.particle.energy      = primary.energy;
+    ProcessPrimariesLauncher<MemSpace::device> launch(primaries, inits);
+    launch(tid);
 }
 
 //---------------------------------------------------------------------------//
@@ -207,46 +93,8 @@ __global__ void process_secondaries_kernel(const ParamsDeviceRef params,
     if (!(tid < states.size()))
         return;
 
-    // Construct the state accessors
-    GeoTrackView geo(params.geometry, states.geometry, tid);
-    SimTrackView sim(states.sim, tid);
-
-    // Offset in the vector of track initializers
-    size_type offset_id = inits.secondary_counts[tid];
-
-    Interaction& result = states.interactions[tid];
-    for (const auto& secondary : result.secondaries)
-    {
-        if (secondary)
-        {
-            // The secondary survived cutoffs: convert to a track
-            CELER_ASSERT(offset_id < inits.parents.size());
-            TrackInitializer& init = inits.initializers[ThreadId(
-                inits.initializers.size() - inits.parents.size() + offset_id)];
-
-            // Store the thread ID of the secondary's parent
-            inits.parents[ThreadId{offset_id++}] = tid;
-
-            // Calculate the track ID of the secondary
-            // TODO: This is nondeterministic; we need to calculate the
-            // track ID in a reproducible way.
-            CELER_ASSERT(sim.event_id() < inits.track_counters.size());
-            TrackId::size_type track_id
-                = atomic_add(&inits.track_counters[sim.event_id()], 1u);
-
-            // Construct a track initializer from a secondary
-            init.sim.track_id         = TrackId{track_id};
-            init.sim.parent_id        = sim.track_id();
-            init.sim.event_id         = sim.event_id();
-            init.sim.alive            = true;
-            init.geo.pos              = geo.pos();
-            init.geo.dir              = secondary.direction;
-            init.particle.particle_id = secondary.particle_id;
-            init.particle.energy      = secondary.energy;
-        }
-    }
-    // Clear the secondaries from the interaction
-    result.secondaries = {};
+    ProcessSecondariesLauncher<MemSpace::device> launch(params, states, inits);
+    launch(tid);
 }
 } // end namespace
 
@@ -331,7 +179,8 @@ void process_secondaries(const ParamsDeviceRef&         params,
  * Remove all elements in the vacancy vector that were flagged as active
  * tracks.
  */
-size_type remove_if_alive(Span<size_type> vacancies)
+template<>
+size_type remove_if_alive<MemSpace::device>(Span<size_type> vacancies)
 {
     thrust::device_ptr<size_type> end = thrust::remove_if(
         thrust::device_pointer_cast(vacancies.data()),
@@ -349,7 +198,8 @@ size_type remove_if_alive(Span<size_type> vacancies)
 /*!
  * Sum the total number of surviving secondaries.
  */
-size_type reduce_counts(Span<size_type> counts)
+template<>
+size_type reduce_counts<MemSpace::device>(Span<size_type> counts)
 {
     size_type result = thrust::reduce(
         thrust::device_pointer_cast(counts.data()),
@@ -369,7 +219,8 @@ size_type reduce_counts(Span<size_type> counts)
  * array elements, i.e., \f$ y_i = \sum_{j=0}^{i-1} x_j \f$,
  * where \f$ y_0 = 0 \f$, and stores the result in the input array.
  */
-void exclusive_scan_counts(Span<size_type> counts)
+template<>
+void exclusive_scan_counts<MemSpace::device>(Span<size_type> counts)
 {
     thrust::exclusive_scan(
         thrust::device_pointer_cast(counts.data()),
@@ -29,10 +29,13 @@ CELER_CONSTEXPR_FUNCTION size_type flag_id()
 inline CELER_FUNCTION ThreadId from_back(size_type size, ThreadId cur_thread);
 
 //---------------------------------------------------------------------------//
-// Initialize the track states on device.
+// Initialize the track states.
 void init_tracks(const ParamsDeviceRef&         params,
                  const StateDeviceRef&          states,
                  const TrackInitStateDeviceRef& inits);
+void init_tracks(const ParamsHostRef&         params,
+                 const StateHostRef&          states,
+                 const TrackInitStateHostRef& inits);
 
 //---------------------------------------------------------------------------//
 // Identify which tracks are still alive and count the number of secondaries
@@ -40,30 +43,56 @@ void init_tracks(const ParamsDeviceRef&         params,
 void locate_alive(const ParamsDeviceRef&         params,
                   const StateDeviceRef&          states,
                   const TrackInitStateDeviceRef& inits);
+void locate_alive(const ParamsHostRef&         params,
+                  const StateHostRef&          states,
+                  const TrackInitStateHostRef& inits);
 
 //---------------------------------------------------------------------------//
-// Create track initializers on device from primary particles
+// Create track initializers from primary particles
 void process_primaries(Span<const Primary>            primaries,
                        const TrackInitStateDeviceRef& inits);
+void process_primaries(Span<const Primary>          primaries,
+                       const TrackInitStateHostRef& inits);
 
 //---------------------------------------------------------------------------//
-// Create track initializers on device from secondary particles.
+// Create track initializers from secondary particles.
 void process_secondaries(const ParamsDeviceRef&         params,
                          const StateDeviceRef&          states,
                          const TrackInitStateDeviceRef& inits);
+void process_secondaries(const ParamsHostRef&         params,
+                         const StateHostRef&          states,
+                         const TrackInitStateHostRef& inits);
 
 //---------------------------------------------------------------------------//
 // Remove all elements in the vacancy vector that were flagged as alive
+template<MemSpace M>
 size_type remove_if_alive(Span<size_type> vacancies);
 
 //---------------------------------------------------------------------------//
 // Sum the total number of surviving secondaries.
+template<MemSpace M>
 size_type reduce_counts(Span<size_type> counts);
 
 //---------------------------------------------------------------------------//
 // Calculate the exclusive prefix sum of the number of surviving secondaries
+template<MemSpace M>
 void exclusive_scan_counts(Span<size_type> counts);
 
+//---------------------------------------------------------------------------//
+// Explicit specializations
+template<>
+size_type remove_if_alive<MemSpace::host>(Span<size_type>);
+template<>
+size_type remove_if_alive<MemSpace::device>(Span<size_type>);
+template<>
+size_type reduce_counts<MemSpace::host>(Span<size_type>);
+template<>
+size_type reduce_counts<MemSpace::device>(Span<size_type>);
+template<>
+void exclusive_scan_counts<MemSpace::host>(Span<size_type>);
+template<>
+void exclusive_scan_counts<MemSpace::device>(Span<size_type>);
+
 //---------------------------------------------------------------------------//
 // INLINE FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -40,17 +40,20 @@ void process_secondaries(const ParamsDeviceRef&,
     CELER_ASSERT_UNREACHABLE();
 }
 
-size_type remove_if_alive(Span<size_type>)
+template<>
+size_type remove_if_alive<MemSpace::device>(Span<size_type>)
 {
     CELER_ASSERT_UNREACHABLE();
 }
 
-size_type reduce_counts(Span<size_type>)
+template<>
+size_type reduce_counts<MemSpace::device>(Span<size_type>)
 {
     CELER_ASSERT_UNREACHABLE();
 }
 
-void exclusive_scan_counts(Span<size_type>)
+template<>
+void exclusive_scan_counts<MemSpace::device>(Span<size_type>)
 {
     CELER_ASSERT_UNREACHABLE();
 }
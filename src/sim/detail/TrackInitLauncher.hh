@@ -0,0 +1,382 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackInitLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Atomics.hh"
+#include "base/Macros.hh"
+#include "base/Range.hh"
+#include "base/Span.hh"
+#include "geometry/GeoTrackView.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/Primary.hh"
+#include "random/detail/RngEngineImpl.hh"
+#include "sim/SimTrackView.hh"
+#include "sim/TrackInitInterface.hh"
+#include "sim/TrackInterface.hh"
+#include "InitializeTracks.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Key the host RNG stream of a new track on its event and track IDs.
+ *
+ * The random sequence of a track then doesn't depend on the slot it lands in
+ * or on the number of slots.
+ */
+inline CELER_FUNCTION void init_rng(const ParamsHostRef& params,
+                                    const StateHostRef&  states,
+                                    ThreadId             tid,
+                                    EventId              event_id,
+                                    TrackId              track_id)
+{
+    RngInitializer<MemSpace::host> init;
+    init.seed  = params.rng.seed;
+    init.event = event_id.get();
+    init.track = track_id.get();
+    rng_init(init, &states.rng.rng[tid]);
+}
+
+//! Device streams are only seeded per slot when the states are resized
+inline CELER_FUNCTION void init_rng(const ParamsDeviceRef&,
+                                    const StateDeviceRef&,
+                                    ThreadId,
+                                    EventId,
+                                    TrackId)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Initialize the track states.
+ *
+ * The track initializers are created from either primary particles or
+ * secondaries. The new tracks are inserted into empty slots (vacancies) in the
+ * track vector.
+ */
+template<MemSpace M>
+class InitTracksLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef    = ParamsData<Ownership::const_reference, M>;
+    using StateRef     = StateData<Ownership::reference, M>;
+    using TrackInitRef = TrackInitStateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    // Construct with shared, state, and initializer data
+    CELER_FUNCTION InitTracksLauncher(const ParamsRef&    params,
+                                      const StateRef&     states,
+                                      const TrackInitRef& inits)
+        : params_(params), states_(states), inits_(inits)
+    {
+    }
+
+    // Initialize a track from the given vacancy index
+    inline CELER_FUNCTION void operator()(ThreadId tid) const;
+
+  private:
+    const ParamsRef&    params_;
+    const StateRef&     states_;
+    const TrackInitRef& inits_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find empty slots in the track vector and count secondaries.
+ *
+ * This counts the number of secondaries that survived cutoffs for each
+ * interaction. If the track is dead and produced secondaries, the empty track
+ * slot is filled with one of the secondaries.
+ */
+template<MemSpace M>
+class LocateAliveLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef    = ParamsData<Ownership::const_reference, M>;
+    using StateRef     = StateData<Ownership::reference, M>;
+    using TrackInitRef = TrackInitStateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    // Construct with shared, state, and initializer data
+    CELER_FUNCTION LocateAliveLauncher(const ParamsRef&    params,
+                                       const StateRef&     states,
+                                       const TrackInitRef& inits)
+        : params_(params), states_(states), inits_(inits)
+    {
+    }
+
+    // Process a single track slot
+    inline CELER_FUNCTION void operator()(ThreadId tid) const;
+
+  private:
+    const ParamsRef&    params_;
+    const StateRef&     states_;
+    const TrackInitRef& inits_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create track initializers from primary particles.
+ */
+template<MemSpace M>
+class ProcessPrimariesLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using TrackInitRef = TrackInitStateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    // Construct with primaries and initializer data
+    CELER_FUNCTION ProcessPrimariesLauncher(Span<const Primary> primaries,
+                                            const TrackInitRef& inits)
+        : primaries_(primaries), inits_(inits)
+    {
+    }
+
+    // Create a track initializer from a single primary
+    inline CELER_FUNCTION void operator()(ThreadId tid) const;
+
+  private:
+    Span<const Primary> primaries_;
+    const TrackInitRef& inits_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create track initializers from secondary particles.
+ */
+template<MemSpace M>
+class ProcessSecondariesLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef    = ParamsData<Ownership::const_reference, M>;
+    using StateRef     = StateData<Ownership::reference, M>;
+    using TrackInitRef = TrackInitStateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    // Construct with shared, state, and initializer data
+    CELER_FUNCTION ProcessSecondariesLauncher(const ParamsRef&    params,
+                                              const StateRef&     states,
+                                              const TrackInitRef& inits)
+        : params_(params), states_(states), inits_(inits)
+    {
+    }
+
+    // Create track initializers from the secondaries of a single track
+    inline CELER_FUNCTION void operator()(ThreadId tid) const;
+
+  private:
+    const ParamsRef&    params_;
+    const StateRef&     states_;
+    const TrackInitRef& inits_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void InitTracksLauncher<M>::operator()(ThreadId tid) const
+{
+    // Get the track initializer from the back of the vector. Since new
+    // initializers are pushed to the back of the vector, these will be the
+    // most recently added and therefore the ones that still might have a
+    // parent they can copy the geometry state from.
+    const TrackInitializer& init
+        = inits_.initializers[from_back(inits_.initializers.size(), tid)];
+
+    // Thread ID of vacant track where the new track will be initialized
+    ThreadId vac_id(inits_.vacancies[from_back(inits_.vacancies.size(), tid)]);
+
+    // Initialize the simulation state and key the track's random stream
+    {
+        SimTrackView sim(states_.sim, vac_id);
+        sim = init.sim;
+        init_rng(
+            params_, states_, vac_id, init.sim.event_id, init.sim.track_id);
+    }
+
+    // Initialize the particle physics data
+    {
+        ParticleTrackView particle(
+            params_.particles, states_.particles, vac_id);
+        particle = init.particle;
+    }
+
+    // Initialize the geometry
+    {
+        GeoTrackView geo(params_.geometry, states_.geometry, vac_id);
+        if (tid < inits_.parents.size())
+        {
+            // Copy the geometry state from the parent for improved
+            // performance
+            ThreadId parent_id
+                = inits_.parents[from_back(inits_.parents.size(), tid)];
+            GeoTrackView parent(
+                params_.geometry, states_.geometry, parent_id);
+            geo = {parent, init.geo.dir};
+        }
+        else
+        {
+            // Initialize it from the position (more expensive)
+            geo = init.geo;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void LocateAliveLauncher<M>::operator()(ThreadId tid) const
+{
+    // Index of the secondary to copy to the parent track if vacant
+    size_type secondary_idx = flag_id();
+
+    // Count how many secondaries survived cutoffs for each track
+    inits_.secondary_counts[tid] = 0;
+    Interaction& result          = states_.interactions[tid];
+    for (auto i : range(result.secondaries.size()))
+    {
+        if (result.secondaries[i])
+        {
+            if (secondary_idx == flag_id())
+            {
+                secondary_idx = i;
+            }
+            ++inits_.secondary_counts[tid];
+        }
+    }
+
+    SimTrackView sim(states_.sim, tid);
+    if (sim.alive())
+    {
+        // The track is alive: mark this track slot as occupied
+        inits_.vacancies[tid] = flag_id();
+    }
+    else if (secondary_idx != flag_id())
+    {
+        // The track was killed and it produced secondaries: fill the empty
+        // track slot with the first secondary and mark as occupied
+
+        // Calculate the track ID of the secondary
+        // TODO: This is nondeterministic; we need to calculate the track
+        // ID in a reproducible way.
+        CELER_ASSERT(sim.event_id() < inits_.track_counters.size());
+        TrackId::size_type track_id
+            = atomic_add(&inits_.track_counters[sim.event_id()], 1u);
+
+        // Initialize the simulation state and key the random stream
+        sim = {TrackId{track_id}, sim.track_id(), sim.event_id(), true};
+        init_rng(params_, states_, tid, sim.event_id(), TrackId{track_id});
+
+        // Initialize the particle state from the secondary
+        Secondary&        secondary = result.secondaries[secondary_idx];
+        ParticleTrackView particle(params_.particles, states_.particles, tid);
+        particle = {secondary.particle_id, secondary.energy};
+
+        // Keep the parent's geometry state
+        GeoTrackView geo(params_.geometry, states_.geometry, tid);
+        geo = {geo, secondary.direction};
+
+        // Mark the secondary as processed and the track as active
+        --inits_.secondary_counts[tid];
+        secondary             = Secondary{};
+        inits_.vacancies[tid] = flag_id();
+    }
+    else
+    {
+        // The track was killed and did not produce secondaries: store the
+        // index so it can be used later to initialize a new track
+        inits_.vacancies[tid] = tid.get();
+    }
+}
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void ProcessPrimariesLauncher<M>::operator()(ThreadId tid) const
+{
+    TrackInitializer& init = inits_.initializers[ThreadId(
+        inits_.initializers.size() - primaries_.size() + tid.get())];
+    const Primary& primary = primaries_[tid.get()];
+
+    // Construct a track initializer from a primary particle
+    init.sim.track_id         = primary.track_id;
+    init.sim.parent_id        = TrackId{};
+    init.sim.event_id         = primary.event_id;
+    init.sim.alive            = true;
+    init.geo.pos              = primary.position;
+    init.geo.dir              = primary.direction;
+    init.particle.particle_id = primary.particle_id;
+    init.particle.energy      = primary.energy;
+}
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void
+ProcessSecondariesLauncher<M>::operator()(ThreadId tid) const
+{
+    // Construct the state accessors
+    GeoTrackView geo(params_.geometry, states_.geometry, tid);
+    SimTrackView sim(states_.sim, tid);
+
+    // Offset in the vector of track initializers
+    size_type offset_id = inits_.secondary_counts[tid];
+
+    Interaction& result = states_.interactions[tid];
+    for (const auto& secondary : result.secondaries)
+    {
+        if (secondary)
+        {
+            // The secondary survived cutoffs: convert to a track
+            CELER_ASSERT(offset_id < inits_.parents.size());
+            TrackInitializer& init = inits_.initializers[ThreadId(
+                inits_.initializers.size() - inits_.parents.size()
+                + offset_id)];
+
+            // Store the thread ID of the secondary's parent
+            inits_.parents[ThreadId{offset_id++}] = tid;
+
+            // Calculate the track ID of the secondary
+            // TODO: This is nondeterministic; we need to calculate the
+            // track ID in a reproducible way.
+            CELER_ASSERT(sim.event_id() < inits_.track_counters.size());
+            TrackId::size_type track_id
+                = atomic_add(&inits_.track_counters[sim.event_id()], 1u);
+
+            // Construct a track initializer from a secondary
+            init.sim.track_id         = TrackId{track_id};
+            init.sim.parent_id        = sim.track_id();
+            init.sim.event_id         = sim.event_id();
+            init.sim.alive            = true;
+            init.geo.pos              = geo.pos();
+            init.geo.dir              = secondary.direction;
+            init.particle.particle_id = secondary.particle_id;
+            init.particle.energy      = secondary.energy;
+        }
+    }
+    // Clear the secondaries from the interaction
+    result.secondaries = {};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
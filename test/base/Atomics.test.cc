@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Atomics.test.cc
+//---------------------------------------------------------------------------//
+#include "base/Atomics.hh"
+
+#include "celeritas_config.h"
+#include "celeritas_test.hh"
+
+using celeritas::atomic_add;
+using celeritas::atomic_exchange;
+using celeritas::atomic_max;
+using celeritas::atomic_min;
+using celeritas::MemoryOrder;
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(AtomicsTest, serial)
+{
+    int value = 10;
+    EXPECT_EQ(10, atomic_add(&value, 5));
+    EXPECT_EQ(15, value);
+    EXPECT_EQ(15, atomic_min(&value, 20));
+    EXPECT_EQ(15, value);
+    EXPECT_EQ(15, atomic_min(&value, 3, MemoryOrder::relaxed));
+    EXPECT_EQ(3, value);
+    EXPECT_EQ(3, atomic_max(&value, 7, MemoryOrder::acq_rel));
+    EXPECT_EQ(7, value);
+    EXPECT_EQ(7, atomic_exchange(&value, 2, MemoryOrder::relaxed));
+    EXPECT_EQ(2, value);
+
+    double dvalue = 1.5;
+    EXPECT_DOUBLE_EQ(1.5, atomic_add(&dvalue, 0.25));
+    EXPECT_DOUBLE_EQ(1.75, dvalue);
+    EXPECT_DOUBLE_EQ(1.75, atomic_max(&dvalue, -1.0));
+    EXPECT_DOUBLE_EQ(1.75, dvalue);
+}
+
+TEST(AtomicsTest, threaded)
+{
+    const int num_iters = 10000;
+    int       counter   = 0;
+    double    accum     = 0;
+    int       lowest    = num_iters;
+    int       highest   = 0;
+
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (int i = 0; i < num_iters; ++i)
+    {
+        atomic_add(&counter, 1, MemoryOrder::relaxed);
+        atomic_add(&accum, 0.5);
+        atomic_min(&lowest, i);
+        atomic_max(&highest, i);
+    }
+
+    EXPECT_EQ(num_iters, counter);
+    EXPECT_DOUBLE_EQ(0.5 * num_iters, accum);
+    EXPECT_EQ(0, lowest);
+    EXPECT_EQ(num_iters - 1, highest);
+}
@@ -0,0 +1,153 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CollectionCache.test.cc
+//---------------------------------------------------------------------------//
+#include "base/CollectionCache.hh"
+
+#include <cstdio>
+#include <fstream>
+#include "base/CollectionBuilder.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+namespace celeritas_test
+{
+//---------------------------------------------------------------------------//
+struct MockGrid
+{
+    ItemRange<double> values;
+    int               material;
+};
+
+template<Ownership W, MemSpace M>
+struct MockCacheData
+{
+    Collection<double, W, M>   reals;
+    Collection<MockGrid, W, M> grids;
+    double                     scale{};
+
+    explicit operator bool() const { return !grids.empty() && scale > 0; }
+};
+
+template<class A>
+void serialize(A& ar, MockCacheData<Ownership::value, MemSpace::host>& data)
+{
+    ar(data.reals);
+    ar(data.grids);
+    ar(data.scale);
+}
+} // namespace celeritas_test
+
+using celeritas_test::MockCacheData;
+using celeritas_test::MockGrid;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class CollectionCacheTest : public celeritas::Test
+{
+  protected:
+    using HostValue = MockCacheData<Ownership::value, MemSpace::host>;
+
+    void SetUp() override
+    {
+        auto     reals = make_builder(&data_.reals);
+        MockGrid grid;
+        grid.values   = reals.insert_back({1.0, 2.0, 3.0});
+        grid.material = 1;
+        make_builder(&data_.grids).push_back(grid);
+        grid.values   = reals.insert_back({4.0, 5.0});
+        grid.material = 0;
+        make_builder(&data_.grids).push_back(grid);
+        data_.scale = 0.5;
+
+        // Remove any cache left over from a previous run
+        filename_ = this->make_unique_filename(".bin");
+        std::remove(filename_.c_str());
+    }
+
+    HostValue   data_;
+    std::string filename_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(CollectionCacheTest, hash)
+{
+    HashBuilder a;
+    HashBuilder b;
+    EXPECT_EQ(a.value(), b.value());
+
+    a(std::string("ab"));
+    a(std::string("c"));
+    b(std::string("a"));
+    b(std::string("bc"));
+    EXPECT_NE(a.value(), b.value());
+
+    HashBuilder c;
+    c(std::string("ab"));
+    c(std::string("c"));
+    EXPECT_EQ(a.value(), c.value());
+}
+
+TEST_F(CollectionCacheTest, round_trip)
+{
+    // Missing file
+    HostValue loaded;
+    EXPECT_FALSE(load_collection_cache(filename_, 1234, &loaded));
+    EXPECT_FALSE(loaded);
+
+    save_collection_cache(filename_, 1234, data_);
+
+    // Stale key
+    EXPECT_FALSE(load_collection_cache(filename_, 4321, &loaded));
+    EXPECT_FALSE(loaded);
+
+    // Matching key
+    ASSERT_TRUE(load_collection_cache(filename_, 1234, &loaded));
+    ASSERT_TRUE(loaded);
+    const double expected_reals[] = {1, 2, 3, 4, 5};
+    using AllReals                = AllItems<double, MemSpace::host>;
+    EXPECT_VEC_SOFT_EQ(expected_reals, loaded.reals[AllReals{}]);
+    ASSERT_EQ(2, loaded.grids.size());
+    const MockGrid& grid = loaded.grids[ItemId<MockGrid>{1}];
+    EXPECT_EQ(0, grid.material);
+    EXPECT_VEC_SOFT_EQ((std::vector<double>{4, 5}), loaded.reals[grid.values]);
+    EXPECT_SOFT_EQ(0.5, loaded.scale);
+}
+
+TEST_F(CollectionCacheTest, errors)
+{
+    HostValue loaded;
+
+    // Not a cache file
+    {
+        std::ofstream out(filename_);
+        out << "this is not a cache file\n";
+    }
+    EXPECT_THROW(load_collection_cache(filename_, 1234, &loaded),
+                 celeritas::RuntimeError);
+
+    // Truncated cache file
+    save_collection_cache(filename_, 1234, data_);
+    std::string contents;
+    {
+        std::ifstream in(filename_, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(in),
+                        std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream out(filename_, std::ios::binary);
+        out.write(contents.data(), contents.size() - 1);
+    }
+    EXPECT_THROW(load_collection_cache(filename_, 1234, &loaded),
+                 celeritas::RuntimeError);
+    EXPECT_FALSE(loaded);
+}
@@ -0,0 +1,199 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SoACollection.test.cc
+//---------------------------------------------------------------------------//
+#include "base/SoACollection.hh"
+
+#include <type_traits>
+#include "base/CollectionStateStore.hh"
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+
+using celeritas::MemSpace;
+using celeritas::Ownership;
+using celeritas::Real3;
+using celeritas::real_type;
+using celeritas::size_type;
+using celeritas::ThreadId;
+using celeritas::VectorLayout;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+// Example state group with a compile-time layout
+template<VectorLayout L, Ownership W, MemSpace M>
+struct MockStateData
+{
+    celeritas::Real3StateCollection<L, W, M> pos;
+
+    explicit CELER_FUNCTION operator bool() const { return !pos.empty(); }
+    CELER_FUNCTION size_type size() const { return pos.size(); }
+
+    template<Ownership W2, MemSpace M2>
+    MockStateData& operator=(MockStateData<L, W2, M2>& other)
+    {
+        pos = other.pos;
+        return *this;
+    }
+};
+
+template<VectorLayout L, MemSpace M>
+void resize(MockStateData<L, Ownership::value, M>* data, size_type size)
+{
+    resize(&data->pos, size);
+}
+
+//! Bind the layout for use with CollectionStateStore
+template<VectorLayout L>
+struct MockStates
+{
+    template<Ownership W, MemSpace M>
+    using Data = MockStateData<L, W, M>;
+};
+
+//! Advance all positions along z (same code for either layout)
+template<class C>
+void push_z(C& pos, real_type dist)
+{
+    for (auto tid : celeritas::range(ThreadId{pos.size()}))
+    {
+        Real3 p  = pos[tid];
+        p[2]     = p[2] + dist;
+        pos[tid] = p;
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST(SoACollectionTest, types)
+{
+    using SoAValue = celeritas::
+        StateSoACollection<real_type, 3, Ownership::value, MemSpace::host>;
+    using SoARef = celeritas::
+        StateSoACollection<real_type, 3, Ownership::reference, MemSpace::host>;
+    using SoACRef = celeritas::StateSoACollection<real_type,
+                                                  3,
+                                                  Ownership::const_reference,
+                                                  MemSpace::host>;
+
+    EXPECT_TRUE((std::is_same<Real3, SoAValue::const_reference_type>::value));
+    EXPECT_TRUE((std::is_same<Real3, SoACRef::reference_type>::value));
+    EXPECT_FALSE((std::is_same<Real3, SoARef::reference_type>::value));
+    EXPECT_TRUE((std::is_trivially_copyable<SoARef>::value));
+    EXPECT_TRUE((std::is_trivially_copyable<SoACRef>::value));
+
+    using AoS = celeritas::Real3StateCollection<VectorLayout::aos,
+                                                Ownership::value,
+                                                MemSpace::host>;
+    using SoA = celeritas::Real3StateCollection<VectorLayout::soa,
+                                                Ownership::value,
+                                                MemSpace::host>;
+    EXPECT_TRUE((std::is_same<celeritas::StateCollection<Real3,
+                                                         Ownership::value,
+                                                         MemSpace::host>,
+                              AoS>::value));
+    EXPECT_TRUE((std::is_same<SoAValue, SoA>::value));
+}
+
+TEST(SoACollectionTest, host)
+{
+    celeritas::
+        StateSoACollection<real_type, 3, Ownership::value, MemSpace::host>
+            values;
+    EXPECT_TRUE(values.empty());
+    resize(&values, 4);
+    EXPECT_FALSE(values.empty());
+    EXPECT_EQ(4, values.size());
+
+    // Assign through proxy references
+    for (auto tid : celeritas::range(ThreadId{4}))
+    {
+        real_type i = tid.get();
+        values[tid] = {i, 10 + i, 100 + i};
+    }
+    values[ThreadId{3}][1] = -1;
+    values[ThreadId{2}]    = values[ThreadId{0}];
+
+    // Read back as values
+    const auto& cvalues = values;
+    Real3       actual  = cvalues[ThreadId{1}];
+    EXPECT_VEC_SOFT_EQ((Real3{1, 11, 101}), actual);
+    actual = values[ThreadId{2}];
+    EXPECT_VEC_SOFT_EQ((Real3{0, 10, 100}), actual);
+
+    // Components are contiguous
+    const real_type expected_y[] = {10, 11, 10, -1};
+    EXPECT_VEC_SOFT_EQ(expected_y, values.component(1));
+
+    // Mutable reference shares data
+    celeritas::
+        StateSoACollection<real_type, 3, Ownership::reference, MemSpace::host>
+            ref;
+    ref = values;
+    EXPECT_EQ(4, ref.size());
+    for (real_type& z : ref.component(2))
+    {
+        z *= 2;
+    }
+    EXPECT_SOFT_EQ(206, cvalues[ThreadId{3}][2]);
+
+    // Const reference
+    celeritas::StateSoACollection<real_type,
+                                  3,
+                                  Ownership::const_reference,
+                                  MemSpace::host>
+        cref;
+    cref = values;
+    EXPECT_SOFT_EQ(202, cref[ThreadId{1}][2]);
+
+#if CELERITAS_DEBUG
+    EXPECT_THROW(values[ThreadId{4}], celeritas::DebugError);
+    EXPECT_THROW(values.component(3), celeritas::DebugError);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+// LAYOUT-GENERIC STATES
+//---------------------------------------------------------------------------//
+
+template<class T>
+class SoACollectionLayoutTest : public celeritas::Test
+{
+};
+
+template<VectorLayout L>
+using LayoutConstant = std::integral_constant<VectorLayout, L>;
+using Layouts        = ::testing::Types<LayoutConstant<VectorLayout::aos>,
+                                 LayoutConstant<VectorLayout::soa>>;
+TYPED_TEST_SUITE(SoACollectionLayoutTest, Layouts, );
+
+TYPED_TEST(SoACollectionLayoutTest, state_store)
+{
+    using StateStore = celeritas::CollectionStateStore<
+        MockStates<TypeParam::value>::template Data,
+        MemSpace::host>;
+
+    StateStore states(3);
+    EXPECT_EQ(3, states.size());
+
+    auto& pos = states.ref().pos;
+    for (auto tid : celeritas::range(ThreadId{3}))
+    {
+        pos[tid] = {1, 2, real_type(tid.get())};
+    }
+    push_z(pos, 0.5);
+
+    for (auto tid : celeritas::range(ThreadId{3}))
+    {
+        Real3 actual = pos[tid];
+        EXPECT_VEC_SOFT_EQ((Real3{1, 2, tid.get() + 0.5}), actual);
+    }
+}
@@ -8,6 +8,7 @@
 #include "base/StackAllocator.hh"
 
 #include <cstdint>
+#include <vector>
 #include "base/CollectionStateStore.hh"
 #include "celeritas_test.hh"
 #include "StackAllocator.test.hh"
@@ -81,6 +82,175 @@ TEST_F(StackAllocatorTest, host)
 
 //---------------------------------------------------------------------------//
 
+TEST_F(StackAllocatorTest, host_chunked)
+{
+    using StateStore
+        = celeritas::CollectionStateStore<MockAllocatorData,
+                                          celeritas::MemSpace::host>;
+    StateStore data(16);
+    Allocator  alloc(data.ref(), 4);
+    EXPECT_EQ(16, alloc.capacity());
+
+    // First allocation reserves a full chunk
+    MockSecondary* first = alloc(1);
+    ASSERT_NE(nullptr, first);
+    EXPECT_EQ(4, alloc.get().size());
+    first->mock_id = 1;
+
+    // Reserved slots are default-initialized
+    EXPECT_EQ(-1, first[3].mock_id);
+
+    // Subsequent allocations come from the same chunk
+    MockSecondary* second = alloc(2);
+    ASSERT_NE(nullptr, second);
+    EXPECT_EQ(first + 1, second);
+    EXPECT_EQ(4, alloc.get().size());
+
+    // Doesn't fit in the remaining chunk: allocate directly from the stack
+    MockSecondary* third = alloc(2);
+    ASSERT_NE(nullptr, third);
+    EXPECT_EQ(first + 4, third);
+    EXPECT_EQ(6, alloc.get().size());
+
+    // Larger than a chunk
+    MockSecondary* fourth = alloc(7);
+    ASSERT_NE(nullptr, fourth);
+    EXPECT_EQ(first + 6, fourth);
+    EXPECT_EQ(13, alloc.get().size());
+
+    // The rest of the first chunk is still used
+    EXPECT_EQ(first + 3, alloc(1));
+    EXPECT_EQ(13, alloc.get().size());
+
+    // Not enough room for a full chunk, but enough for the allocation
+    MockSecondary* fifth = alloc(2);
+    ASSERT_NE(nullptr, fifth);
+    EXPECT_EQ(first + 13, fifth);
+    EXPECT_EQ(15, alloc.get().size());
+    EXPECT_EQ(first + 15, alloc(1));
+    EXPECT_EQ(nullptr, alloc(1));
+    EXPECT_EQ(16, alloc.get().size());
+    EXPECT_EQ(1, alloc.get()[0].mock_id);
+
+    // Clearing also resets the local chunk
+    alloc.clear();
+    EXPECT_EQ(0, alloc.get().size());
+    EXPECT_EQ(first, alloc(1));
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(StackAllocatorTest, host_threaded)
+{
+    using StateStore
+        = celeritas::CollectionStateStore<MockAllocatorData,
+                                          celeritas::MemSpace::host>;
+    const int num_items = 1000;
+    StateStore data(4 * num_items);
+
+    int num_failures = 0;
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel reduction(+ : num_failures)
+#endif
+    {
+        Allocator alloc(data.ref(), 16);
+#if CELERITAS_USE_OPENMP
+#    pragma omp for
+#endif
+        for (int i = 0; i < num_items; ++i)
+        {
+            MockSecondary* ptr = alloc(1);
+            if (!ptr)
+            {
+                ++num_failures;
+                continue;
+            }
+            ptr->mock_id = i;
+        }
+    }
+    EXPECT_EQ(0, num_failures);
+
+    // Every item was written exactly once
+    std::vector<int> counts(num_items);
+    for (const MockSecondary& s : Allocator(data.ref()).get())
+    {
+        if (s.mock_id >= 0)
+        {
+            ++counts[s.mock_id];
+        }
+    }
+    EXPECT_EQ(std::vector<int>(num_items, 1), counts);
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(StackAllocatorTest, host_threaded_overflow)
+{
+    using StateStore
+        = celeritas::CollectionStateStore<MockAllocatorData,
+                                          celeritas::MemSpace::host>;
+    const int capacity  = 500;
+    const int num_items = 1000;
+    StateStore data(capacity);
+
+    // Request more than the capacity from many threads, with and without
+    // chunking, so that several threads fail concurrently
+    for (celeritas::size_type chunk_size : {0, 4})
+    {
+        Allocator(data.ref()).clear();
+        std::vector<int> alloc_sizes(num_items);
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel num_threads(8)
+#endif
+        {
+            Allocator alloc = chunk_size > 0
+                                  ? Allocator(data.ref(), chunk_size)
+                                  : Allocator(data.ref());
+#if CELERITAS_USE_OPENMP
+#    pragma omp for schedule(dynamic)
+#endif
+            for (int i = 0; i < num_items; ++i)
+            {
+                int            count = 1 + i % 5;
+                MockSecondary* ptr   = alloc(count);
+                if (!ptr)
+                {
+                    continue;
+                }
+                alloc_sizes[i] = count;
+                for (int j = 0; j < count; ++j)
+                {
+                    ptr[j].mock_id = i;
+                }
+            }
+        }
+
+        // The final size never exceeds the capacity, and every successful
+        // allocation lies within it without overlapping another
+        Allocator alloc(data.ref());
+        ASSERT_LE(alloc.size(), capacity);
+        std::vector<int> counts(num_items);
+        for (const MockSecondary& s : alloc.get())
+        {
+            if (s.mock_id >= 0)
+            {
+                ++counts[s.mock_id];
+            }
+        }
+        EXPECT_EQ(alloc_sizes, counts) << "with chunk size " << chunk_size;
+
+        int num_allocated = 0;
+        for (int count : alloc_sizes)
+        {
+            num_allocated += count;
+        }
+        EXPECT_LE(num_allocated, alloc.size());
+        EXPECT_GT(num_allocated, capacity / 2);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
 TEST_F(StackAllocatorTest, TEST_IF_CELERITAS_CUDA(device))
 {
     using StateStore
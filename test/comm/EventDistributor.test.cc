@@ -0,0 +1,104 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EventDistributor.test.cc
+//---------------------------------------------------------------------------//
+#include "comm/EventDistributor.hh"
+
+#include <vector>
+#include "base/Span.hh"
+#include "comm/Operations.hh"
+#include "comm/ScopedMpiInit.hh"
+#include "celeritas_test.hh"
+
+using celeritas::Communicator;
+using celeritas::EventDistributor;
+using celeritas::Operation;
+using celeritas::size_type;
+
+#if CELERITAS_USE_MPI
+#    define TEST_IF_CELERITAS_MPI(name) name
+#else
+#    define TEST_IF_CELERITAS_MPI(name) DISABLED_##name
+#endif
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class EventDistributorTest : public celeritas::Test
+{
+  protected:
+    //! Count how many times each event is claimed across all processes
+    std::vector<int> claim_all(const Communicator& comm,
+                               size_type           num_events,
+                               size_type           batch_size)
+    {
+        std::vector<int> counts(num_events, 0);
+
+        EventDistributor next_batch(comm, num_events, batch_size);
+        for (auto batch = next_batch(); !batch.empty(); batch = next_batch())
+        {
+            EXPECT_LE(batch.size(), batch_size);
+            for (size_type event : batch)
+            {
+                ++counts[event];
+            }
+        }
+        // Additional requests are still empty
+        EXPECT_TRUE(next_batch().empty());
+
+        celeritas::allreduce(
+            comm, Operation::sum, celeritas::make_span(counts));
+        return counts;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(EventDistributorTest, null)
+{
+    Communicator comm;
+
+    EventDistributor next_batch(comm, 10, 4);
+    EXPECT_EQ(10, next_batch.num_events());
+    EXPECT_EQ(4, next_batch.batch_size());
+
+    auto batch = next_batch();
+    EXPECT_EQ(0, batch.front());
+    EXPECT_EQ(4, batch.size());
+    batch = next_batch();
+    EXPECT_EQ(4, batch.front());
+    EXPECT_EQ(4, batch.size());
+    batch = next_batch();
+    EXPECT_EQ(8, batch.front());
+    EXPECT_EQ(2, batch.size());
+    EXPECT_TRUE(next_batch().empty());
+
+    // No events at all
+    EventDistributor no_events(comm, 0, 4);
+    EXPECT_TRUE(no_events().empty());
+}
+
+TEST_F(EventDistributorTest, null_coverage)
+{
+    auto counts = this->claim_all(Communicator{}, 1001, 16);
+    EXPECT_VEC_EQ(std::vector<int>(1001, 1), counts);
+}
+
+TEST_F(EventDistributorTest, TEST_IF_CELERITAS_MPI(world))
+{
+    Communicator comm = Communicator::comm_world();
+
+    // Every event is claimed exactly once across all processes
+    for (size_type batch_size : {1u, 3u, 64u, 2000u})
+    {
+        auto counts = this->claim_all(comm, 1001, batch_size);
+        EXPECT_VEC_EQ(std::vector<int>(1001, 1), counts)
+            << "batch size " << batch_size;
+    }
+}
@@ -0,0 +1,195 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file DormandPrince.test.cc
+//---------------------------------------------------------------------------//
+
+#include "field/DormandPrinceStepper.hh"
+#include "field/FieldDriver.hh"
+#include "field/FieldParamsPointers.hh"
+#include "field/MagField.hh"
+#include "field/MagFieldEquation.hh"
+#include "field/RungeKuttaStepper.hh"
+
+#include "base/ArrayUtils.hh"
+#include "base/Constants.hh"
+#include "base/Range.hh"
+#include "base/Units.hh"
+
+#include "FieldTestParams.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+using namespace celeritas_test;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Count evaluations of the field equation
+class CountingEquation
+{
+  public:
+    explicit CountingEquation(const MagFieldEquation& eq) : eq_(eq) {}
+
+    OdeState operator()(const OdeState& y) const
+    {
+        ++count_;
+        return eq_(y);
+    }
+
+    int count() const { return count_; }
+
+  private:
+    const MagFieldEquation& eq_;
+    mutable int             count_ = 0;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class DormandPrinceTest : public Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Electron in a uniform field, as in the Runge-Kutta test
+        param.field_value = 1.0 * units::tesla;
+        param.radius      = 3.8085386036;
+        param.delta_z     = 6.7003310629;
+        param.momentum_y  = 10.9610028286;
+        param.momentum_z  = 3.1969591583;
+        param.nstates     = 8;
+        param.nsteps      = 100;
+        param.revolutions = 10;
+        param.epsilon     = 1.0e-5;
+    }
+
+    OdeState initial_state(unsigned int i) const
+    {
+        OdeState y;
+        y.pos = {param.radius, 0, i * 1.0e-6};
+        y.mom = {0, param.momentum_y, param.momentum_z};
+        return y;
+    }
+
+  protected:
+    FieldTestParams param;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(DormandPrinceTest, stepper)
+{
+    MagField         field({0, 0, param.field_value});
+    MagFieldEquation equation(field, units::ElementaryCharge{-1});
+    DormandPrinceStepper<MagFieldEquation> dp(equation);
+    DormandPrinceStepper<MagFieldEquation> dp_half(equation);
+
+    real_type hstep = 2 * constants::pi * param.radius / param.nsteps;
+
+    for (unsigned int i : range(param.nstates))
+    {
+        OdeState y          = this->initial_state(i);
+        OdeState expected_y = y;
+        for (int nr : range(param.revolutions))
+        {
+            expected_y.pos[2] = param.delta_z * (nr + 1) + i * 1.0e-6;
+            for (CELER_MAYBE_UNUSED int j : range(param.nsteps))
+            {
+                StepperResult result = dp(hstep, y);
+
+                // Mid-step state agrees with a half step
+                OdeState half_y = dp_half(hstep / 2, y).end_state;
+                EXPECT_VEC_NEAR(half_y.pos, result.mid_state.pos, 1e-8);
+                EXPECT_VEC_NEAR(half_y.mom, result.mid_state.mom, 1e-8);
+                EXPECT_LT(norm(result.err_state.pos), 1e-7);
+
+                y = result.end_state;
+            }
+            EXPECT_VEC_NEAR(expected_y.pos, y.pos, param.epsilon);
+
+            // Momentum error relative to its magnitude (p_x vanishes)
+            Real3 delta_mom = y.mom;
+            axpy(real_type(-1), expected_y.mom, &delta_mom);
+            EXPECT_LT(norm(delta_mom), param.epsilon * norm(expected_y.mom));
+        }
+    }
+}
+
+TEST_F(DormandPrinceTest, first_same_as_last)
+{
+    MagField         field({0, 0, param.field_value});
+    MagFieldEquation equation(field, units::ElementaryCharge{-1});
+    CountingEquation counted(equation);
+    DormandPrinceStepper<CountingEquation> dp(counted);
+
+    OdeState  y     = this->initial_state(0);
+    real_type hstep = 0.1;
+
+    // First step evaluates all stages
+    StepperResult result = dp(hstep, y);
+    EXPECT_EQ(7, counted.count());
+
+    // Continuing from the end reuses the last stage
+    y      = result.end_state;
+    result = dp(hstep, y);
+    EXPECT_EQ(13, counted.count());
+
+    // Retrying from the same start reuses the first stage
+    result = dp(hstep / 2, y);
+    EXPECT_EQ(19, counted.count());
+
+    // Starting elsewhere evaluates all stages
+    y.pos[0] += 1e-3;
+    result = dp(hstep, y);
+    EXPECT_EQ(26, counted.count());
+}
+
+TEST_F(DormandPrinceTest, driver)
+{
+    FieldParamsPointers field_params;
+    MagField            field({0, 0, param.field_value});
+    MagFieldEquation    equation(field, units::ElementaryCharge{-1});
+
+    using RKStepper = RungeKuttaStepper<CountingEquation>;
+    using DPStepper = DormandPrinceStepper<CountingEquation>;
+
+    CountingEquation       rk_counted(equation);
+    CountingEquation       dp_counted(equation);
+    RKStepper              rk4(rk_counted);
+    DPStepper              dp(dp_counted);
+    FieldDriver<RKStepper> rk_driver(field_params, rk4);
+    FieldDriver<DPStepper> dp_driver(field_params, dp);
+
+    real_type circumference = 2 * constants::pi * param.radius;
+    real_type hstep         = circumference / param.nsteps;
+    real_type delta         = field_params.errcon;
+
+    OdeState  rk_y = this->initial_state(0);
+    OdeState  dp_y = rk_y;
+    real_type total_step_length{0};
+    for (int nr : range(param.revolutions))
+    {
+        Real3 expected_pos{param.radius, 0, (nr + 1) * param.delta_z};
+        for (CELER_MAYBE_UNUSED int j : range(param.nsteps))
+        {
+            rk_driver(hstep, &rk_y);
+            total_step_length += dp_driver(hstep, &dp_y);
+        }
+        EXPECT_VEC_NEAR(expected_pos, rk_y.pos, delta);
+        EXPECT_VEC_NEAR(expected_pos, dp_y.pos, delta);
+    }
+    EXPECT_SOFT_NEAR(
+        circumference * param.revolutions, total_step_length, delta);
+
+    // The embedded pair needs fewer evaluations for the same path
+    EXPECT_LT(dp_counted.count(), rk_counted.count());
+}
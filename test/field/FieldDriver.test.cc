@@ -30,6 +30,9 @@ using namespace celeritas_test;
 
 class FieldDriverTest : public Test
 {
+  protected:
+    using Driver_t = FieldDriver<RungeKuttaStepper<MagFieldEquation>>;
+
   protected:
     void SetUp() override
     {
@@ -64,7 +67,7 @@ TEST_F(FieldDriverTest, field_driver_host)
     MagField         field({0, 0, test_params.field_value});
     MagFieldEquation equation(field, units::ElementaryCharge{-1});
     RungeKuttaStepper<MagFieldEquation> rk4(equation);
-    FieldDriver                         driver(field_params, rk4);
+    Driver_t                            driver(field_params, rk4);
 
     // Test parameters and the sub-step size
     real_type circumference = 2 * constants::pi * test_params.radius;
@@ -112,7 +115,7 @@ TEST_F(FieldDriverTest, accurate_advance_host)
     MagField         field({0, 0, test_params.field_value});
     MagFieldEquation equation(field, units::ElementaryCharge{-1});
     RungeKuttaStepper<MagFieldEquation> rk4(equation);
-    FieldDriver                         driver(field_params, rk4);
+    Driver_t                            driver(field_params, rk4);
 
     // Test parameters and the sub-step size
     real_type circumference = 2 * constants::pi * test_params.radius;
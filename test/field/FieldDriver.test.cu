@@ -26,6 +26,12 @@ using thrust::raw_pointer_cast;
 namespace celeritas_test
 {
 using namespace celeritas;
+//---------------------------------------------------------------------------//
+// TYPES
+//---------------------------------------------------------------------------//
+
+using Driver_t = FieldDriver<RungeKuttaStepper<MagFieldEquation>>;
+
 //---------------------------------------------------------------------------//
 // KERNELS
 //---------------------------------------------------------------------------//
@@ -46,7 +52,7 @@ __global__ void driver_test_kernel(const FieldParamsPointers pointers,
     MagField         field({0, 0, test_params.field_value});
     MagFieldEquation equation(field, units::ElementaryCharge{-1});
     RungeKuttaStepper<MagFieldEquation> rk4(equation);
-    FieldDriver                         driver(pointers, rk4);
+    Driver_t                            driver(pointers, rk4);
 
     // Test parameters and the sub-step size
     real_type hstep = 2 * constants::pi * test_params.radius
@@ -95,7 +101,7 @@ __global__ void accurate_advance_kernel(const FieldParamsPointers pointers,
     MagField         field({0, 0, test_params.field_value});
     MagFieldEquation equation(field, units::ElementaryCharge{-1});
     RungeKuttaStepper<MagFieldEquation> rk4(equation);
-    FieldDriver                         driver(pointers, rk4);
+    Driver_t                            driver(pointers, rk4);
 
     // Test parameters and the sub-step size
     real_type circumference = 2 * constants::pi * test_params.radius;
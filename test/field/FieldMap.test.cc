@@ -0,0 +1,219 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file FieldMap.test.cc
+//---------------------------------------------------------------------------//
+#include "field/FieldMapCalculator.hh"
+#include "field/FieldMapParams.hh"
+#include "field/FieldMapReader.hh"
+
+#include "field/FieldDriver.hh"
+#include "field/FieldParamsPointers.hh"
+#include "field/MagField.hh"
+#include "field/MagFieldEquation.hh"
+#include "field/RungeKuttaStepper.hh"
+
+#include "base/Constants.hh"
+#include "base/Range.hh"
+#include "base/Units.hh"
+
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class FieldMapTest : public celeritas::Test
+{
+  protected:
+    //! Field that varies linearly along each axis (reproduced exactly)
+    static Real3 linear_field(const Real3& pos)
+    {
+        return {0.1 * pos[0] - 0.2 * pos[2] + 1,
+                0.3 * pos[1],
+                0.01 * pos[0] + 0.02 * pos[1] + 0.03 * pos[2]};
+    }
+
+    //! Build a cartesian map tabulating a function
+    template<class F>
+    static FieldMapParams::Input make_cartesian(F field)
+    {
+        FieldMapParams::Input input;
+        input.geometry = FieldMapGeometry::cartesian;
+        input.axes[0]  = UniformGridData::from_bounds(-4, 4, 5);
+        input.axes[1]  = UniformGridData::from_bounds(0, 3, 4);
+        input.axes[2]  = UniformGridData::from_bounds(-10, 10, 3);
+        for (auto i : range(input.axes[0].size))
+        {
+            for (auto j : range(input.axes[1].size))
+            {
+                for (auto k : range(input.axes[2].size))
+                {
+                    Real3 pos{input.axes[0].front + i * input.axes[0].delta,
+                              input.axes[1].front + j * input.axes[1].delta,
+                              input.axes[2].front + k * input.axes[2].delta};
+                    input.values.push_back(field(pos));
+                }
+            }
+        }
+        return input;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(FieldMapTest, cartesian)
+{
+    FieldMapParams     params(make_cartesian(linear_field));
+    FieldMapCalculator calc_field(params.host_pointers());
+
+    // Grid points, cell interiors, and the upper map edges
+    static const Real3 points[] = {{-4, 0, -10},
+                                   {4, 3, 10},
+                                   {0.5, 1.25, 3},
+                                   {-3.9, 2.9, -9.9},
+                                   {4, 1.5, 10},
+                                   {1, 1, 1}};
+
+    FieldMapCache cache;
+    for (const Real3& pos : points)
+    {
+        EXPECT_VEC_SOFT_EQ(linear_field(pos), calc_field(pos));
+        EXPECT_VEC_SOFT_EQ(linear_field(pos), calc_field(pos, &cache));
+    }
+
+    // Positions outside the map have no field
+    for (const Real3& pos : {Real3{-4.1, 1, 0}, Real3{0, 3.1, 0}})
+    {
+        EXPECT_VEC_SOFT_EQ((Real3{0, 0, 0}), calc_field(pos, &cache));
+    }
+}
+
+TEST_F(FieldMapTest, cache)
+{
+    FieldMapParams     params(make_cartesian(linear_field));
+    FieldMapCalculator calc_field(params.host_pointers());
+
+    FieldMapCache cache;
+    EXPECT_FALSE(cache);
+    calc_field({0.5, 1.25, 3}, &cache);
+    ASSERT_TRUE(cache);
+    EXPECT_VEC_SOFT_EQ((Real3{0, 1, 0}), cache.lower);
+    EXPECT_VEC_SOFT_EQ((Real3{2, 2, 10}), cache.upper);
+    const size_type offset = cache.offset;
+
+    // Same cell: cache is unchanged and the result is still correct
+    Real3 pos{1.5, 1.75, 9};
+    EXPECT_VEC_SOFT_EQ(linear_field(pos), calc_field(pos, &cache));
+    EXPECT_EQ(offset, cache.offset);
+
+    // Neighboring cell
+    pos = {2.5, 1.75, 9};
+    EXPECT_VEC_SOFT_EQ(linear_field(pos), calc_field(pos, &cache));
+    EXPECT_NE(offset, cache.offset);
+
+    // Leaving the map keeps the last cell
+    const size_type last_offset = cache.offset;
+    calc_field({100, 0, 0}, &cache);
+    EXPECT_EQ(last_offset, cache.offset);
+
+    // Leaving the map along the last axis doesn't update the bounds of the
+    // first axes
+    pos = {-3.5, 0.5, 5};
+    EXPECT_VEC_SOFT_EQ(linear_field(pos), calc_field(pos, &cache));
+    const FieldMapCache last_cache = cache;
+    EXPECT_VEC_SOFT_EQ((Real3{0, 0, 0}), calc_field({3.5, 2.5, 50}, &cache));
+    EXPECT_EQ(last_cache.offset, cache.offset);
+    EXPECT_VEC_SOFT_EQ(last_cache.lower, cache.lower);
+    EXPECT_VEC_SOFT_EQ(last_cache.upper, cache.upper);
+    pos = {3.5, 2.5, 5};
+    EXPECT_VEC_SOFT_EQ(linear_field(pos), calc_field(pos, &cache));
+}
+
+TEST_F(FieldMapTest, cylindrical)
+{
+    FieldMapReader read_map(
+        this->test_data_path("field", "cyl-field-map.txt"));
+    FieldMapParams::Input input = read_map();
+    EXPECT_EQ(FieldMapGeometry::cylindrical, input.geometry);
+    EXPECT_FALSE(input.axes[1]);
+    EXPECT_EQ(9, input.values.size());
+
+    FieldMapParams     params(input);
+    FieldMapCalculator calc_field(params.host_pointers());
+
+    // B_r = 0.01 r, B_z = 1 + 0.01 z
+    const real_type tesla = units::tesla;
+    for (const Real3& pos : {Real3{0, 0, 0},
+                             Real3{3, 4, -2.5},
+                             Real3{-6, 0, 10},
+                             Real3{0, -7.5, 7}})
+    {
+        Real3 expected{0.01 * pos[0] * tesla,
+                       0.01 * pos[1] * tesla,
+                       (1 + 0.01 * pos[2]) * tesla};
+        EXPECT_VEC_SOFT_EQ(expected, calc_field(pos));
+    }
+
+    // Outside the radius or the length of the map
+    EXPECT_VEC_SOFT_EQ((Real3{0, 0, 0}), calc_field({8, 8, 0}));
+    EXPECT_VEC_SOFT_EQ((Real3{0, 0, 0}), calc_field({0, 0, 11}));
+}
+
+TEST_F(FieldMapTest, errors)
+{
+    // Missing file
+    EXPECT_THROW(FieldMapReader("nonexistent.txt")(), celeritas::RuntimeError);
+
+    // Cylindrical map with a middle axis
+    auto input     = make_cartesian(linear_field);
+    input.geometry = FieldMapGeometry::cylindrical;
+    EXPECT_THROW(FieldMapParams{input}, celeritas::RuntimeError);
+
+    // Inconsistent number of values
+    input.geometry = FieldMapGeometry::cartesian;
+    input.values.pop_back();
+    EXPECT_THROW(FieldMapParams{input}, celeritas::RuntimeError);
+}
+
+TEST_F(FieldMapTest, uniform_driver)
+{
+    // Electron in a 1 T field with the same parameters as FieldDriverTest
+    const real_type field_value = 1.0 * units::tesla;
+    const real_type radius      = 3.8085386036 * units::centimeter;
+    const real_type delta_z     = 6.7003310629 * units::centimeter;
+
+    // Tabulate the uniform field on a map larger than the helix
+    FieldMapParams::Input input;
+    input.geometry = FieldMapGeometry::cylindrical;
+    input.axes[0]  = UniformGridData::from_bounds(0, 10, 11);
+    input.axes[2]  = UniformGridData::from_bounds(-20, 20, 41);
+    input.values.assign(11 * 41, Real3{0, 0, field_value});
+    FieldMapParams params(input);
+
+    FieldParamsPointers field_params;
+    MagField            field(params.host_pointers());
+    MagFieldEquation    equation(field, units::ElementaryCharge{-1});
+    RungeKuttaStepper<MagFieldEquation>              rk4(equation);
+    FieldDriver<RungeKuttaStepper<MagFieldEquation>> driver(field_params, rk4);
+
+    OdeState y;
+    y.pos = {radius, 0, 0};
+    y.mom = {0, 10.9610028286, 3.1969591583};
+
+    // Travel one revolution
+    real_type circumference = 2 * constants::pi * radius;
+    real_type total_step    = 0;
+    for (CELER_MAYBE_UNUSED int j : range(100))
+    {
+        total_step += driver(circumference / 100, &y);
+    }
+    EXPECT_SOFT_NEAR(circumference, total_step, field_params.errcon);
+    EXPECT_VEC_NEAR((Real3{radius, 0, delta_z}), y.pos, field_params.errcon);
+}
@@ -27,6 +27,8 @@ class FieldPropagatorHostTest : public FieldTestBase
 {
   public:
     using Initializer_t = ParticleTrackView::Initializer_t;
+    using Driver_t      = FieldDriver<RungeKuttaStepper<MagFieldEquation>>;
+    using Propagator_t  = FieldPropagator<Driver_t>;
 };
 
 TEST_F(FieldPropagatorHostTest, field_propagator_host)
@@ -41,7 +43,7 @@ TEST_F(FieldPropagatorHostTest, field_propagator_host)
     MagField         field({0, 0, test.field_value});
     MagFieldEquation equation(field, units::ElementaryCharge{-1});
     RungeKuttaStepper<MagFieldEquation> rk4(equation);
-    FieldDriver                         driver(field_params, rk4);
+    Driver_t                            driver(field_params, rk4);
 
     // Test parameters and the sub-step size
     double step = (2.0 * constants::pi * test.radius) / test.nsteps;
@@ -63,10 +65,10 @@ TEST_F(FieldPropagatorHostTest, field_propagator_host)
         EXPECT_SOFT_EQ(5.5, geo_track.next_step());
 
         // Construct FieldPropagator
-        FieldPropagator propagator(&geo_track, particle_track, driver);
+        Propagator_t propagator(&geo_track, particle_track, driver);
 
         real_type                    total_length = 0;
-        FieldPropagator::result_type result;
+        Propagator_t::result_type result;
 
         for (CELER_MAYBE_UNUSED int ir : celeritas::range(test.revolutions))
         {
@@ -84,6 +86,10 @@ TEST_F(FieldPropagatorHostTest, field_propagator_host)
         normalize_direction(&final_dir);
         EXPECT_VEC_NEAR(final_dir, geo_track.dir(), test.epsilon);
         EXPECT_SOFT_NEAR(total_length, expected_total_length, test.epsilon);
+
+        // Most chords lie inside a previously computed safety sphere
+        const auto& counters = propagator.counters();
+        EXPECT_GT(counters.avoided, counters.safety);
     }
 }
 
@@ -99,7 +105,7 @@ TEST_F(FieldPropagatorHostTest, boundary_crossing_host)
     MagField         field({0, 0, test.field_value});
     MagFieldEquation equation(field, units::ElementaryCharge{-1});
     RungeKuttaStepper<MagFieldEquation> rk4(equation);
-    FieldDriver                         driver(field_params, rk4);
+    Driver_t                            driver(field_params, rk4);
 
     const int num_boundary = 16;
 
@@ -122,11 +128,11 @@ TEST_F(FieldPropagatorHostTest, boundary_crossing_host)
         EXPECT_SOFT_EQ(0.5, geo_track.next_step());
 
         // Construct FieldPropagator
-        FieldPropagator propagator(&geo_track, particle_track, driver);
+        Propagator_t propagator(&geo_track, particle_track, driver);
 
         int                          icross       = 0;
         real_type                    total_length = 0;
-        FieldPropagator::result_type result;
+        Propagator_t::result_type result;
 
         for (CELER_MAYBE_UNUSED int ir : celeritas::range(test.revolutions))
         {
@@ -151,6 +157,65 @@ TEST_F(FieldPropagatorHostTest, boundary_crossing_host)
     }
 }
 
+TEST_F(FieldPropagatorHostTest, safety_sphere_host)
+{
+    GeoTrackView geo_track = GeoTrackView(
+        this->geo_params->host_pointers(), geo_state.ref(), ThreadId(0));
+    ParticleTrackView particle_track(
+        particle_params->host_pointers(), state_ref, ThreadId(0));
+
+    MagField         field({0, 0, test.field_value});
+    MagFieldEquation equation(field, units::ElementaryCharge{-1});
+    RungeKuttaStepper<MagFieldEquation> rk4(equation);
+
+    double step = (2.0 * constants::pi * test.radius) / test.nsteps;
+
+    // Crossing distances and positions, and safety queries, with and without
+    // reusing the safety sphere
+    std::vector<real_type> distances[2];
+    std::vector<real_type> positions[2];
+    size_type              num_safety[2] = {0, 0};
+    for (bool reuse_safety : {false, true})
+    {
+        FieldParamsPointers params = field_params;
+        params.reuse_safety        = reuse_safety;
+        Driver_t driver(params, rk4);
+
+        geo_track      = {{test.radius, 0, 0}, {0, 1, 0}};
+        particle_track = Initializer_t{ParticleId{0}, MevEnergy{test.energy}};
+        Propagator_t propagator(&geo_track, particle_track, driver);
+
+        real_type total_length = 0;
+        for (CELER_MAYBE_UNUSED int ir : celeritas::range(test.revolutions))
+        {
+            for (CELER_MAYBE_UNUSED auto k : celeritas::range(test.nsteps))
+            {
+                auto result = propagator(step);
+                total_length += result.distance;
+                if (result.on_boundary)
+                {
+                    distances[reuse_safety].push_back(total_length);
+                    positions[reuse_safety].insert(
+                        positions[reuse_safety].end(),
+                        geo_track.pos().begin(),
+                        geo_track.pos().end());
+                }
+            }
+        }
+        if (!reuse_safety)
+        {
+            EXPECT_EQ(0, propagator.counters().avoided);
+        }
+        num_safety[reuse_safety] = propagator.counters().safety;
+    }
+
+    // Skipping queries inside the safety sphere doesn't change the result
+    EXPECT_FALSE(distances[false].empty());
+    EXPECT_VEC_SOFT_EQ(distances[false], distances[true]);
+    EXPECT_VEC_SOFT_EQ(positions[false], positions[true]);
+    EXPECT_LT(num_safety[true], num_safety[false]);
+}
+
 #if CELERITAS_USE_CUDA
 //---------------------------------------------------------------------------//
 // DEVICE TESTS
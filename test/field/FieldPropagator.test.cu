@@ -25,6 +25,13 @@ using thrust::raw_pointer_cast;
 
 namespace celeritas_test
 {
+//---------------------------------------------------------------------------//
+// TYPES
+//---------------------------------------------------------------------------//
+
+using Driver_t     = FieldDriver<RungeKuttaStepper<MagFieldEquation>>;
+using Propagator_t = FieldPropagator<Driver_t>;
+
 //---------------------------------------------------------------------------//
 // KERNELS
 //---------------------------------------------------------------------------//
@@ -60,15 +67,15 @@ __global__ void fp_test_kernel(const int                 size,
     MagFieldEquation equation(field, units::ElementaryCharge{-1});
     RungeKuttaStepper<MagFieldEquation> rk4(equation);
 
-    FieldDriver     driver(field_params, rk4);
-    FieldPropagator propagator(&geo_track, particle_track, driver);
+    Driver_t     driver(field_params, rk4);
+    Propagator_t propagator(&geo_track, particle_track, driver);
 
     // Tests with input parameters of a electron in a uniform magnetic field
     double hstep = (2.0 * constants::pi * test.radius) / test.nsteps;
 
     real_type curved_length = 0;
 
-    FieldPropagator::result_type result;
+    Propagator_t::result_type result;
 
     for (CELER_MAYBE_UNUSED int i : celeritas::range(test.revolutions))
     {
@@ -116,8 +123,8 @@ __global__ void bc_test_kernel(const int                 size,
     MagFieldEquation equation(field, units::ElementaryCharge{-1});
     RungeKuttaStepper<MagFieldEquation> rk4(equation);
 
-    FieldDriver     driver(field_params, rk4);
-    FieldPropagator propagator(&geo_track, particle_track, driver);
+    Driver_t     driver(field_params, rk4);
+    Propagator_t propagator(&geo_track, particle_track, driver);
 
     // Tests with input parameters of a electron in a uniform magnetic field
     double hstep = (2.0 * constants::pi * test.radius) / test.nsteps;
@@ -135,7 +142,7 @@ __global__ void bc_test_kernel(const int                 size,
 
     real_type delta = celeritas::numeric_limits<real_type>::max();
 
-    FieldPropagator::result_type result;
+    Propagator_t::result_type result;
 
     for (CELER_MAYBE_UNUSED int ir : celeritas::range(test.revolutions))
     {
@@ -137,6 +137,26 @@ TEST_F(GeoTrackViewHostTest, inside)
     EXPECT_FALSE(geo.is_outside());
 }
 
+TEST_F(GeoTrackViewHostTest, safety_sphere)
+{
+    GeoTrackView geo = this->make_geo_track_view();
+    geo              = {{-10, 10, 10}, {0, -1, 0}};
+    EXPECT_EQ(0, geo.safety_radius());
+
+    // Moving within the volume keeps the sphere
+    geo.set_safety(geo.pos(), 1.0);
+    geo.move_by(0.5);
+    EXPECT_SOFT_EQ(1.0, geo.safety_radius());
+
+    // Crossing into the next volume clears it
+    geo.move_next_step();
+    EXPECT_EQ(0, geo.safety_radius());
+
+    geo.set_safety(geo.pos(), 0.5);
+    geo.move_to_boundary();
+    EXPECT_EQ(0, geo.safety_radius());
+}
+
 //---------------------------------------------------------------------------//
 
 #define GEO_DEVICE_TEST TEST_IF_CELERITAS_CUDA(GeoTrackViewDeviceTest)
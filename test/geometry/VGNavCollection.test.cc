@@ -0,0 +1,86 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file VGNavCollection.test.cc
+//---------------------------------------------------------------------------//
+#include "geometry/detail/VGNavCollection.hh"
+
+#include "base/CollectionStateStore.hh"
+#include "base/Range.hh"
+#include "geometry/GeoParams.hh"
+#include "geometry/GeoTrackView.hh"
+#include "celeritas_test.hh"
+
+#include "GeoTestBase.hh"
+
+using namespace celeritas;
+using namespace celeritas_test;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class VGNavCollectionTest : public GeoTestBase
+{
+  public:
+    using StateStore = CollectionStateStore<GeoStateData, MemSpace::host>;
+
+    std::string filename() const override { return "fourLevels.gdml"; }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(VGNavCollectionTest, multiple_tracks)
+{
+    const std::vector<GeoTrackInitializer> init
+        = {{{10, 10, 10}, {1, 0, 0}},
+           {{10, 10, -10}, {1, 0, 0}},
+           {{10, -10, 10}, {1, 0, 0}},
+           {{10, -10, -10}, {1, 0, 0}},
+           {{-10, 10, 10}, {-1, 0, 0}},
+           {{-10, 10, -10}, {-1, 0, 0}},
+           {{-10, -10, 10}, {-1, 0, 0}},
+           {{-10, -10, -10}, {-1, 0, 0}}};
+    const int max_segments = 3;
+
+    StateStore states(*this->geo_params(), init.size());
+    auto       make_geo = [&](size_type i) {
+        return GeoTrackView(
+            this->geo_params()->host_pointers(), states.ref(), ThreadId(i));
+    };
+    for (auto i : range(init.size()))
+    {
+        GeoTrackView geo = make_geo(i);
+        geo              = init[i];
+    }
+
+    // Advance all tracks together so that any shared state would be clobbered
+    std::vector<int>    ids(init.size() * max_segments);
+    std::vector<double> distances(ids.size());
+    for (int seg = 0; seg < max_segments; ++seg)
+    {
+        for (auto i : range(init.size()))
+        {
+            GeoTrackView geo = make_geo(i);
+            ASSERT_FALSE(geo.is_outside());
+            distances[i * max_segments + seg] = geo.move_next_step();
+            ids[i * max_segments + seg]       = geo.volume_id().get();
+        }
+    }
+
+    // clang-format off
+    static const int expected_ids[] = {
+        1, 2, 3, 1, 2, 3, 1, 2, 3, 1, 2, 3,
+        1, 2, 3, 1, 2, 3, 1, 2, 3, 1, 2, 3};
+
+    static const double expected_distances[]
+        = {5, 1, 1, 5, 1, 1, 5, 1, 1, 5, 1, 1,
+           5, 1, 1, 5, 1, 1, 5, 1, 1, 5, 1, 1};
+    // clang-format on
+    EXPECT_VEC_EQ(expected_ids, ids);
+    EXPECT_VEC_SOFT_EQ(expected_distances, distances);
+}
@@ -0,0 +1,223 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BinaryImporter.test.cc
+//---------------------------------------------------------------------------//
+#include "io/BinaryImporter.hh"
+
+#include <fstream>
+#include <string>
+#include "io/BinaryExporter.hh"
+#include "physics/base/ImportedProcessAdapter.hh"
+
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class BinaryImporterTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ImportParticle gamma;
+        gamma.name      = "gamma";
+        gamma.pdg       = 22;
+        gamma.mass      = 0;
+        gamma.charge    = 0;
+        gamma.spin      = 1;
+        gamma.lifetime  = -1;
+        gamma.is_stable = true;
+        data_.particles.push_back(gamma);
+
+        ImportElement fe;
+        fe.name                  = "Fe";
+        fe.atomic_number         = 26;
+        fe.atomic_mass           = 55.845;
+        fe.radiation_length_tsai = 13.84;
+        fe.coulomb_factor        = 0.0377;
+        data_.elements.push_back(fe);
+
+        ImportMaterial steel;
+        steel.name               = "G4_STAINLESS-STEEL";
+        steel.state              = ImportMaterialState::solid;
+        steel.temperature        = 293.15;
+        steel.density            = 8;
+        steel.electron_density   = 2.2e24;
+        steel.number_density     = 8.7e22;
+        steel.radiation_length   = 1.74;
+        steel.nuclear_int_length = 16.6;
+        steel.pdg_cutoffs[22]    = {0.0209, 0.07};
+        steel.pdg_cutoffs[11]    = {0.9254, 0.07};
+        steel.elements.push_back({0, 1.0, 1.0});
+        data_.materials.push_back(steel);
+
+        ImportProcess compton;
+        compton.particle_pdg  = 22;
+        compton.process_type  = ImportProcessType::electromagnetic;
+        compton.process_class = ImportProcessClass::compton;
+        compton.models.push_back(ImportModelClass::klein_nishina);
+        ImportPhysicsTable lambda;
+        lambda.table_type = ImportTableType::lambda;
+        lambda.x_units    = ImportUnits::mev;
+        lambda.y_units    = ImportUnits::cm_inv;
+        lambda.physics_vectors.push_back(
+            {ImportPhysicsVectorType::log, {1e-4, 1e-2, 1}, {0.1, 0.2, 0.3}});
+        compton.tables.push_back(lambda);
+        data_.processes.push_back(compton);
+
+        ImportVolume slab;
+        slab.material_id = 0;
+        slab.name        = "slab";
+        slab.solid_name  = "box";
+        data_.volumes.push_back(slab);
+
+        filename_ = this->make_unique_filename(".bin");
+        BinaryExporter write(filename_);
+        write(data_);
+    }
+
+    std::string filename_;
+    ImportData  data_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(BinaryImporterTest, round_trip)
+{
+    BinaryImporter   import(filename_.c_str());
+    const ImportData data = import();
+    ASSERT_TRUE(data);
+
+    ASSERT_EQ(1, data.particles.size());
+    EXPECT_EQ("gamma", data.particles[0].name);
+    EXPECT_EQ(22, data.particles[0].pdg);
+    EXPECT_EQ(-1, data.particles[0].lifetime);
+    EXPECT_TRUE(data.particles[0].is_stable);
+
+    ASSERT_EQ(1, data.elements.size());
+    EXPECT_EQ("Fe", data.elements[0].name);
+    EXPECT_EQ(26, data.elements[0].atomic_number);
+    EXPECT_DOUBLE_EQ(55.845, data.elements[0].atomic_mass);
+
+    ASSERT_EQ(1, data.materials.size());
+    const ImportMaterial& mat = data.materials[0];
+    EXPECT_EQ("G4_STAINLESS-STEEL", mat.name);
+    EXPECT_EQ(ImportMaterialState::solid, mat.state);
+    EXPECT_DOUBLE_EQ(2.2e24, mat.electron_density);
+    ASSERT_EQ(2, mat.pdg_cutoffs.size());
+    EXPECT_DOUBLE_EQ(0.9254, mat.pdg_cutoffs.at(11).energy);
+    EXPECT_DOUBLE_EQ(0.07, mat.pdg_cutoffs.at(22).range);
+    ASSERT_EQ(1, mat.elements.size());
+    EXPECT_EQ(0, mat.elements[0].element_id);
+
+    ASSERT_EQ(1, data.processes.size());
+    const ImportProcess& proc = data.processes[0];
+    EXPECT_EQ(ImportProcessClass::compton, proc.process_class);
+    ASSERT_EQ(1, proc.models.size());
+    EXPECT_EQ(ImportModelClass::klein_nishina, proc.models[0]);
+    ASSERT_EQ(1, proc.tables.size());
+    EXPECT_EQ(ImportTableType::lambda, proc.tables[0].table_type);
+    EXPECT_EQ(ImportUnits::cm_inv, proc.tables[0].y_units);
+    ASSERT_EQ(1, proc.tables[0].physics_vectors.size());
+    const ImportPhysicsVector& vec = proc.tables[0].physics_vectors[0];
+    EXPECT_EQ(ImportPhysicsVectorType::log, vec.vector_type);
+    EXPECT_VEC_SOFT_EQ(data_.processes[0].tables[0].physics_vectors[0].x,
+                       vec.x);
+    EXPECT_VEC_SOFT_EQ(data_.processes[0].tables[0].physics_vectors[0].y,
+                       vec.y);
+
+    ASSERT_EQ(1, data.volumes.size());
+    EXPECT_EQ("slab", data.volumes[0].name);
+    EXPECT_EQ("box", data.volumes[0].solid_name);
+}
+
+TEST_F(BinaryImporterTest, views)
+{
+    BinaryImporter import(filename_.c_str());
+
+    // Metadata has no physics vectors
+    ASSERT_EQ(1, import.metadata().processes.size());
+    EXPECT_TRUE(
+        import.metadata().processes[0].tables[0].physics_vectors.empty());
+
+    const ImportPhysicsVectorView& vec = import.physics_vector(0, 0, 0);
+    EXPECT_EQ(ImportPhysicsVectorType::log, vec.vector_type);
+    const double expected_x[] = {1e-4, 1e-2, 1};
+    const double expected_y[] = {0.1, 0.2, 0.3};
+    EXPECT_VEC_SOFT_EQ(expected_x, vec.x);
+    EXPECT_VEC_SOFT_EQ(expected_y, vec.y);
+}
+
+TEST_F(BinaryImporterTest, imported_processes)
+{
+    auto import = std::make_shared<BinaryImporter>(filename_.c_str());
+    ImportedProcesses from_binary(import);
+    ImportedProcesses from_data(std::move(data_.processes));
+    ASSERT_EQ(1, from_binary.size());
+
+    // Binary-backed vectors point directly into the mapped file
+    const ImportedProcesses::ImportProcessId compton{0};
+    auto actual   = from_binary.physics_vector(compton, 0, 0);
+    auto expected = from_data.physics_vector(compton, 0, 0);
+    EXPECT_EQ(import->physics_vector(0, 0, 0).x.data(), actual.x.data());
+    EXPECT_EQ(expected.vector_type, actual.vector_type);
+    EXPECT_VEC_EQ(expected.x, actual.x);
+    EXPECT_VEC_EQ(expected.y, actual.y);
+}
+
+TEST(IsRootFilenameTest, all)
+{
+    EXPECT_TRUE(is_root_filename("geant-exporter-data.root"));
+    EXPECT_TRUE(is_root_filename(".root"));
+    EXPECT_FALSE(is_root_filename("data.bin"));
+    EXPECT_FALSE(is_root_filename("root"));
+    EXPECT_FALSE(is_root_filename("data.root.bin"));
+}
+
+TEST_F(BinaryImporterTest, errors)
+{
+    // Missing file
+    EXPECT_THROW(BinaryImporter("nonexistent.bin"), celeritas::RuntimeError);
+
+    // Not a binary import file
+    std::string text_filename = this->make_unique_filename(".txt");
+    {
+        std::ofstream out(text_filename);
+        out << "this is not the file you're looking for\n";
+    }
+    EXPECT_THROW(BinaryImporter(text_filename.c_str()),
+                 celeritas::RuntimeError);
+
+    // Truncated file
+    std::string truncated_filename = this->make_unique_filename(".bin");
+    {
+        std::ifstream in(filename_, std::ios::binary);
+        std::string   contents((std::istreambuf_iterator<char>(in)),
+                             std::istreambuf_iterator<char>());
+        std::ofstream out(truncated_filename, std::ios::binary);
+        out.write(contents.data(), contents.size() - 8);
+    }
+    EXPECT_THROW(BinaryImporter(truncated_filename.c_str()),
+                 celeritas::RuntimeError);
+
+    // Files that fail validation must not stay mapped
+    std::ifstream maps("/proc/self/maps");
+    if (maps)
+    {
+        std::string line;
+        while (std::getline(maps, line))
+        {
+            EXPECT_EQ(std::string::npos, line.find(text_filename)) << line;
+            EXPECT_EQ(std::string::npos, line.find(truncated_filename))
+                << line;
+        }
+    }
+}
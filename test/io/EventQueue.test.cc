@@ -0,0 +1,131 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EventQueue.test.cc
+//---------------------------------------------------------------------------//
+#include "io/EventQueue.hh"
+
+#include <atomic>
+#include <stdexcept>
+#include "base/Range.hh"
+
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+using VecPrimary = EventQueue::VecPrimary;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class EventQueueTest : public celeritas::Test
+{
+  protected:
+    //! Number of primaries in the given event
+    static size_type event_size(size_type event) { return 1 + event % 5; }
+
+    //! Create a mock reader that counts the number of events read
+    EventQueue::ReadEvent make_reader(size_type num_events)
+    {
+        return [this, num_events](VecPrimary* primaries) {
+            size_type event = num_reads_++;
+            if (event >= num_events)
+                return false;
+
+            primaries->resize(event_size(event));
+            for (auto i : range(primaries->size()))
+            {
+                Primary& p = (*primaries)[i];
+                p.event_id = EventId{event};
+                p.track_id = TrackId{i};
+            }
+            return true;
+        };
+    }
+
+    std::atomic<size_type> num_reads_{0};
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(EventQueueTest, all_events)
+{
+    const size_type num_events = 100;
+    EventQueue      queue(this->make_reader(num_events), 4);
+    EXPECT_EQ(4, queue.capacity());
+
+    size_type next_event = 0;
+    size_type next_track = 0;
+    size_type num_pops   = 0;
+    while (!queue.done())
+    {
+        VecPrimary primaries = queue.pop(8);
+        ASSERT_FALSE(primaries.empty());
+        EXPECT_LE(primaries.size(), 8);
+        ++num_pops;
+
+        // Primaries are popped in whole events and in order
+        for (const Primary& p : primaries)
+        {
+            if (p.event_id.get() != next_event)
+            {
+                EXPECT_EQ(event_size(next_event), next_track);
+                ++next_event;
+                next_track = 0;
+            }
+            EXPECT_EQ(next_event, p.event_id.get());
+            EXPECT_EQ(next_track, p.track_id.get());
+            ++next_track;
+        }
+        EXPECT_EQ(event_size(next_event), next_track);
+        ++next_event;
+        next_track = 0;
+    }
+    EXPECT_EQ(num_events, next_event);
+    EXPECT_GT(num_pops, num_events * 3 / 8);
+    EXPECT_TRUE(queue.pop(8).empty());
+}
+
+TEST_F(EventQueueTest, bounded)
+{
+    {
+        // Never pop: the reader should stop once the queue is full
+        EventQueue queue(this->make_reader(1000), 3);
+    }
+    // At most one event past capacity can be read before the reader blocks
+    EXPECT_LE(num_reads_, 4);
+}
+
+TEST_F(EventQueueTest, too_many_primaries)
+{
+    EventQueue queue(this->make_reader(10), 2);
+    EXPECT_EQ(1, queue.pop(1).size());
+    EXPECT_THROW(queue.pop(1), celeritas::RuntimeError);
+    EXPECT_EQ(2, queue.pop(2).size());
+}
+
+TEST_F(EventQueueTest, read_error)
+{
+    auto       read = this->make_reader(10);
+    EventQueue queue(
+        [&read](VecPrimary* primaries) {
+            if (!read(primaries))
+                return false;
+            if (primaries->front().event_id.get() == 2)
+                throw std::runtime_error("bad event");
+            return true;
+        },
+        4);
+
+    // The failure is propagated after the preceding events are popped
+    size_type num_primaries = 0;
+    EXPECT_THROW(
+        while (!queue.done()) { num_primaries += queue.pop(100).size(); },
+        std::runtime_error);
+    EXPECT_EQ(1 + 2, num_primaries);
+    EXPECT_THROW(queue.pop(100), std::runtime_error);
+}
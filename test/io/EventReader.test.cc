@@ -113,6 +113,33 @@ TEST_P(EventReaderTest, read_all_formats)
     }
 }
 
+TEST_P(EventReaderTest, read_incremental)
+{
+    filename_ = this->test_data_path("io", GetParam());
+
+    {
+        // Event is too large for the requested number of primaries
+        EventReader read_event(filename_.c_str(), particle_params_);
+        EXPECT_THROW(read_event.read_primaries(4), celeritas::RuntimeError);
+
+        // The event is kept and returned by the next read
+        auto primaries = read_event.read_primaries(10);
+        EXPECT_EQ(8, primaries.size());
+        EXPECT_TRUE(read_event.done());
+        EXPECT_TRUE(read_event.read_primaries(10).empty());
+    }
+    {
+        EventReader read_event(filename_.c_str(), particle_params_);
+        EXPECT_FALSE(read_event.done());
+        auto primaries = read_event.read_events(1);
+        EXPECT_EQ(8, primaries.size());
+        EXPECT_EQ(0, primaries.back().event_id.get());
+        EXPECT_TRUE(read_event.read_events(1).empty());
+        EXPECT_TRUE(read_event().empty());
+        EXPECT_TRUE(read_event.done());
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(EventReaderTests,
                          EventReaderTest,
                          testing::Values("event-record.hepmc3",
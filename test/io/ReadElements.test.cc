@@ -0,0 +1,258 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ReadElements.test.cc
+//---------------------------------------------------------------------------//
+#include "io/ReadElements.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "base/Range.hh"
+#include "io/LivermorePEReader.hh"
+#include "io/SeltzerBergerReader.hh"
+#include "io/detail/AsciiNumberReader.hh"
+#include "celeritas_test.hh"
+
+using celeritas::LivermorePEReader;
+using celeritas::read_elements;
+using celeritas::SeltzerBergerReader;
+using celeritas::detail::AsciiNumberReader;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class AsciiNumberReaderTest : public celeritas::Test
+{
+  protected:
+    std::string write_file(const std::string& contents)
+    {
+        std::string   filename = this->make_unique_filename(".txt");
+        std::ofstream out(filename);
+        out << contents;
+        return filename;
+    }
+};
+
+class ReadElementsTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        data_path_ = this->test_data_path("physics/em", "");
+    }
+
+    std::string data_path_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(AsciiNumberReaderTest, reals)
+{
+    const char* tokens[] = {"0",
+                            "-0",
+                            "+3.5",
+                            ".5",
+                            "7.",
+                            "1e-12",
+                            "0.025",
+                            "-6.9078",
+                            "4.6875e-2",
+                            "0.1",
+                            "2.5E+03",
+                            "1.7976931348623157e308",
+                            "2.2250738585072014e-308",
+                            "4.9406564584124654e-324",
+                            "0.1234567890123456789012",
+                            "123456789012345678901234",
+                            "9007199254740993",
+                            "1e23",
+                            "8.98846567431158e307"};
+
+    std::ostringstream os;
+    for (const char* t : tokens)
+    {
+        os << t << (os.tellp() % 3 ? " " : "\n\t ");
+    }
+
+    // Real numbers should be parsed identically to stream extraction
+    std::istringstream expected(os.str());
+    AsciiNumberReader  actual(this->write_file(os.str()));
+    for (const char* t : tokens)
+    {
+        double expected_value = -1;
+        double actual_value   = -2;
+        expected >> expected_value;
+        actual >> actual_value;
+        ASSERT_TRUE(actual) << "failed to read " << t;
+        EXPECT_EQ(expected_value, actual_value) << "for " << t;
+        EXPECT_EQ(std::signbit(expected_value), std::signbit(actual_value))
+            << "for " << t;
+    }
+    EXPECT_TRUE(actual.at_end());
+
+    // Extracting past the end fails
+    double value = 0;
+    actual >> value;
+    EXPECT_FALSE(actual);
+}
+
+TEST_F(AsciiNumberReaderTest, random_reals)
+{
+    std::mt19937                           rng;
+    std::uniform_real_distribution<double> sample_mantissa(-10, 10);
+    std::uniform_int_distribution<int>     sample_exponent(-40, 40);
+    std::uniform_int_distribution<int>     sample_precision(1, 17);
+
+    std::ostringstream  os;
+    std::vector<double> expected;
+    char                buffer[64];
+    for (int i = 0; i < 10000; ++i)
+    {
+        double x = std::ldexp(sample_mantissa(rng), sample_exponent(rng));
+        std::snprintf(buffer,
+                      sizeof(buffer),
+                      (i % 2 ? "%.*g" : "%.*e"),
+                      sample_precision(rng),
+                      x);
+        os << buffer << ' ';
+        expected.push_back(std::strtod(buffer, nullptr));
+    }
+
+    AsciiNumberReader   reader(this->write_file(os.str()));
+    std::vector<double> actual(expected.size());
+    for (double& x : actual)
+    {
+        reader >> x;
+    }
+    EXPECT_TRUE(reader);
+    EXPECT_TRUE(reader.at_end());
+    EXPECT_VEC_EQ(expected, actual);
+}
+
+TEST_F(AsciiNumberReaderTest, integers)
+{
+    AsciiNumberReader reader(this->write_file("  12 -3\n+4 0057 98"));
+    int               a = 0;
+    int               b = 0;
+    unsigned int      c = 0;
+    std::size_t       d = 0;
+    double            e = 0;
+    reader >> a >> b >> c >> d >> e;
+    EXPECT_TRUE(reader);
+    EXPECT_EQ(12, a);
+    EXPECT_EQ(-3, b);
+    EXPECT_EQ(4, c);
+    EXPECT_EQ(57, d);
+    EXPECT_EQ(98.0, e);
+    EXPECT_TRUE(reader.at_end());
+}
+
+TEST_F(AsciiNumberReaderTest, errors)
+{
+    {
+        // Missing file
+        AsciiNumberReader reader(this->make_unique_filename(".missing"));
+        EXPECT_FALSE(reader);
+    }
+    {
+        // Empty file
+        AsciiNumberReader reader(this->write_file(" \n "));
+        EXPECT_TRUE(reader);
+        EXPECT_TRUE(reader.at_end());
+    }
+    {
+        // Non-numeric and unsigned negative values fail and stay failed
+        AsciiNumberReader reader(this->write_file("1.5 abc 2"));
+        double            x = 0;
+        reader >> x;
+        EXPECT_TRUE(reader);
+        EXPECT_EQ(1.5, x);
+        reader >> x;
+        EXPECT_FALSE(reader);
+        EXPECT_EQ(1.5, x);
+        reader >> x;
+        EXPECT_FALSE(reader);
+    }
+    {
+        AsciiNumberReader reader(this->write_file("-1"));
+        unsigned int      i = 0;
+        reader >> i;
+        EXPECT_FALSE(reader);
+    }
+}
+
+TEST_F(ReadElementsTest, seltzer_berger)
+{
+    SeltzerBergerReader read_sb(data_path_.c_str());
+    auto                expected = read_sb(29);
+
+    for (int num_threads : {0, 1, 2})
+    {
+        auto result = read_elements(read_sb, {29, 29, 29}, num_threads);
+        ASSERT_EQ(3, result.size());
+        for (const auto& actual : result)
+        {
+            EXPECT_VEC_EQ(expected.x, actual.x);
+            EXPECT_VEC_EQ(expected.y, actual.y);
+            EXPECT_VEC_EQ(expected.value, actual.value);
+        }
+    }
+    EXPECT_EQ(57, expected.x.size());
+    EXPECT_EQ(32, expected.y.size());
+    EXPECT_EQ(57 * 32, expected.value.size());
+
+    // Errors for missing elements are rethrown
+    EXPECT_THROW(read_elements(read_sb, {29, 30, 29}),
+                 celeritas::RuntimeError);
+}
+
+TEST_F(ReadElementsTest, livermore_pe)
+{
+    LivermorePEReader read_pe(data_path_.c_str());
+    auto              result = read_elements(read_pe, {19, 19});
+    ASSERT_EQ(2, result.size());
+
+    // Compare the high-energy cross sections with stream extraction
+    std::vector<double> expected_x;
+    std::vector<double> expected_y;
+    {
+        std::ifstream infile(data_path_ + "/pe-cs-19.dat");
+        ASSERT_TRUE(infile);
+        double      emin;
+        double      emax;
+        std::size_t size;
+        infile >> emin >> emax >> size >> size;
+        expected_x.resize(size);
+        expected_y.resize(size);
+        for (auto i : celeritas::range(size))
+        {
+            infile >> expected_x[i] >> expected_y[i];
+        }
+    }
+
+    for (const auto& actual : result)
+    {
+        EXPECT_VEC_EQ(expected_x, actual.xs_hi.x);
+        EXPECT_VEC_EQ(expected_y, actual.xs_hi.y);
+        EXPECT_VEC_EQ(result[0].xs_lo.y, actual.xs_lo.y);
+        EXPECT_EQ(result[0].thresh_lo, actual.thresh_lo);
+        ASSERT_EQ(result[0].shells.size(), actual.shells.size());
+        for (auto i : celeritas::range(actual.shells.size()))
+        {
+            EXPECT_VEC_EQ(result[0].shells[i].param_hi,
+                          actual.shells[i].param_hi);
+            EXPECT_VEC_EQ(result[0].shells[i].xs, actual.shells[i].xs);
+        }
+    }
+    EXPECT_FALSE(expected_x.empty());
+    EXPECT_EQ(8, result[0].shells.size());
+}
@@ -25,6 +25,12 @@ auto MockModel::applicability() const -> SetApplicability
     return {applic_};
 }
 
+void MockModel::interact(const HostInteractRefs&) const
+{
+    // Inform calling test code that we've been launched
+    cb_(this->model_id());
+}
+
 void MockModel::interact(const DeviceInteractRefs&) const
 {
     // Inform calling test code that we've been launched
@@ -32,6 +32,7 @@ class MockModel final : public celeritas::Model
   public:
     MockModel(ModelId id, Applicability applic, ModelCallback cb);
     SetApplicability applicability() const final;
+    void             interact(const HostInteractRefs&) const final;
     void             interact(const DeviceInteractRefs&) const final;
     ModelId          model_id() const final { return id_; }
     std::string      label() const final;
@@ -8,6 +8,9 @@
 #include "physics/base/PhysicsParams.hh"
 #include "physics/base/PhysicsTrackView.hh"
 
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include "celeritas_test.hh"
 #include "base/Range.hh"
 #include "base/CollectionStateStore.hh"
@@ -91,6 +94,108 @@ TEST_F(PhysicsParamsTest, accessors)
     EXPECT_VEC_EQ(expected_process_map, process_map);
 }
 
+TEST_F(PhysicsParamsTest, cache)
+{
+    using HostRef
+        = PhysicsParamsData<Ownership::const_reference, MemSpace::host>;
+
+    auto read_file = [](const std::string& filename) {
+        std::ifstream infile(filename, std::ios::in | std::ios::binary);
+        return std::string{std::istreambuf_iterator<char>(infile),
+                           std::istreambuf_iterator<char>()};
+    };
+
+    PhysicsInput inp   = this->build_physics_input();
+    inp.cache_filename = this->make_unique_filename(".bin");
+    inp.cache_key      = "mock";
+
+    // Build and write the cache
+    PhysicsParams built(inp);
+    std::string   cached = read_file(inp.cache_filename);
+    EXPECT_FALSE(cached.empty());
+
+    // Load from the cache
+    PhysicsParams  loaded(inp);
+    const HostRef& expected = built.host_pointers();
+    const HostRef& actual   = loaded.host_pointers();
+    EXPECT_EQ(cached, read_file(inp.cache_filename));
+    EXPECT_VEC_EQ(expected.reals[AllItems<real_type>{}],
+                  actual.reals[AllItems<real_type>{}]);
+    EXPECT_EQ(expected.value_grids.size(), actual.value_grids.size());
+    EXPECT_EQ(expected.model_groups.size(), actual.model_groups.size());
+    EXPECT_EQ(expected.process_groups.size(), actual.process_groups.size());
+    EXPECT_EQ(built.max_particle_processes(), loaded.max_particle_processes());
+    EXPECT_EQ(expected.scaling_min_range, actual.scaling_min_range);
+    ASSERT_EQ(expected.process_ids.size(), actual.process_ids.size());
+    for (auto i : range(expected.process_ids.size()))
+    {
+        EXPECT_EQ(expected.process_ids[ItemId<ProcessId>{i}].get(),
+                  actual.process_ids[ItemId<ProcessId>{i}].get());
+    }
+
+    // Changing the inputs invalidates the cache
+    inp.options.min_range *= 2;
+    PhysicsParams rebuilt(inp);
+    EXPECT_NE(cached, read_file(inp.cache_filename));
+    EXPECT_EQ(2 * built.host_pointers().scaling_min_range,
+              rebuilt.host_pointers().scaling_min_range);
+
+    // So does changing a material property without changing the number of
+    // materials
+    cached = read_file(inp.cache_filename);
+    {
+        using namespace celeritas::units;
+        MaterialParams::Input mat_inp;
+        mat_inp.elements = {{1, AmuMass{1.0}, "celerogen"},
+                            {4, AmuMass{10.0}, "celerinium"}};
+        mat_inp.materials.push_back({1e20,
+                                     300,
+                                     MatterState::gas,
+                                     {{ElementId{0}, 1.0}},
+                                     "lo density celerogen"});
+        mat_inp.materials.push_back({1e21,
+                                     300,
+                                     MatterState::liquid,
+                                     {{ElementId{0}, 1.0}},
+                                     "hi density celerogen"});
+        mat_inp.materials.push_back({2e23,
+                                     300,
+                                     MatterState::solid,
+                                     {{ElementId{1}, 1.0}},
+                                     "dense celerinium"});
+        inp.materials = std::make_shared<MaterialParams>(std::move(mat_inp));
+    }
+    PhysicsParams denser(inp);
+    EXPECT_NE(cached, read_file(inp.cache_filename));
+}
+
+TEST_F(PhysicsParamsTest, num_threads)
+{
+    auto read_file = [](const std::string& filename) {
+        std::ifstream infile(filename, std::ios::in | std::ios::binary);
+        return std::string{std::istreambuf_iterator<char>(infile),
+                           std::istreambuf_iterator<char>()};
+    };
+
+    // Write the built data to a cache file to compare it byte for byte
+    auto build = [&](int num_threads) {
+        PhysicsInput inp   = this->build_physics_input();
+        inp.cache_filename = this->make_unique_filename(".bin");
+        inp.num_threads    = num_threads;
+        std::remove(inp.cache_filename.c_str());
+        PhysicsParams built(inp);
+        return read_file(inp.cache_filename);
+    };
+
+    std::string expected = build(1);
+    EXPECT_FALSE(expected.empty());
+    for (int num_threads : {0, 2, 3, 8})
+    {
+        EXPECT_EQ(expected, build(num_threads))
+            << "with " << num_threads << " threads";
+    }
+}
+
 //---------------------------------------------------------------------------//
 // PHYSICS TRACK VIEW (HOST)
 //---------------------------------------------------------------------------//
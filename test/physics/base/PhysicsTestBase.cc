@@ -85,6 +85,12 @@ auto PhysicsTestBase::build_physics_options() const -> PhysicsOptions
 
 //---------------------------------------------------------------------------//
 auto PhysicsTestBase::build_physics() const -> SPConstPhysics
+{
+    return std::make_shared<PhysicsParams>(this->build_physics_input());
+}
+
+//---------------------------------------------------------------------------//
+auto PhysicsTestBase::build_physics_input() const -> PhysicsInput
 {
     using Barn = MockProcess::BarnMicroXs;
     PhysicsParams::Input physics_inp;
@@ -146,7 +152,7 @@ auto PhysicsTestBase::build_physics() const -> SPConstPhysics
         inp.energy_loss = 0.5 * 1e-20;
         physics_inp.processes.push_back(std::make_shared<MockProcess>(inp));
     }
-    return std::make_shared<PhysicsParams>(std::move(physics_inp));
+    return physics_inp;
 }
 
 //---------------------------------------------------------------------------//
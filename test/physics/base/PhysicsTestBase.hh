@@ -42,6 +42,7 @@ class PhysicsTestBase : public celeritas::Test
     using SPConstParticles = std::shared_ptr<celeritas::ParticleParams>;
     using SPConstPhysics   = std::shared_ptr<celeritas::PhysicsParams>;
     using PhysicsOptions   = celeritas::PhysicsParams::Options;
+    using PhysicsInput     = celeritas::PhysicsParams::Input;
     using Applicability    = celeritas::Applicability;
     using ModelId          = celeritas::ModelId;
     using ModelCallback    = std::function<void(ModelId)>;
@@ -55,6 +56,8 @@ class PhysicsTestBase : public celeritas::Test
     virtual PhysicsOptions   build_physics_options() const;
     virtual SPConstPhysics   build_physics() const;
 
+    PhysicsInput build_physics_input() const;
+
     const SPConstMaterials& materials() const { return materials_; }
     const SPConstParticles& particles() const { return particles_; }
     const SPConstPhysics&   physics() const { return physics_; }
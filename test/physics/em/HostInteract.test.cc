@@ -0,0 +1,302 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HostInteract.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas_config.h"
+#include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
+#include "base/StackAllocator.hh"
+#include "physics/base/CutoffParams.hh"
+#include "physics/base/ModelInterface.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/PhysicsTrackView.hh"
+#include "physics/em/BetheHeitlerModel.hh"
+#include "physics/em/EPlusGGModel.hh"
+#include "physics/em/KleinNishinaModel.hh"
+#include "physics/em/MollerBhabhaModel.hh"
+#include "physics/material/MaterialTrackView.hh"
+#include "random/RngParams.hh"
+#include "celeritas_test.hh"
+#include "../base/PhysicsTestBase.hh"
+
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+using namespace celeritas;
+namespace pdg = celeritas::pdg;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+/*!
+ * Launch host interactions over a subset of track slots.
+ *
+ * Each model is launched with 1 and several OpenMP threads, and the
+ * interactions and secondaries in every track slot must be identical since
+ * each slot has its own RNG stream.
+ */
+class HostInteractTest : public celeritas_test::PhysicsTestBase
+{
+    using Base = celeritas_test::PhysicsTestBase;
+
+  protected:
+    //! Flattened interaction results over all track slots
+    struct Result
+    {
+        std::vector<int>    actions;
+        std::vector<double> energies;
+        std::vector<int>    num_secondaries;
+        std::vector<int>    secondary_ids;
+        std::vector<double> secondary_energies;
+    };
+
+    //! Host state storage for a single launch
+    struct States
+    {
+        template<template<Ownership, MemSpace> class S>
+        using StateValue = S<Ownership::value, MemSpace::host>;
+        template<class T>
+        using Items = StateCollection<T, Ownership::value, MemSpace::host>;
+
+        StateValue<ParticleStateData> particle;
+        StateValue<MaterialStateData> material;
+        StateValue<PhysicsStateData>  physics;
+        StateValue<RngStateData>      rng;
+        Items<Real3>                  direction;
+        Items<Interaction>            interactions;
+        StackAllocatorData<Secondary, Ownership::value, MemSpace::host>
+            secondaries;
+    };
+
+    void SetUp() override
+    {
+        Base::SetUp();
+
+        CutoffParams::Input input;
+        input.particles = this->particles();
+        input.materials = this->materials();
+        input.cutoffs[pdg::electron()] = CutoffParams::MaterialCutoffs(
+            this->materials()->size(), {units::MevEnergy{0.01}, 0.1});
+        cutoffs_ = std::make_shared<CutoffParams>(input);
+        rng_     = std::make_shared<RngParams>(12345);
+
+#if CELERITAS_USE_OPENMP
+        orig_num_threads_ = omp_get_max_threads();
+#endif
+    }
+
+    void TearDown() override { this->set_num_threads(orig_num_threads_); }
+
+    SPConstParticles build_particles() const override
+    {
+        using namespace celeritas::units;
+
+        constexpr auto zero   = zero_quantity();
+        constexpr auto stable = ParticleDef::stable_decay_constant();
+
+        ParticleParams::Input inp;
+        inp.push_back({"gamma", pdg::gamma(), zero, zero, stable});
+        inp.push_back({"celeriton",
+                       PDGNumber{1337},
+                       MevMass{1},
+                       ElementaryCharge{1},
+                       stable});
+        inp.push_back({"anti-celeriton",
+                       PDGNumber{-1337},
+                       MevMass{1},
+                       ElementaryCharge{-1},
+                       stable});
+        inp.push_back({"electron",
+                       pdg::electron(),
+                       MevMass{0.5109989461},
+                       ElementaryCharge{-1},
+                       stable});
+        inp.push_back({"positron",
+                       pdg::positron(),
+                       MevMass{0.5109989461},
+                       ElementaryCharge{1},
+                       stable});
+        return std::make_shared<ParticleParams>(std::move(inp));
+    }
+
+    //! Set the number of host threads
+    void set_num_threads(CELER_MAYBE_UNUSED int num_threads)
+    {
+#if CELERITAS_USE_OPENMP
+        omp_set_num_threads(num_threads);
+#endif
+    }
+
+    // Launch the model and return the results from each track slot
+    Result interact(const Model& model, PDGNumber pdg, units::MevEnergy e);
+
+    // Compare results with different numbers of threads
+    void check(const Model& model, PDGNumber pdg, units::MevEnergy e);
+
+    std::shared_ptr<CutoffParams> cutoffs_;
+    std::shared_ptr<RngParams>    rng_;
+
+    //! Number of track slots, some of which don't select the model
+    size_type num_tracks_ = 100;
+
+  private:
+    int orig_num_threads_ = 1;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Interact with every track slot except every third one.
+ */
+auto HostInteractTest::interact(const Model&     model,
+                                PDGNumber        pdg,
+                                units::MevEnergy energy) -> Result
+{
+    const ParticleId pid       = this->particles()->find(pdg);
+    const auto&      materials = this->materials()->host_pointers();
+    const auto&      particles = this->particles()->host_pointers();
+    const auto&      physics   = this->physics()->host_pointers();
+    CELER_ASSERT(pid);
+
+    // Allocate states, with just enough secondary storage for the
+    // interactions (at most two per track) plus unused chunks
+    States states;
+    resize(&states.particle, particles, num_tracks_);
+    resize(&states.material, materials, num_tracks_);
+    resize(&states.physics, physics, num_tracks_);
+    resize(&states.rng, rng_->host_pointers(), num_tracks_);
+    make_builder(&states.direction).resize(num_tracks_);
+    make_builder(&states.interactions).resize(num_tracks_);
+    resize(&states.secondaries,
+           2 * num_tracks_ + host_secondary_overhead(1));
+
+    ModelInteractRefs<MemSpace::host> refs;
+    refs.params.particle     = particles;
+    refs.params.material     = materials;
+    refs.params.physics      = physics;
+    refs.params.cutoffs      = cutoffs_->host_pointers();
+    refs.states.particle     = states.particle;
+    refs.states.material     = states.material;
+    refs.states.physics      = states.physics;
+    refs.states.rng          = states.rng;
+    refs.states.direction    = states.direction;
+    refs.states.interactions = states.interactions;
+    refs.states.secondaries  = states.secondaries;
+    CELER_ASSERT(refs);
+
+    std::vector<ThreadId> thread_ids;
+    for (auto i : range(num_tracks_))
+    {
+        ThreadId tid{i};
+        ParticleTrackView(particles, refs.states.particle, tid)
+            = {pid, energy};
+        MaterialTrackView(materials, refs.states.material, tid)
+            = {MaterialId{i % this->materials()->size()}};
+        refs.states.direction[tid]    = {0, 0, 1};
+        refs.states.interactions[tid] = Interaction::from_failure();
+        if (i % 3 != 1)
+        {
+            PhysicsTrackView phys(physics,
+                                  refs.states.physics,
+                                  pid,
+                                  MaterialId{},
+                                  tid);
+            phys = PhysicsTrackInitializer{};
+            phys.model_id(model.model_id());
+            thread_ids.push_back(tid);
+        }
+    }
+    refs.thread_ids = make_span(thread_ids);
+
+    model.interact(refs);
+
+    Result    result;
+    size_type total_secondaries = 0;
+    for (auto i : range(num_tracks_))
+    {
+        const Interaction& interaction = refs.states.interactions[ThreadId{i}];
+        if (i % 3 == 1)
+        {
+            // Track slots that didn't select the model are untouched
+            EXPECT_EQ(Action::failed, interaction.action) << "track " << i;
+            EXPECT_TRUE(interaction.secondaries.empty()) << "track " << i;
+            continue;
+        }
+        EXPECT_TRUE(interaction) << "track " << i;
+
+        result.actions.push_back(static_cast<int>(interaction.action));
+        result.energies.push_back(interaction.energy.value());
+        result.num_secondaries.push_back(interaction.secondaries.size());
+        for (const Secondary& secondary : interaction.secondaries)
+        {
+            result.secondary_ids.push_back(secondary.particle_id.get());
+            result.secondary_energies.push_back(secondary.energy.value());
+        }
+        total_secondaries += interaction.secondaries.size();
+    }
+
+    // Unused secondary slots are bounded by the reserved overhead
+    StackAllocator<Secondary> allocate(refs.states.secondaries);
+    EXPECT_LE(total_secondaries, allocate.size());
+    EXPECT_LE(allocate.size(),
+              total_secondaries + host_secondary_overhead(1));
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Check that results are independent of the number of host threads.
+ */
+void HostInteractTest::check(const Model&     model,
+                             PDGNumber        pdg,
+                             units::MevEnergy energy)
+{
+    this->set_num_threads(1);
+    Result expected = this->interact(model, pdg, energy);
+    EXPECT_EQ(num_tracks_ - num_tracks_ / 3, expected.actions.size());
+
+    for (int num_threads : {2, 4})
+    {
+        SCOPED_TRACE(num_threads);
+        this->set_num_threads(num_threads);
+        Result actual = this->interact(model, pdg, energy);
+        EXPECT_VEC_EQ(expected.actions, actual.actions);
+        EXPECT_VEC_EQ(expected.energies, actual.energies);
+        EXPECT_VEC_EQ(expected.num_secondaries, actual.num_secondaries);
+        EXPECT_VEC_EQ(expected.secondary_ids, actual.secondary_ids);
+        EXPECT_VEC_EQ(expected.secondary_energies, actual.secondary_energies);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(HostInteractTest, klein_nishina)
+{
+    KleinNishinaModel model(ModelId{0}, *this->particles());
+    this->check(model, pdg::gamma(), units::MevEnergy{10});
+}
+
+TEST_F(HostInteractTest, bethe_heitler)
+{
+    BetheHeitlerModel model(ModelId{1}, *this->particles());
+    this->check(model, pdg::gamma(), units::MevEnergy{100});
+}
+
+TEST_F(HostInteractTest, moller_bhabha)
+{
+    MollerBhabhaModel model(ModelId{2}, *this->particles());
+    this->check(model, pdg::electron(), units::MevEnergy{10});
+    this->check(model, pdg::positron(), units::MevEnergy{10});
+}
+
+TEST_F(HostInteractTest, eplusgg)
+{
+    EPlusGGModel model(ModelId{3}, *this->particles());
+    this->check(model, pdg::positron(), units::MevEnergy{10});
+}
@@ -26,7 +26,9 @@
 #include "physics/grid/ValueGridBuilder.hh"
 #include "physics/grid/ValueGridInserter.hh"
 #include "physics/material/MaterialTrackView.hh"
+#include "physics/em/detail/TransitionSampler.hh"
 #include "physics/em/detail/Utils.hh"
+#include "random/distributions/GenerateCanonical.hh"
 #include "../InteractorHostTestBase.hh"
 #include "../InteractionIO.hh"
 
@@ -402,7 +404,7 @@ TEST_F(LivermorePETest, distributions_all)
     }
     EXPECT_EQ(max_secondary * num_samples,
               this->secondary_allocator().get().size());
-    EXPECT_EQ(2180, num_secondaries);
+    EXPECT_EQ(2160, num_secondaries);
 
     for (const auto& it : energy_to_count)
     {
@@ -410,18 +412,18 @@ TEST_F(LivermorePETest, distributions_all)
         count.push_back(it.second);
     }
     const double expected_costheta_dist[]
-        = {23, 61, 83, 129, 135, 150, 173, 134, 85, 27};
+        = {24, 61, 85, 126, 145, 151, 162, 134, 89, 23};
     const double expected_energy[] = {
         2.901e-05,  3.202e-05,  4.576e-05,  4.604e-05,  4.877e-05,  4.905e-05,
-        6.529e-05,  6.83e-05,   0.00021764, 0.00022065, 0.00023439, 0.00023467,
-        0.0002374,  0.00023768, 0.00025114, 0.00025142, 0.0002517,  0.00025392,
-        0.00025415, 0.00025443, 0.00025471, 0.00027095, 0.00027368, 0.00029016,
-        0.00030691, 0.00030719, 0.00034347, 0.00062884, 0.00069835, 0.00070136,
-        0.0009595,  0.00097625, 0.00097653,
+        6.83e-05,   0.00021764, 0.00022065, 0.00023439, 0.00023467, 0.0002374,
+        0.00023768, 0.00025114, 0.00025142, 0.0002517,  0.00025415, 0.00025443,
+        0.00025471, 0.00026115, 0.00027095, 0.00027368, 0.00029016, 0.00030691,
+        0.00030719, 0.00062884, 0.00069835, 0.00070136, 0.0009595,  0.00097625,
+        0.00097653,
     };
     const int expected_count[] = {
-        42, 80, 26,  24, 27, 54, 2, 5, 5,  5, 4,   141, 61,  3,  2,  169, 260,
-        1,  39, 195, 2,  8,  5,  3, 2, 14, 1, 280, 216, 424, 32, 16, 32};
+        39, 80,  22, 20, 23, 56, 3, 3,  3,  3,   144, 57,  5,  3,  166, 253,
+        45, 190, 6,  1,  7,  5,  1, 11, 14, 269, 231, 417, 31, 18, 34};
     EXPECT_VEC_EQ(expected_costheta_dist, costheta_dist);
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_EQ(expected_count, count);
@@ -489,7 +491,7 @@ TEST_F(LivermorePETest, distributions_radiative)
     }
     EXPECT_EQ(max_secondary * num_samples,
               this->secondary_allocator().get().size());
-    EXPECT_EQ(10007, num_secondaries);
+    EXPECT_EQ(10008, num_secondaries);
 
     for (const auto& it : energy_to_count)
     {
@@ -498,10 +500,9 @@ TEST_F(LivermorePETest, distributions_radiative)
     }
     const double expected_energy[] = {
         6.951e-05,
+        7.252e-05,
         0.00025814,
         0.00026115,
-        0.00034741,
-        0.00034769,
         0.00062884,
         0.00069835,
         0.00070136,
@@ -511,7 +512,7 @@ TEST_F(LivermorePETest, distributions_radiative)
         0.00099578,
     };
     const int expected_count[]
-        = {2, 1, 1, 1, 2, 2525, 2228, 4358, 337, 181, 361, 10};
+        = {2, 2, 1, 3, 2525, 2228, 4357, 337, 182, 361, 10};
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_EQ(expected_count, count);
 }
@@ -635,3 +636,80 @@ TEST_F(LivermorePETest, max_secondaries)
         EXPECT_EQ(3, relax_params_->host_pointers().elements[0].max_secondary);
     }
 }
+
+TEST_F(LivermorePETest, transition_sampling)
+{
+    using celeritas::AtomicRelaxSubshell;
+    using celeritas::detail::TransitionSampler;
+
+    RandomEngine& rng_engine  = this->rng();
+    const int     num_samples = 100000;
+
+    // Reference linear scan over the transition probabilities, where the last
+    // outcome indicates that no transition was sampled
+    auto sample_linear = [&rng_engine](const AtomicRelaxSubshell& shell) {
+        double accum = -celeritas::generate_canonical(rng_engine);
+        for (auto i : celeritas::range(shell.transitions.size()))
+        {
+            accum += shell.transitions[i].probability;
+            if (accum > 0)
+                return i;
+        }
+        return shell.transitions.size();
+    };
+
+    for (bool is_auger_enabled : {false, true})
+    {
+        SCOPED_TRACE(is_auger_enabled ? "auger" : "fluor");
+        relax_inp_.is_auger_enabled = is_auger_enabled;
+        this->set_relaxation_params(relax_inp_);
+        const auto& el = relax_params_->host_pointers().elements[0];
+
+        for (const AtomicRelaxSubshell& shell : el.shells)
+        {
+            auto num_outcomes = shell.transitions.size() + 1;
+            ASSERT_EQ(num_outcomes, shell.alias_table.size());
+
+            // Reconstruct the outcome probabilities from the alias table
+            std::vector<double> expected(num_outcomes, 0);
+            double              total = 0;
+            for (auto i : celeritas::range(shell.transitions.size()))
+            {
+                expected[i] = shell.transitions[i].probability;
+                total += expected[i];
+            }
+            expected.back() = std::fmax(1 - total, 0);
+
+            std::vector<double> actual(num_outcomes, 0);
+            for (auto i : celeritas::range(num_outcomes))
+            {
+                const auto& bin = shell.alias_table[i];
+                ASSERT_LT(bin.alias, num_outcomes);
+                actual[i] += bin.threshold / num_outcomes;
+                actual[bin.alias] += (1 - bin.threshold) / num_outcomes;
+            }
+            EXPECT_VEC_CLOSE(expected, actual, 1e-12, 1e-12);
+
+            // Compare sampled frequencies against the linear scan
+            TransitionSampler   sample_alias(shell);
+            std::vector<double> alias_freq(num_outcomes, 0);
+            std::vector<double> linear_freq(num_outcomes, 0);
+            for (int i = 0; i < num_samples; ++i)
+            {
+                auto trans_id = sample_alias(rng_engine);
+                ++alias_freq[trans_id ? trans_id.get() : num_outcomes - 1];
+                ++linear_freq[sample_linear(shell)];
+            }
+            for (auto i : celeritas::range(num_outcomes))
+            {
+                // Difference of two binomial proportions within 5 sigma
+                double p     = expected[i];
+                double sigma = std::sqrt(2 * p * (1 - p) / num_samples);
+                EXPECT_NEAR(alias_freq[i] / num_samples,
+                            linear_freq[i] / num_samples,
+                            5 * sigma + 1e-12);
+                EXPECT_NEAR(p, alias_freq[i] / num_samples, 5 * sigma + 1e-12);
+            }
+        }
+    }
+}
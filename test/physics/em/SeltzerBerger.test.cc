@@ -8,6 +8,7 @@
 #include "physics/em/detail/SeltzerBergerInteractor.hh"
 #include "physics/em/detail/SBPositronXsCorrector.hh"
 #include "physics/em/detail/SBEnergyDistribution.hh"
+#include "physics/em/detail/SBTabulatedEnergyDistribution.hh"
 #include "physics/em/SeltzerBergerModel.hh"
 #include "physics/material/MaterialView.hh"
 #include "physics/material/MaterialTrackView.hh"
@@ -29,6 +30,7 @@ using celeritas::SeltzerBergerModel;
 using celeritas::SeltzerBergerReader;
 using celeritas::detail::SBEnergyDistribution;
 using celeritas::detail::SBPositronXsCorrector;
+using celeritas::detail::SBTabulatedEnergyDistribution;
 using celeritas::detail::SeltzerBergerInteractor;
 using celeritas::units::AmuMass;
 using celeritas::units::MevMass;
@@ -242,6 +244,96 @@ TEST_F(SeltzerBergerTest, sb_energy_dist)
     EXPECT_VEC_SOFT_EQ(expected_avg_engine_samples, avg_engine_samples);
 }
 
+TEST_F(SeltzerBergerTest, sb_tabulated_energy_dist)
+{
+    // Rebuild the model with cumulative tables
+    std::string         data_path = this->test_data_path("physics/em", "");
+    SeltzerBergerReader read_element_data(data_path.c_str());
+    SeltzerBergerModel  model(ModelId{0},
+                             *this->particle_params(),
+                             *this->material_params(),
+                             read_element_data,
+                             SeltzerBergerModel::EnergySampling::inverse_cdf);
+
+    // Tables are refined by a factor of four and are nondecreasing
+    const auto& xs  = model.host_pointers().differential_xs;
+    const auto& cdf = xs.elements[ElementId{0}].cdf;
+    ASSERT_TRUE(cdf);
+    EXPECT_EQ(31 * 4 + 1, cdf.log_y.size());
+    EXPECT_EQ(57 * cdf.log_y.size(), cdf.values.size());
+    auto cdf_values = xs.reals[cdf.values];
+    for (auto i : celeritas::range(cdf_values.size() - 1))
+    {
+        if ((i + 1) % cdf.log_y.size() != 0)
+        {
+            EXPECT_LE(cdf_values[i], cdf_values[i + 1]) << "at index " << i;
+        }
+    }
+
+    const MevEnergy gamma_cutoff{0.0009};
+    const int       num_samples = 65536;
+    const int       num_bins    = 20;
+
+    for (real_type inc_energy : {0.001, 0.0045, 0.567, 7.89, 89.0, 901.})
+    {
+        SCOPED_TRACE(inc_energy);
+        const auto dens_corr
+            = this->density_correction(MaterialId{0}, Energy{inc_energy});
+        SBEnergyDistribution sample_rejection(model.host_pointers(),
+                                              Energy{inc_energy},
+                                              ElementId{0},
+                                              dens_corr,
+                                              gamma_cutoff);
+        SBTabulatedEnergyDistribution sample_tabulated(model.host_pointers(),
+                                                       Energy{inc_energy},
+                                                       ElementId{0},
+                                                       dens_corr,
+                                                       gamma_cutoff);
+
+        // Histogram the log of the exiting energy
+        const double log_min = std::log(gamma_cutoff.value());
+        const double log_max = std::log(inc_energy);
+        auto         calc_bin = [&](Energy e) {
+            int bin = (std::log(e.value()) - log_min) / (log_max - log_min)
+                      * num_bins;
+            return celeritas::min(celeritas::max(bin, 0), num_bins - 1);
+        };
+        std::vector<double> rejection_hist(num_bins);
+        std::vector<double> tabulated_hist(num_bins);
+
+        RandomEngine& rng_engine = this->rng();
+        for (int i = 0; i < num_samples; ++i)
+        {
+            ++rejection_hist[calc_bin(sample_rejection(rng_engine))];
+        }
+        rng_engine.reset_count();
+        for (int i = 0; i < num_samples; ++i)
+        {
+            Energy exit_gamma = sample_tabulated(rng_engine);
+            EXPECT_GE(exit_gamma.value(), gamma_cutoff.value());
+            EXPECT_LE(exit_gamma.value(), inc_energy);
+            ++tabulated_hist[calc_bin(exit_gamma)];
+        }
+
+        // Sampling takes a fixed number of random numbers
+        EXPECT_EQ(4 * num_samples, rng_engine.count());
+
+        // Two-sample chi-squared test with 19 degrees of freedom; the
+        // critical value is for a significance level of 0.001
+        double chi_sq = 0;
+        for (auto i : celeritas::range(num_bins))
+        {
+            double diff  = rejection_hist[i] - tabulated_hist[i];
+            double total = rejection_hist[i] + tabulated_hist[i];
+            if (total > 0)
+            {
+                chi_sq += diff * diff / total;
+            }
+        }
+        EXPECT_LT(chi_sq, 43.82);
+    }
+}
+
 TEST_F(SeltzerBergerTest, basic)
 {
     using celeritas::MaterialView;
@@ -0,0 +1,97 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file EnergyLookup.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/grid/EnergyLookup.hh"
+
+#include <cmath>
+#include "celeritas_test.hh"
+
+using celeritas::EnergyGridLocation;
+using celeritas::EnergyLookup;
+using celeritas::UniformGridData;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class EnergyLookupTest : public celeritas::Test
+{
+  protected:
+    using Energy = EnergyLookup::Energy;
+
+    void SetUp() override
+    {
+        // Energy from 1 to 1e4 MeV with 5 grid points
+        loge_grid = UniformGridData::from_bounds(0, std::log(1e4), 5);
+    }
+
+    UniformGridData loge_grid;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(EnergyLookupTest, accessors)
+{
+    EnergyLookup lookup(Energy{10});
+    EXPECT_SOFT_EQ(10, lookup.energy().value());
+    EXPECT_SOFT_EQ(std::log(10.0), lookup.log_energy());
+}
+
+TEST_F(EnergyLookupTest, locate)
+{
+    {
+        EnergyLookup              lookup(Energy{1});
+        const EnergyGridLocation& loc = lookup.locate(loge_grid);
+        EXPECT_EQ(0, loc.index);
+        EXPECT_FALSE(loc.in_bounds);
+    }
+    {
+        EnergyLookup              lookup(Energy{0.5});
+        const EnergyGridLocation& loc = lookup.locate(loge_grid);
+        EXPECT_EQ(0, loc.index);
+        EXPECT_FALSE(loc.in_bounds);
+    }
+    {
+        EnergyLookup              lookup(Energy{55});
+        const EnergyGridLocation& loc = lookup.locate(loge_grid);
+        EXPECT_EQ(1, loc.index);
+        EXPECT_TRUE(loc.in_bounds);
+        EXPECT_SOFT_EQ(0.5, loc.fraction);
+        EXPECT_SOFT_EQ(100, loc.upper_energy);
+    }
+    {
+        EnergyLookup              lookup(Energy{1e4});
+        const EnergyGridLocation& loc = lookup.locate(loge_grid);
+        EXPECT_EQ(4, loc.index);
+        EXPECT_FALSE(loc.in_bounds);
+    }
+}
+
+TEST_F(EnergyLookupTest, memoize)
+{
+    EnergyLookup lookup(Energy{55});
+    EXPECT_EQ(1, lookup.locate(loge_grid).index);
+
+    // Identical grid layout reuses the previous result
+    UniformGridData same_grid = loge_grid;
+    EXPECT_EQ(1, lookup.locate(same_grid).index);
+    EXPECT_SOFT_EQ(0.5, lookup.locate(same_grid).fraction);
+
+    // A different grid layout is located again
+    UniformGridData other_grid
+        = UniformGridData::from_bounds(std::log(50.0), std::log(1e3), 3);
+    const EnergyGridLocation& loc = lookup.locate(other_grid);
+    EXPECT_EQ(0, loc.index);
+    EXPECT_TRUE(loc.in_bounds);
+    EXPECT_SOFT_EQ(5.0 / 173.60679774997897, loc.fraction);
+
+    // And the original grid is recalculated when switching back
+    EXPECT_EQ(1, lookup.locate(loge_grid).index);
+    EXPECT_SOFT_EQ(0.5, lookup.locate(loge_grid).fraction);
+}
@@ -0,0 +1,128 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file XsBatchCalculator.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/grid/XsBatchCalculator.hh"
+
+#include <cmath>
+#include <vector>
+#include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
+#include "physics/grid/XsCalculator.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class XsBatchCalculatorTest : public celeritas::Test
+{
+  protected:
+    using GridId = XsBatchCalculator::GridId;
+    using Energy = XsCalculator::Energy;
+
+    void SetUp() override
+    {
+        // Constant xs with no scaling
+        this->add_grid(1, 1e5, 6, XsGridData::no_scaling());
+        // Values increasing as E, scaled above the midpoint
+        this->add_grid(0.1, 1e4, 6, 3);
+        // Scaled at the top point only
+        this->add_grid(1, 100, 3, 2);
+        // Scaled everywhere
+        this->add_grid(1e-3, 1e2, 21, 0);
+
+        grid_ref_ = grid_storage_;
+        real_ref_ = real_storage_;
+
+        // Energies spanning all grids, including out-of-bounds and grid
+        // points; more than one chunk
+        for (auto i : range(301))
+        {
+            energies_.push_back(std::pow(10.0, -4 + i * (11.0 / 300)));
+        }
+        energies_.insert(energies_.end(), {0.1, 1, 10, 100, 1e4, 1e5});
+    }
+
+    void add_grid(real_type emin,
+                  real_type emax,
+                  size_type count,
+                  size_type prime)
+    {
+        XsGridData data;
+        data.log_energy = UniformGridData::from_bounds(
+            std::log(emin), std::log(emax), count);
+        data.prime_index = prime;
+
+        std::vector<real_type> values(count);
+        for (auto i : range(count))
+        {
+            real_type e = std::exp(data.log_energy.front
+                                   + i * data.log_energy.delta);
+            values[i]   = (1 + i % 3) * (i >= prime ? e : 1);
+        }
+        data.value = make_builder(&real_storage_)
+                         .insert_back(values.begin(), values.end());
+        make_builder(&grid_storage_).push_back(data);
+    }
+
+    //! Evaluate a single energy with the scalar calculator
+    real_type calc_scalar(GridId grid, real_type energy) const
+    {
+        XsCalculator calc_xs(grid_ref_[grid], real_ref_);
+        return calc_xs(Energy{energy});
+    }
+
+    Collection<XsGridData, Ownership::value, MemSpace::host> grid_storage_;
+    Collection<real_type, Ownership::value, MemSpace::host>  real_storage_;
+    XsBatchCalculator::Grids                                 grid_ref_;
+    XsBatchCalculator::Values                                real_ref_;
+    std::vector<real_type>                                   energies_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(XsBatchCalculatorTest, single_grid)
+{
+    XsBatchCalculator calc_xs(grid_ref_, real_ref_);
+    std::vector<real_type> xs(energies_.size());
+
+    for (auto grid : range(GridId{grid_storage_.size()}))
+    {
+        calc_xs(grid, make_span(energies_), make_span(xs));
+        for (auto i : range(energies_.size()))
+        {
+            EXPECT_SOFT_EQ(this->calc_scalar(grid, energies_[i]), xs[i])
+                << "for E=" << energies_[i] << " on grid " << grid.get();
+        }
+    }
+}
+
+TEST_F(XsBatchCalculatorTest, mixed_grids)
+{
+    XsBatchCalculator calc_xs(grid_ref_, real_ref_);
+
+    std::vector<GridId> grids;
+    for (auto i : range(energies_.size()))
+    {
+        grids.push_back(GridId((i * 7) % grid_storage_.size()));
+    }
+
+    std::vector<real_type> xs(energies_.size());
+    calc_xs(make_span(grids), make_span(energies_), make_span(xs));
+    for (auto i : range(energies_.size()))
+    {
+        EXPECT_SOFT_EQ(this->calc_scalar(grids[i], energies_[i]), xs[i])
+            << "for E=" << energies_[i] << " on grid " << grids[i].get();
+    }
+
+    // Empty batch
+    calc_xs(Span<const GridId>{}, Span<const real_type>{}, Span<real_type>{});
+}
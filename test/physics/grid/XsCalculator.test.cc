@@ -147,6 +147,21 @@ TEST_F(XsCalculatorTest, scaled_highest)
     EXPECT_SOFT_EQ(.1, calc(Energy{1000}));
 }
 
+TEST_F(XsCalculatorTest, lookup)
+{
+    this->build(0.1, 1e4, 6);
+    this->set_prime_index(3);
+
+    XsCalculator calc(this->data(), this->values());
+    for (real_type e : {0.0001, 0.1, 0.2, 5.0, 1e2, 1e4 - 1e-6, 1e4, 1e5})
+    {
+        // Reuse the same lookup for repeated calculations
+        EnergyLookup lookup(Energy{e});
+        EXPECT_SOFT_EQ(calc(Energy{e}), calc(lookup));
+        EXPECT_SOFT_EQ(calc(Energy{e}), calc(lookup));
+    }
+}
+
 TEST_F(XsCalculatorTest, TEST_IF_CELERITAS_DEBUG(scaled_off_the_end))
 {
     // values of 1, 10, 100 --> actual xs = {1, 10, 100}
@@ -15,10 +15,13 @@
 #include "celeritas_test.hh"
 #include "RngEngine.test.hh"
 #include "base/CollectionStateStore.hh"
+#include "random/RngEngine.hh"
+#include "random/detail/Philox.hh"
 #include "random/distributions/GenerateCanonical.hh"
 
 using celeritas::CollectionStateStore;
 using celeritas::generate_canonical;
+using celeritas::RngEngine;
 using celeritas::RngParams;
 using celeritas::RngStateData;
 using namespace celeritas_test;
@@ -153,6 +156,235 @@ TEST(DiagnosticEngineTest, from_reals)
     EXPECT_EQ(0, rng.count());
 }
 
+//---------------------------------------------------------------------------//
+// HOST RNG
+//---------------------------------------------------------------------------//
+
+TEST(PhiloxTest, known_answers)
+{
+    using celeritas::detail::Philox4x32;
+    using celeritas::detail::PhiloxCounter;
+    using celeritas::detail::PhiloxKey;
+
+    // Known-answer tests from the Random123 distribution
+    {
+        PhiloxCounter actual = Philox4x32::apply({0, 0, 0, 0}, {0, 0});
+        const unsigned int expected[]
+            = {0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u};
+        EXPECT_VEC_EQ(expected, actual);
+    }
+    {
+        PhiloxCounter actual = Philox4x32::apply(
+            {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+            {0xffffffffu, 0xffffffffu});
+        const unsigned int expected[]
+            = {0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu};
+        EXPECT_VEC_EQ(expected, actual);
+    }
+    {
+        PhiloxCounter actual = Philox4x32::apply(
+            {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+            {0xa4093822u, 0x299f31d0u});
+        const unsigned int expected[]
+            = {0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u};
+        EXPECT_VEC_EQ(expected, actual);
+    }
+}
+
+class HostRngEngineTest : public celeritas::Test
+{
+  public:
+    using RngHostStore  = CollectionStateStore<RngStateData, MemSpace::host>;
+    using Initializer_t = RngEngine::Initializer_t;
+
+    void SetUp() override { params = std::make_shared<RngParams>(12345); }
+
+    std::shared_ptr<RngParams> params;
+};
+
+TEST_F(HostRngEngineTest, slots)
+{
+    RngHostStore rng_store(*params, 4);
+
+    std::vector<unsigned int> values;
+    for (auto tid : celeritas::range(celeritas::ThreadId{4}))
+    {
+        RngEngine rng(rng_store.ref(), tid);
+        values.push_back(rng());
+        values.push_back(rng());
+    }
+
+    // Streams in different slots must differ
+    std::vector<unsigned int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    EXPECT_EQ(sorted.end(), std::unique(sorted.begin(), sorted.end()));
+
+    // Re-creating the store gives the same sequence
+    RngHostStore other_store(*params, 4);
+    RngEngine    rng(other_store.ref(), celeritas::ThreadId{2});
+    EXPECT_EQ(values[4], rng());
+    EXPECT_EQ(values[5], rng());
+}
+
+TEST_F(HostRngEngineTest, streams)
+{
+    RngHostStore rng_store(*params, 2);
+    RngEngine    first(rng_store.ref(), celeritas::ThreadId{0});
+    RngEngine    second(rng_store.ref(), celeritas::ThreadId{1});
+
+    Initializer_t init;
+    init.seed  = 12345;
+    init.event = 3;
+    init.track = 17;
+    init.step  = 2;
+
+    // The same track in different slots reproduces the same stream
+    first  = init;
+    second = init;
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(first(), second());
+    }
+
+    // Changing any coordinate changes the stream
+    first             = init;
+    unsigned int orig = first();
+    for (unsigned int Initializer_t::*coord :
+         {&Initializer_t::event, &Initializer_t::track, &Initializer_t::step})
+    {
+        Initializer_t other = init;
+        ++(other.*coord);
+        second = other;
+        EXPECT_NE(orig, second());
+    }
+    Initializer_t other = init;
+    other.seed += 1ull << 32;
+    second = other;
+    EXPECT_NE(orig, second());
+}
+
+TEST_F(HostRngEngineTest, next_step)
+{
+    RngHostStore rng_store(*params, 2);
+    RngEngine    first(rng_store.ref(), celeritas::ThreadId{0});
+    RngEngine    second(rng_store.ref(), celeritas::ThreadId{1});
+
+    Initializer_t init;
+    init.seed  = 12345;
+    init.track = 3;
+    first      = init;
+    second     = init;
+
+    // The next step starts at the same place no matter how many values were
+    // used in the previous one
+    unsigned int orig = first();
+    for (int i = 0; i < 5; ++i)
+    {
+        second();
+    }
+    first.next_step();
+    second.next_step();
+    unsigned int next = first();
+    EXPECT_NE(orig, next);
+    EXPECT_EQ(next, second());
+
+    // It matches a stream keyed directly on the step
+    init.step = 1;
+    second    = init;
+    EXPECT_EQ(next, second());
+}
+
+TEST_F(HostRngEngineTest, state_size)
+{
+    // Run tracks of different lengths through a number of slots, keying each
+    // track's stream when it takes over a slot as track initialization does
+    const unsigned int num_tracks = 10;
+    auto run = [this, num_tracks](celeritas::size_type num_slots) {
+        RngHostStore rng_store(*params, num_slots);
+        std::vector<unsigned int> result;
+        for (unsigned int first = 0; first < num_tracks; first += num_slots)
+        {
+            for (auto tid : celeritas::range(celeritas::ThreadId{num_slots}))
+            {
+                unsigned int track = first + tid.get();
+                if (track >= num_tracks)
+                    break;
+
+                RngEngine     rng(rng_store.ref(), tid);
+                Initializer_t init;
+                init.seed  = 12345;
+                init.event = 1;
+                init.track = track;
+                rng        = init;
+                for (unsigned int step = 0; step < 1 + track % 3; ++step)
+                {
+                    rng.next_step();
+                    for (unsigned int i = 0; i <= track % 2; ++i)
+                    {
+                        result.push_back(rng());
+                    }
+                }
+            }
+        }
+        return result;
+    };
+
+    std::vector<unsigned int> expected = run(num_tracks);
+    EXPECT_VEC_EQ(expected, run(1));
+    EXPECT_VEC_EQ(expected, run(3));
+}
+
+TEST_F(HostRngEngineTest, block)
+{
+    RngHostStore rng_store(*params, 2);
+    RngEngine    rng(rng_store.ref(), celeritas::ThreadId{0});
+    RngEngine    ref_rng(rng_store.ref(), celeritas::ThreadId{1});
+
+    Initializer_t init;
+    init.seed = 1;
+    rng       = init;
+    ref_rng   = init;
+
+    // Blocks are equivalent to consecutive single samples, whether or not
+    // they're aligned with the underlying Philox output
+    for (int offset : {0, 1, 3})
+    {
+        for (int i = 0; i < offset; ++i)
+        {
+            EXPECT_EQ(ref_rng(), rng());
+        }
+        RngEngine::Block_t block = rng.sample_block();
+        for (unsigned int actual : block)
+        {
+            EXPECT_EQ(ref_rng(), actual);
+        }
+    }
+}
+
+TEST_F(HostRngEngineTest, canonical)
+{
+    RngHostStore rng_store(*params, 1);
+    RngEngine    rng(rng_store.ref(), celeritas::ThreadId{0});
+
+    double float_sum   = 0;
+    double double_sum  = 0;
+    int    num_samples = 10000;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        float f = generate_canonical<float>(rng);
+        EXPECT_GE(f, 0.0f);
+        EXPECT_LT(f, 1.0f);
+        float_sum += f;
+
+        double d = generate_canonical<double>(rng);
+        EXPECT_GE(d, 0.0);
+        EXPECT_LT(d, 1.0);
+        double_sum += d;
+    }
+    EXPECT_SOFT_NEAR(0.5, float_sum / num_samples, 0.01);
+    EXPECT_SOFT_NEAR(0.5, double_sum / num_samples, 0.01);
+}
+
 //---------------------------------------------------------------------------//
 // CUDA RNG
 //---------------------------------------------------------------------------//
@@ -0,0 +1,179 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Scoring.test.cc
+//---------------------------------------------------------------------------//
+#include "sim/Scorer.hh"
+#include "sim/ScoringParams.hh"
+#include "sim/ScoringUtils.hh"
+
+#include <cmath>
+#include <random>
+#include "celeritas_config.h"
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class ScoringTest : public celeritas::Test
+{
+  protected:
+    using StateValue = ScoringStateData<Ownership::value, MemSpace::host>;
+    using Energy     = units::MevEnergy;
+
+    void SetUp() override
+    {
+        ScoringParams::Input inp;
+        inp.scorers.push_back({ScorerType::volume, 4, {}});
+        inp.scorers.push_back({ScorerType::material, 2, {}});
+
+        // 2 x 1 x 3 mesh cells
+        ScoringParams::ScorerInput mesh;
+        mesh.type    = ScorerType::mesh;
+        mesh.mesh[0] = UniformGridData::from_bounds(-1, 1, 3);
+        mesh.mesh[1] = UniformGridData::from_bounds(-1, 1, 2);
+        mesh.mesh[2] = UniformGridData::from_bounds(0, 3, 4);
+        inp.scorers.push_back(mesh);
+
+        params = std::make_shared<ScoringParams>(inp);
+    }
+
+    std::shared_ptr<ScoringParams> params;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ScoringTest, params)
+{
+    EXPECT_EQ(3, params->num_scorers());
+    EXPECT_EQ(4 + 2 + 6, params->num_bins());
+    EXPECT_EQ(0, params->scorer(ScorerId{0}).offset);
+    EXPECT_EQ(4, params->scorer(ScorerId{1}).offset);
+    EXPECT_EQ(6, params->scorer(ScorerId{2}).offset);
+    EXPECT_EQ(6, params->scorer(ScorerId{2}).size);
+
+    // Invalid input
+    ScoringParams::Input inp;
+    EXPECT_THROW(ScoringParams{inp}, celeritas::RuntimeError);
+    inp.scorers.push_back({ScorerType::material, 0, {}});
+    EXPECT_THROW(ScoringParams{inp}, celeritas::RuntimeError);
+    inp.scorers.back().type = ScorerType::mesh;
+    EXPECT_THROW(ScoringParams{inp}, celeritas::RuntimeError);
+}
+
+TEST_F(ScoringTest, score)
+{
+    StateValue state;
+    resize(&state, params->host_pointers(), 2);
+    auto state_ref = make_ref(state);
+
+    Scorer score_first(params->host_pointers(), state_ref, 0);
+    Scorer score_second(params->host_pointers(), state_ref, 1);
+
+    score_first(VolumeId{1}, MaterialId{0}, {0.5, 0, 0.5}, Energy{1});
+    score_second(VolumeId{1}, MaterialId{1}, {-0.5, 0, 2.5}, Energy{2});
+    // Outside the mesh and with no volume
+    score_second(VolumeId{}, MaterialId{1}, {0, 0, 3.5}, Energy{4});
+    score_first(VolumeId{3}, MaterialId{}, {-1, -1, 0}, Energy{8});
+
+    std::vector<real_type> result(params->num_bins(), 1000);
+    reduce_scores(&state, make_span(result));
+
+    // clang-format off
+    const real_type expected_result[] = {
+        1000, 1003, 1000, 1008, // volume
+        1001, 1006,             // material
+        1008, 1000, 1002,       // mesh x < 0
+        1001, 1000, 1000        // mesh x > 0
+    };
+    // clang-format on
+    EXPECT_VEC_SOFT_EQ(expected_result, result);
+
+    // Accumulators are reset
+    for (real_type v : state.tally[AllItems<real_type>{}])
+    {
+        EXPECT_EQ(0, v);
+    }
+}
+
+TEST_F(ScoringTest, reproducible)
+{
+    // Deposits of widely varying magnitude, so that the sum depends on the
+    // order of addition
+    const size_type num_tracks = 1000;
+    const size_type num_steps  = 20;
+    std::mt19937    rng;
+    std::uniform_real_distribution<real_type> sample_pos(-1, 3);
+    std::uniform_real_distribution<real_type> sample_exp(-6, 3);
+    std::vector<Real3>                        pos;
+    std::vector<real_type>                    edep;
+    for (CELER_MAYBE_UNUSED auto i : range(num_tracks * num_steps))
+    {
+        pos.push_back({sample_pos(rng) / 2, 0, sample_pos(rng)});
+        edep.push_back(std::pow(real_type(10), sample_exp(rng)));
+    }
+
+    // Score with contiguous blocks of tracks per partition
+    const size_type num_partitions = 7;
+    auto run = [&](CELER_MAYBE_UNUSED int num_threads) {
+        StateValue state;
+        resize(&state, params->host_pointers(), num_partitions);
+        auto state_ref = make_ref(state);
+        std::vector<real_type> result(params->num_bins());
+
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+#endif
+        for (size_type p = 0; p < num_partitions; ++p)
+        {
+            Scorer score(params->host_pointers(), state_ref, p);
+            for (size_type t = p * num_tracks / num_partitions;
+                 t < (p + 1) * num_tracks / num_partitions;
+                 ++t)
+            {
+                for (size_type s = t * num_steps; s < (t + 1) * num_steps;
+                     ++s)
+                {
+                    score(VolumeId{t % 4},
+                          MaterialId{s % 2},
+                          pos[s],
+                          Energy{edep[s]});
+                }
+            }
+        }
+        reduce_scores(&state, make_span(result));
+        return result;
+    };
+
+    std::vector<real_type> expected = run(1);
+    real_type              total    = 0;
+    for (real_type e : edep)
+    {
+        total += e;
+    }
+    real_type volume_total = 0;
+    for (auto i : range(4))
+    {
+        volume_total += expected[i];
+    }
+    EXPECT_SOFT_EQ(total, volume_total);
+
+    // Results are bitwise identical for any number of threads
+    for (int num_threads : {2, 3, 8})
+    {
+        std::vector<real_type> actual = run(num_threads);
+        for (auto i : range(expected.size()))
+        {
+            EXPECT_EQ(expected[i], actual[i]) << "bin " << i << " with "
+                                              << num_threads << " threads";
+        }
+    }
+}
@@ -0,0 +1,515 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackInitHost.test.cc
+//---------------------------------------------------------------------------//
+#include "sim/TrackInitUtils.hh"
+
+#include <algorithm>
+#include <random>
+#include "celeritas_config.h"
+#include "celeritas_test.hh"
+#include "base/CollectionStateStore.hh"
+#include "geometry/GeoParams.hh"
+#include "geometry/GeoTrackView.hh"
+#include "physics/base/ParticleParams.hh"
+#include "physics/material/MaterialParams.hh"
+#include "random/RngEngine.hh"
+#include "random/RngParams.hh"
+#include "sim/TrackInitParams.hh"
+#include "sim/TrackInterface.hh"
+#include "sim/detail/InitializeTracks.hh"
+#include "TrackInit.test.hh"
+
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+namespace celeritas_test
+{
+using namespace celeritas;
+
+template<Ownership W, MemSpace M>
+using SecondaryAllocatorData = celeritas::StackAllocatorData<Secondary, W, M>;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+//! Set the number of host threads for the lifetime of this object
+class ScopedNumThreads
+{
+  public:
+    explicit ScopedNumThreads(CELER_MAYBE_UNUSED int num_threads)
+    {
+#if CELERITAS_USE_OPENMP
+        orig_ = omp_get_max_threads();
+        omp_set_num_threads(num_threads);
+#endif
+    }
+
+    ~ScopedNumThreads()
+    {
+#if CELERITAS_USE_OPENMP
+        omp_set_num_threads(orig_);
+#endif
+    }
+
+  private:
+    int orig_ = 1;
+};
+
+//---------------------------------------------------------------------------//
+//! Produce secondaries and kill tracks on host, like the device test kernel
+void interact(const StateHostRef& states,
+              const SecondaryAllocatorData<Ownership::reference,
+                                           MemSpace::host>& secondaries,
+              const std::vector<size_type>&                 alloc_size,
+              const std::vector<char>&                      alive)
+{
+    CELER_EXPECT(states.size() == alloc_size.size());
+    CELER_EXPECT(states.size() == alive.size());
+
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel for
+#endif
+    for (size_type i = 0; i < states.size(); ++i)
+    {
+        ThreadId     tid{i};
+        SimTrackView sim(states.sim, tid);
+        if (sim.alive())
+        {
+            StackAllocator<Secondary> allocate_secondaries(secondaries);
+            Interactor interact(allocate_secondaries, alloc_size[i], alive[i]);
+            states.interactions[tid] = interact();
+
+            if (!alive[i])
+            {
+                sim.alive(false);
+            }
+        }
+        else
+        {
+            states.interactions[tid] = Interaction::from_absorption();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TrackInitHostTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::string test_file
+            = celeritas::Test::test_data_path("geometry", "twoBoxes.gdml");
+        geo_params = std::make_shared<GeoParams>(test_file.c_str());
+
+        MaterialParams::Input mats;
+        mats.elements  = {{{1, units::AmuMass{1.008}, "H"}}};
+        mats.materials = {{{1e-5 * constants::na_avogadro,
+                            100.0,
+                            MatterState::gas,
+                            {{ElementId{0}, 1.0}},
+                            "H2"}}};
+        material_params = std::make_shared<MaterialParams>(std::move(mats));
+
+        particle_params = std::make_shared<ParticleParams>(
+            ParticleParams::Input{{"gamma",
+                                   pdg::gamma(),
+                                   zero_quantity(),
+                                   zero_quantity(),
+                                   ParticleDef::stable_decay_constant()}});
+
+        rng_params = std::make_shared<RngParams>(12345);
+
+        params.geometry  = geo_params->host_pointers();
+        params.materials = material_params->host_pointers();
+        params.particles = particle_params->host_pointers();
+        params.rng       = rng_params->host_pointers();
+        CELER_ENSURE(params);
+    }
+
+    // Create primaries at distinct positions and allocate host state data
+    void build(size_type num_primaries,
+               size_type num_tracks,
+               size_type storage_factor)
+    {
+        std::vector<Primary> primaries;
+        for (unsigned int i = 0; i < num_primaries; ++i)
+        {
+            primaries.push_back({ParticleId{0},
+                                 units::MevEnergy{1. + i},
+                                 {0., 0., static_cast<real_type>(i)},
+                                 {0., 0., 1.},
+                                 EventId{0},
+                                 TrackId{i}});
+        }
+        init_params = std::make_shared<TrackInitParams>(
+            TrackInitParams::Input{std::move(primaries), storage_factor});
+
+        secondaries
+            = CollectionStateStore<SecondaryAllocatorData, MemSpace::host>(
+                num_tracks * storage_factor);
+        init = {};
+        resize(&init, init_params->host_pointers(), num_tracks);
+        host_states = {};
+        resize(&host_states, params, num_tracks);
+        states = host_states;
+        CELER_ENSURE(states);
+    }
+
+    //! Track IDs of the track slots
+    std::vector<unsigned int> track_ids() const
+    {
+        std::vector<unsigned int> result;
+        for (auto tid : range(ThreadId{states.size()}))
+        {
+            result.push_back(SimTrackView(states.sim, tid).track_id().get());
+        }
+        return result;
+    }
+
+    //! Track IDs of the pending track initializers
+    std::vector<unsigned int> initializer_ids()
+    {
+        std::vector<unsigned int> result;
+        for (const TrackInitializer& ti : init.initializers.pointers())
+        {
+            result.push_back(ti.sim.track_id.get());
+        }
+        return result;
+    }
+
+    //! Indices of the empty track slots
+    std::vector<size_type> vacancies()
+    {
+        auto vac = init.vacancies.pointers();
+        return {vac.begin(), vac.end()};
+    }
+
+    //! Z coordinate of the track slots
+    std::vector<double> z_positions() const
+    {
+        std::vector<double> result;
+        for (auto tid : range(ThreadId{states.size()}))
+        {
+            GeoTrackView geo(params.geometry, states.geometry, tid);
+            result.push_back(geo.pos()[2]);
+        }
+        return result;
+    }
+
+    //! Parent track IDs of the track slots
+    std::vector<unsigned int> parent_ids() const
+    {
+        std::vector<unsigned int> result;
+        for (auto tid : range(ThreadId{states.size()}))
+        {
+            TrackId parent = SimTrackView(states.sim, tid).parent_id();
+            result.push_back(parent ? parent.get() : -1u);
+        }
+        return result;
+    }
+
+    std::shared_ptr<GeoParams>       geo_params;
+    std::shared_ptr<ParticleParams>  particle_params;
+    std::shared_ptr<MaterialParams>  material_params;
+    std::shared_ptr<RngParams>       rng_params;
+    std::shared_ptr<TrackInitParams> init_params;
+
+    CollectionStateStore<SecondaryAllocatorData, MemSpace::host> secondaries;
+    StateData<Ownership::value, MemSpace::host>                  host_states;
+
+    ParamsHostRef         params;
+    StateHostRef          states;
+    TrackInitStateHostVal init;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackInitHostTest, blocked_algorithms)
+{
+    std::mt19937                       rng;
+    std::uniform_int_distribution<int> sample_count(0, 3);
+    std::bernoulli_distribution        sample_alive(0.3);
+
+    for (size_type size : {0, 1, 7, 1000})
+    {
+        std::vector<size_type> vacancies(size);
+        std::vector<size_type> counts(size);
+        for (auto i : range(size))
+        {
+            vacancies[i] = sample_alive(rng) ? detail::flag_id() : i;
+            counts[i]    = sample_count(rng);
+        }
+
+        // Serial reference results, equivalent to the thrust algorithms
+        std::vector<size_type> expected_vacancies;
+        std::copy_if(vacancies.begin(),
+                     vacancies.end(),
+                     std::back_inserter(expected_vacancies),
+                     [](size_type v) { return v != detail::flag_id(); });
+        std::vector<size_type> expected_scan(size);
+        size_type              expected_total = 0;
+        for (auto i : range(size))
+        {
+            expected_scan[i] = expected_total;
+            expected_total += counts[i];
+        }
+
+        for (int num_threads : {1, 2, 3, 8})
+        {
+            ScopedNumThreads scoped_threads(num_threads);
+
+            std::vector<size_type> actual_vacancies = vacancies;
+            size_type              num_vacancies
+                = detail::remove_if_alive<MemSpace::host>(
+                    make_span(actual_vacancies));
+            actual_vacancies.resize(num_vacancies);
+            EXPECT_VEC_EQ(expected_vacancies, actual_vacancies)
+                << "size " << size << " with " << num_threads << " threads";
+
+            std::vector<size_type> actual_scan = counts;
+            EXPECT_EQ(expected_total,
+                      detail::reduce_counts<MemSpace::host>(
+                          make_span(actual_scan)));
+            detail::exclusive_scan_counts<MemSpace::host>(
+                make_span(actual_scan));
+            EXPECT_VEC_EQ(expected_scan, actual_scan)
+                << "size " << size << " with " << num_threads << " threads";
+        }
+    }
+}
+
+TEST_F(TrackInitHostTest, run)
+{
+    const size_type num_primaries  = 12;
+    const size_type num_tracks     = 10;
+    const size_type storage_factor = 10;
+
+    // Same inputs and expected values as the device test
+    const std::vector<size_type> alloc = {1, 1, 0, 0, 1, 1, 0, 0, 1, 1};
+    const std::vector<char>      alive = {0, 1, 0, 1, 0, 1, 0, 1, 0, 1};
+
+    for (int num_threads : {1, 4})
+    {
+        ScopedNumThreads scoped_threads(num_threads);
+        this->build(num_primaries, num_tracks, storage_factor);
+
+        // Check that all of the track slots were marked as empty
+        std::vector<size_type> expected_vacancies
+            = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        EXPECT_VEC_EQ(expected_vacancies, this->vacancies());
+
+        // Create track initializers from primary particles
+        extend_from_primaries(init_params->host_pointers(), &init);
+        std::vector<unsigned int> expected_init_ids
+            = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+        EXPECT_VEC_EQ(expected_init_ids, this->initializer_ids());
+
+        // Initialize the primary tracks
+        initialize_tracks(params, states, &init);
+        std::vector<unsigned int> expected_track_ids
+            = {2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+        EXPECT_VEC_EQ(expected_track_ids, this->track_ids());
+
+        // Process interactions and create initializers from secondaries
+        interact(states, secondaries.ref(), alloc, alive);
+        extend_from_secondaries(params, states, &init);
+
+        // Killed tracks without secondaries leave sorted vacancies
+        expected_vacancies = {2, 6};
+        EXPECT_VEC_EQ(expected_vacancies, this->vacancies());
+
+        // Killed tracks with secondaries are replaced in place by a child
+        auto actual_parent_ids = this->parent_ids();
+        EXPECT_EQ(2, actual_parent_ids[0]);
+        EXPECT_EQ(6, actual_parent_ids[4]);
+        EXPECT_EQ(10, actual_parent_ids[8]);
+
+        // Scanned counts of the remaining secondaries
+        const size_type expected_offsets[] = {0, 0, 1, 1, 1, 1, 2, 2, 2, 2};
+        EXPECT_VEC_EQ(expected_offsets,
+                      init.secondary_counts[AllItems<size_type>{}]);
+
+        // Secondary initializers are ordered by parent thread regardless of
+        // the order the secondaries were allocated in
+        std::vector<ThreadId::size_type> parent_threads;
+        for (ThreadId parent : init.parents.pointers())
+        {
+            parent_threads.push_back(parent.get());
+        }
+        const ThreadId::size_type expected_parent_threads[] = {1, 5, 9};
+        EXPECT_VEC_EQ(expected_parent_threads, parent_threads);
+
+        std::vector<unsigned int> init_parent_ids;
+        for (const TrackInitializer& ti : init.initializers.pointers())
+        {
+            init_parent_ids.push_back(ti.sim.parent_id ? ti.sim.parent_id.get()
+                                                       : -1u);
+        }
+        const unsigned int expected_init_parent_ids[] = {-1u, -1u, 3, 7, 11};
+        EXPECT_VEC_EQ(expected_init_parent_ids, init_parent_ids);
+
+        // Track IDs from the atomic counter depend on thread scheduling
+        auto init_ids = this->initializer_ids();
+        std::sort(init_ids.begin(), init_ids.end());
+        expected_init_ids = {0, 1, 15, 16, 17};
+        EXPECT_VEC_EQ(expected_init_ids, init_ids);
+        init_ids = this->initializer_ids();
+
+        // Fill the vacancies with the most recently added secondaries
+        initialize_tracks(params, states, &init);
+        auto actual_track_ids = this->track_ids();
+        EXPECT_EQ(init_ids[4], actual_track_ids[6]);
+        EXPECT_EQ(init_ids[3], actual_track_ids[2]);
+        actual_parent_ids = this->parent_ids();
+        EXPECT_EQ(7, actual_parent_ids[2]);
+        EXPECT_EQ(11, actual_parent_ids[6]);
+
+        std::sort(actual_track_ids.begin(), actual_track_ids.end());
+        expected_track_ids = {3, 5, 7, 9, 11, 12, 13, 14};
+        expected_track_ids.insert(expected_track_ids.end(),
+                                  {std::min(init_ids[3], init_ids[4]),
+                                   std::max(init_ids[3], init_ids[4])});
+        EXPECT_VEC_EQ(expected_track_ids, actual_track_ids);
+        EXPECT_EQ(3, init.initializers.size());
+    }
+}
+
+TEST_F(TrackInitHostTest, primaries_exceed_slots)
+{
+    const size_type num_primaries  = 12;
+    const size_type num_tracks     = 10;
+    const size_type storage_factor = 10;
+
+    // Slots 0 and 2 are killed; slot 1 survives and produces a secondary
+    const std::vector<size_type> alloc = {0, 1, 0, 0, 0, 0, 0, 0, 0, 0};
+    const std::vector<char>      alive = {0, 1, 0, 1, 1, 1, 1, 1, 1, 1};
+
+    for (int num_threads : {1, 4})
+    {
+        ScopedNumThreads scoped_threads(num_threads);
+        this->build(num_primaries, num_tracks, storage_factor);
+
+        // Only queue as many primaries as there are empty slots
+        extend_from_primaries(
+            init_params->host_pointers(), &init, init.vacancies.size());
+        EXPECT_EQ(num_tracks, init.initializers.size());
+        EXPECT_EQ(num_primaries - num_tracks, init.num_primaries);
+        initialize_tracks(params, states, &init);
+        EXPECT_EQ(0, init.initializers.size());
+        EXPECT_EQ(0, init.vacancies.size());
+
+        // Fill the empty slots with the secondaries first, as the stepping
+        // loop does: the secondary copies its parent's geometry state
+        interact(states, secondaries.ref(), alloc, alive);
+        extend_from_secondaries(params, states, &init);
+        EXPECT_EQ(1, init.parents.size());
+        initialize_tracks(params, states, &init);
+        std::vector<size_type> expected_vacancies = {0};
+        EXPECT_VEC_EQ(expected_vacancies, this->vacancies());
+        EXPECT_EQ(3, this->parent_ids()[2]);
+        EXPECT_SOFT_EQ(3, this->z_positions()[2]);
+
+        // Then fill the remaining empty slot with the last primary, which is
+        // initialized at its own position rather than the parent's
+        extend_from_primaries(
+            init_params->host_pointers(), &init, init.vacancies.size());
+        EXPECT_EQ(1, init.num_primaries);
+        EXPECT_EQ(0, init.parents.size());
+        initialize_tracks(params, states, &init);
+        EXPECT_EQ(1, this->track_ids()[0]);
+        EXPECT_EQ(-1u, this->parent_ids()[0]);
+        EXPECT_SOFT_EQ(1, this->z_positions()[0]);
+        EXPECT_EQ(0, init.vacancies.size());
+    }
+}
+
+TEST_F(TrackInitHostTest, primaries_after_secondaries)
+{
+    const size_type num_primaries  = 12;
+    const size_type num_tracks     = 10;
+    const size_type storage_factor = 10;
+
+    const std::vector<size_type> alloc = {0, 1, 0, 0, 0, 0, 0, 0, 0, 0};
+    const std::vector<char>      alive = {0, 1, 0, 1, 1, 1, 1, 1, 1, 1};
+
+    this->build(num_primaries, num_tracks, storage_factor);
+    extend_from_primaries(
+        init_params->host_pointers(), &init, init.vacancies.size());
+    initialize_tracks(params, states, &init);
+    interact(states, secondaries.ref(), alloc, alive);
+    extend_from_secondaries(params, states, &init);
+    auto secondary_ids = this->initializer_ids();
+    ASSERT_EQ(1, secondary_ids.size());
+
+    // Queueing the primaries behind the secondary invalidates its parent
+    extend_from_primaries(init_params->host_pointers(), &init);
+    EXPECT_EQ(0, init.parents.size());
+    std::vector<unsigned int> expected_init_ids = {secondary_ids[0], 0, 1};
+    EXPECT_VEC_EQ(expected_init_ids, this->initializer_ids());
+
+    // The primaries are initialized at their own positions
+    initialize_tracks(params, states, &init);
+    EXPECT_EQ(1, this->track_ids()[2]);
+    EXPECT_SOFT_EQ(1, this->z_positions()[2]);
+    EXPECT_EQ(0, this->track_ids()[0]);
+    EXPECT_SOFT_EQ(0, this->z_positions()[0]);
+    EXPECT_VEC_EQ(std::vector<unsigned int>{secondary_ids[0]},
+                  this->initializer_ids());
+}
+
+TEST_F(TrackInitHostTest, rng_streams)
+{
+    const size_type num_primaries  = 12;
+    const size_type storage_factor = 10;
+
+    // Sample the first random value of every track, killing all the tracks
+    // after each step so that the slots are reused
+    auto run = [&](size_type num_tracks) {
+        this->build(num_primaries, num_tracks, storage_factor);
+        const std::vector<size_type> alloc(num_tracks, 0);
+        const std::vector<char>      alive(num_tracks, 0);
+
+        std::vector<unsigned int> result(num_primaries);
+        while (init.num_primaries > 0)
+        {
+            extend_from_primaries(
+                init_params->host_pointers(), &init, init.vacancies.size());
+            initialize_tracks(params, states, &init);
+            for (auto tid : range(ThreadId{states.size()}))
+            {
+                SimTrackView sim(states.sim, tid);
+                if (sim.alive())
+                {
+                    RngEngine rng(states.rng, tid);
+                    result[sim.track_id().get()] = rng();
+                }
+            }
+            interact(states, secondaries.ref(), alloc, alive);
+            extend_from_secondaries(params, states, &init);
+        }
+        return result;
+    };
+
+    // A track's random stream doesn't depend on its slot or the state size
+    std::vector<unsigned int> expected = run(num_primaries);
+    EXPECT_VEC_EQ(expected, run(4));
+    EXPECT_VEC_EQ(expected, run(5));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_test